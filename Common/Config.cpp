@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "Config.h"
+#include "Protocol.h"
+#include "Logger.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+
+namespace NexusCore {
+    namespace Common {
+
+        namespace {
+
+            std::string TrimSpaces(const std::string& str) {
+                const size_t begin = str.find_first_not_of(" \t\r\n");
+                if (begin == std::string::npos) {
+                    return std::string();
+                }
+                const size_t end = str.find_last_not_of(" \t\r\n");
+                return str.substr(begin, end - begin + 1);
+            }
+
+        } // namespace
+
+        Config* Config::instance_ = nullptr;
+        std::once_flag Config::init_flag_;
+
+        Config* Config::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new Config();
+            });
+            return instance_;
+        }
+
+        Config::Config() {
+        }
+
+        Config::~Config() {
+        }
+
+        // "key = value"   ini. [section] Ʒ Ű "section.key"  (#, ; ּ)
+        bool Config::LoadFromFile(const std::string& config_file_path) {
+            std::ifstream file(config_file_path);
+            if (!file.is_open()) {
+                return false;
+            }
+
+            std::map<std::string, std::string> loaded;
+            std::string section;
+            std::string line;
+            while (std::getline(file, line)) {
+                line = TrimSpaces(line);
+                if (line.empty() || line[0] == '#' || line[0] == ';') {
+                    continue;
+                }
+                if (line.front() == '[' && line.back() == ']') {
+                    section = TrimSpaces(line.substr(1, line.size() - 2));
+                    continue;
+                }
+
+                const size_t separator = line.find('=');
+                if (separator == std::string::npos) {
+                    continue;
+                }
+                const std::string key = TrimSpaces(line.substr(0, separator));
+                if (key.empty()) {
+                    continue;
+                }
+                loaded[section.empty() ? key : section + "." + key] = TrimSpaces(line.substr(separator + 1));
+            }
+
+            std::lock_guard<std::mutex> lock(config_mutex_);
+            for (auto& [key, value] : loaded) {
+                config_data_[key] = std::move(value);
+            }
+            return true;
+        }
+
+        bool Config::SaveToFile(const std::string& config_file_path) {
+            std::ofstream file(config_file_path, std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(config_mutex_);
+            for (const auto& [key, value] : config_data_) {
+                file << key << " = " << value << '\n';
+            }
+            return file.good();
+        }
+
+        std::string Config::GetString(const std::string& key, const std::string& default_value) {
+            std::lock_guard<std::mutex> lock(config_mutex_);
+            auto it = config_data_.find(key);
+            return it != config_data_.end() ? it->second : default_value;
+        }
+
+        // ڷ        ⺻ ȯ
+        // int    ߶  ʰ    ⺻ ȯ
+        int Config::GetInt(const std::string& key, int default_value) {
+            const std::string value = GetString(key);
+            if (value.empty()) {
+                return default_value;
+            }
+            char* end = nullptr;
+            errno = 0;
+            const long parsed = std::strtol(value.c_str(), &end, 10);
+            if (*end != '\0') {
+                return default_value;
+            }
+            if (errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX) {
+                LOG_WARNING("Config value out of int range: " + key + " = " + value);
+                return default_value;
+            }
+            return static_cast<int>(parsed);
+        }
+
+        bool Config::GetBool(const std::string& key, bool default_value) {
+            const std::string value = GetString(key);
+            if (value == "true" || value == "1" || value == "yes" || value == "on") {
+                return true;
+            }
+            if (value == "false" || value == "0" || value == "no" || value == "off") {
+                return false;
+            }
+            return default_value;
+        }
+
+        double Config::GetDouble(const std::string& key, double default_value) {
+            const std::string value = GetString(key);
+            if (value.empty()) {
+                return default_value;
+            }
+            char* end = nullptr;
+            const double parsed = std::strtod(value.c_str(), &end);
+            return *end == '\0' ? parsed : default_value;
+        }
+
+        void Config::SetString(const std::string& key, const std::string& value) {
+            std::lock_guard<std::mutex> lock(config_mutex_);
+            config_data_[key] = value;
+        }
+
+        void Config::SetInt(const std::string& key, int value) {
+            SetString(key, std::to_string(value));
+        }
+
+        void Config::SetBool(const std::string& key, bool value) {
+            SetString(key, value ? "true" : "false");
+        }
+
+        void Config::SetDouble(const std::string& key, double value) {
+            SetString(key, std::to_string(value));
+        }
+
+        //   б  ȣ (Ͽ ִ  )
+        void Config::InitializeDefaults() {
+            SetInt("server.port", Protocol::Config::SERVER_PORT);
+            SetInt("server.admin_port", Protocol::Config::ADMIN_PORT);
+            SetInt("server.max_clients", Protocol::Config::MAX_CLIENTS);
+            SetInt("session.hibernate_idle_sec", static_cast<int>(Protocol::Config::SESSION_HIBERNATE_IDLE_SEC));
+            SetInt("session.resume_grace_sec", static_cast<int>(Protocol::Config::SESSION_RESUME_GRACE_SEC));
+            SetString("file.storage_root", "uploads");
+        }
+
+    } // namespace Common
+} // namespace NexusCore
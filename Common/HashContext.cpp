@@ -0,0 +1,491 @@
+#include "pch.h"
+#include "HashContext.h"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NEXUS_HASH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define NEXUS_TARGET_SHANI
+#else
+#include <cpuid.h>
+#define NEXUS_TARGET_SHANI __attribute__((target("sha,sse4.1,ssse3")))
+#endif
+#endif
+
+namespace NexusCore {
+    namespace Common {
+        namespace Utils {
+
+            namespace {
+
+                const char HEX_DIGITS[] = "0123456789abcdef";
+
+                std::string ToHex(const uint8_t* bytes, size_t size) {
+                    std::string hex(size * 2, '0');
+                    for (size_t i = 0; i < size; ++i) {
+                        hex[i * 2] = HEX_DIGITS[bytes[i] >> 4];
+                        hex[i * 2 + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+                    }
+                    return hex;
+                }
+
+                inline uint32_t RotateLeft(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+                inline uint32_t RotateRight(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+                inline uint32_t LoadLE32(const uint8_t* p) {
+                    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+                }
+
+                inline uint32_t LoadBE32(const uint8_t* p) {
+                    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+                }
+
+                //   ۸  
+                template<typename ProcessFn>
+                void BufferedUpdate(uint8_t (&buffer)[64], size_t& buffer_pos, uint64_t& total_bytes,
+                    const char* data, size_t size, ProcessFn process) {
+                    const uint8_t* input = reinterpret_cast<const uint8_t*>(data);
+                    total_bytes += size;
+
+                    if (buffer_pos > 0) {
+                        size_t fill = std::min(size, 64 - buffer_pos);
+                        memcpy(buffer + buffer_pos, input, fill);
+                        buffer_pos += fill;
+                        input += fill;
+                        size -= fill;
+                        if (buffer_pos < 64) return;
+                        process(buffer, 1);
+                        buffer_pos = 0;
+                    }
+
+                    // ü    ٷ 
+                    size_t blocks = size / 64;
+                    if (blocks > 0) {
+                        process(input, blocks);
+                        input += blocks * 64;
+                        size -= blocks * 64;
+                    }
+
+                    if (size > 0) {
+                        memcpy(buffer, input, size);
+                        buffer_pos = size;
+                    }
+                }
+
+                //  ȭ: [state ][total_bytes][buffer_pos][buffer]
+                template<size_t WordCount>
+                size_t ExportHashState(uint8_t* out, const uint32_t (&state)[WordCount], uint64_t total_bytes,
+                    const uint8_t (&buffer)[64], size_t buffer_pos) {
+                    uint8_t* cursor = out;
+                    const uint64_t pos = buffer_pos;
+                    memcpy(cursor, state, sizeof(state)); cursor += sizeof(state);
+                    memcpy(cursor, &total_bytes, sizeof(total_bytes)); cursor += sizeof(total_bytes);
+                    memcpy(cursor, &pos, sizeof(pos)); cursor += sizeof(pos);
+                    memcpy(cursor, buffer, sizeof(buffer)); cursor += sizeof(buffer);
+                    return static_cast<size_t>(cursor - out);
+                }
+
+                template<size_t WordCount>
+                bool ImportHashState(const uint8_t* data, size_t size, uint32_t (&state)[WordCount],
+                    uint64_t& total_bytes, uint8_t (&buffer)[64], size_t& buffer_pos) {
+                    if (size != sizeof(state) + sizeof(uint64_t) * 2 + sizeof(buffer)) {
+                        return false;
+                    }
+                    uint64_t pos = 0;
+                    memcpy(state, data, sizeof(state)); data += sizeof(state);
+                    memcpy(&total_bytes, data, sizeof(total_bytes)); data += sizeof(total_bytes);
+                    memcpy(&pos, data, sizeof(pos)); data += sizeof(pos);
+                    if (pos >= 64 || total_bytes % 64 != pos) {
+                        return false;
+                    }
+                    memcpy(buffer, data, sizeof(buffer));
+                    buffer_pos = static_cast<size_t>(pos);
+                    return true;
+                }
+
+                // ===== MD5 =====
+                const uint32_t MD5_K[64] = {
+                    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+                    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+                    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+                    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+                    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+                    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+                    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+                    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+                };
+
+                const int MD5_SHIFT[64] = {
+                    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+                    5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+                    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+                };
+
+                // ===== SHA-256 =====
+                alignas(16) const uint32_t SHA256_K[64] = {
+                    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+                };
+
+                void Sha256CompressScalar(uint32_t state[8], const uint8_t* data, size_t block_count) {
+                    uint32_t w[64];
+                    for (size_t block = 0; block < block_count; ++block, data += 64) {
+                        for (int i = 0; i < 16; ++i) {
+                            w[i] = LoadBE32(data + i * 4);
+                        }
+                        for (int i = 16; i < 64; ++i) {
+                            uint32_t s0 = RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                            uint32_t s1 = RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                        }
+
+                        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+                        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+                        for (int i = 0; i < 64; ++i) {
+                            uint32_t S1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+                            uint32_t ch = (e & f) ^ (~e & g);
+                            uint32_t t1 = h + S1 + ch + SHA256_K[i] + w[i];
+                            uint32_t S0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+                            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+                            uint32_t t2 = S0 + maj;
+                            h = g; g = f; f = e; e = d + t1;
+                            d = c; c = b; b = a; a = t1 + t2;
+                        }
+
+                        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+                        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+                    }
+                }
+
+#if defined(NEXUS_HASH_X86)
+                // SHA-NI  Լ (  4 x 16)
+                NEXUS_TARGET_SHANI
+                void Sha256CompressShaNi(uint32_t state[8], const uint8_t* data, size_t block_count) {
+                    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+                    // ABCD/EFGH -> ABEF/CDGH ġ ȯ
+                    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+                    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+                    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+                    state1 = _mm_shuffle_epi32(state1, 0x1B);
+                    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+                    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+                    for (size_t block = 0; block < block_count; ++block, data += 64) {
+                        const __m128i abef_save = state0;
+                        const __m128i cdgh_save = state1;
+                        __m128i msg[4];
+
+                        for (int group = 0; group < 16; ++group) {
+                            __m128i& current = msg[group & 3];
+                            if (group < 4) {
+                                current = _mm_shuffle_epi8(
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + group * 16)), byte_swap);
+                            }
+                            else {
+                                // W[t] = s1(W[t-2]) + W[t-7] + s0(W[t-15]) + W[t-16]
+                                __m128i next = _mm_sha256msg1_epu32(current, msg[(group - 3) & 3]);
+                                next = _mm_add_epi32(next, _mm_alignr_epi8(msg[(group - 1) & 3], msg[(group - 2) & 3], 4));
+                                current = _mm_sha256msg2_epu32(next, msg[(group - 1) & 3]);
+                            }
+
+                            __m128i rounds = _mm_add_epi32(current,
+                                _mm_load_si128(reinterpret_cast<const __m128i*>(&SHA256_K[group * 4])));
+                            state1 = _mm_sha256rnds2_epu32(state1, state0, rounds);
+                            rounds = _mm_shuffle_epi32(rounds, 0x0E);
+                            state0 = _mm_sha256rnds2_epu32(state0, state1, rounds);
+                        }
+
+                        state0 = _mm_add_epi32(state0, abef_save);
+                        state1 = _mm_add_epi32(state1, cdgh_save);
+                    }
+
+                    // ABEF/CDGH -> ABCD/EFGH 
+                    tmp = _mm_shuffle_epi32(state0, 0x1B);
+                    state1 = _mm_shuffle_epi32(state1, 0xB1);
+                    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+                    state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+                }
+
+                bool DetectShaNi() {
+#if defined(_MSC_VER)
+                    int regs[4] = { 0 };
+                    __cpuid(regs, 0);
+                    if (regs[0] < 7) return false;
+                    __cpuid(regs, 1);
+                    const bool sse41 = (regs[2] & (1 << 19)) != 0;
+                    const bool ssse3 = (regs[2] & (1 << 9)) != 0;
+                    __cpuidex(regs, 7, 0);
+                    const bool sha = (regs[1] & (1 << 29)) != 0;
+#else
+                    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                    if (__get_cpuid_max(0, nullptr) < 7) return false;
+                    __cpuid(1, eax, ebx, ecx, edx);
+                    const bool sse41 = (ecx & (1u << 19)) != 0;
+                    const bool ssse3 = (ecx & (1u << 9)) != 0;
+                    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+                    const bool sha = (ebx & (1u << 29)) != 0;
+#endif
+                    return sha && sse41 && ssse3;
+                }
+#endif
+
+                using Sha256CompressFn = void(*)(uint32_t*, const uint8_t*, size_t);
+
+                Sha256CompressFn SelectSha256Kernel() {
+#if defined(NEXUS_HASH_X86)
+                    if (DetectShaNi()) {
+                        return &Sha256CompressShaNi;
+                    }
+#endif
+                    return &Sha256CompressScalar;
+                }
+
+                // μ     
+                const Sha256CompressFn g_sha256_compress = SelectSha256Kernel();
+
+            } // namespace
+
+            // ===== IncrementalHash =====
+            std::unique_ptr<IncrementalHash> IncrementalHash::Create(HashAlgorithm algorithm) {
+                switch (algorithm) {
+                case HashAlgorithm::MD5:
+                    return std::make_unique<MD5Context>();
+                case HashAlgorithm::SHA256:
+                    return std::make_unique<SHA256Context>();
+                }
+                return nullptr;
+            }
+
+            bool IncrementalHash::DetectAlgorithm(const std::string& hex_digest, HashAlgorithm& out_algorithm) {
+                if (hex_digest.size() == 32) {
+                    out_algorithm = HashAlgorithm::MD5;
+                    return true;
+                }
+                if (hex_digest.size() == 64) {
+                    out_algorithm = HashAlgorithm::SHA256;
+                    return true;
+                }
+                return false;
+            }
+
+            // ===== MD5Context =====
+            void MD5Context::Reset() {
+                state_[0] = 0x67452301;
+                state_[1] = 0xefcdab89;
+                state_[2] = 0x98badcfe;
+                state_[3] = 0x10325476;
+                total_bytes_ = 0;
+                buffer_pos_ = 0;
+            }
+
+            void MD5Context::Update(const char* data, size_t size) {
+                BufferedUpdate(buffer_, buffer_pos_, total_bytes_, data, size,
+                    [this](const uint8_t* blocks, size_t count) { ProcessBlocks(blocks, count); });
+            }
+
+            void MD5Context::ProcessBlocks(const uint8_t* data, size_t block_count) {
+                for (size_t block = 0; block < block_count; ++block, data += 64) {
+                    uint32_t m[16];
+                    for (int i = 0; i < 16; ++i) {
+                        m[i] = LoadLE32(data + i * 4);
+                    }
+
+                    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+                    for (int i = 0; i < 64; ++i) {
+                        uint32_t f;
+                        int g;
+                        if (i < 16) { f = (b & c) | (~b & d); g = i; }
+                        else if (i < 32) { f = (d & b) | (~d & c); g = (5 * i + 1) & 15; }
+                        else if (i < 48) { f = b ^ c ^ d; g = (3 * i + 5) & 15; }
+                        else { f = c ^ (b | ~d); g = (7 * i) & 15; }
+
+                        uint32_t rotated = RotateLeft(a + f + MD5_K[i] + m[g], MD5_SHIFT[i]);
+                        a = d; d = c; c = b; b = b + rotated;
+                    }
+
+                    state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+                }
+            }
+
+            std::string MD5Context::FinalizeHex() {
+                const uint64_t bit_length = total_bytes_ * 8;
+                uint8_t padding[72] = { 0x80 };
+                size_t pad_size = (buffer_pos_ < 56) ? (56 - buffer_pos_) : (120 - buffer_pos_);
+                for (int i = 0; i < 8; ++i) {
+                    padding[pad_size + i] = static_cast<uint8_t>(bit_length >> (8 * i));
+                }
+                Update(reinterpret_cast<const char*>(padding), pad_size + 8);
+
+                uint8_t digest[16];
+                for (int i = 0; i < 4; ++i) {
+                    for (int j = 0; j < 4; ++j) {
+                        digest[i * 4 + j] = static_cast<uint8_t>(state_[i] >> (8 * j));
+                    }
+                }
+                Reset();
+                return ToHex(digest, sizeof(digest));
+            }
+
+            size_t MD5Context::ExportState(uint8_t* out) const {
+                return ExportHashState(out, state_, total_bytes_, buffer_, buffer_pos_);
+            }
+
+            bool MD5Context::ImportState(const uint8_t* data, size_t size) {
+                return ImportHashState(data, size, state_, total_bytes_, buffer_, buffer_pos_);
+            }
+
+            // ===== SHA256Context =====
+            void SHA256Context::Reset() {
+                static const uint32_t initial[8] = {
+                    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+                };
+                memcpy(state_, initial, sizeof(state_));
+                total_bytes_ = 0;
+                buffer_pos_ = 0;
+            }
+
+            void SHA256Context::Update(const char* data, size_t size) {
+                BufferedUpdate(buffer_, buffer_pos_, total_bytes_, data, size,
+                    [this](const uint8_t* blocks, size_t count) { ProcessBlocks(blocks, count); });
+            }
+
+            void SHA256Context::ProcessBlocks(const uint8_t* data, size_t block_count) {
+                g_sha256_compress(state_, data, block_count);
+            }
+
+            std::string SHA256Context::FinalizeHex() {
+                const uint64_t bit_length = total_bytes_ * 8;
+                uint8_t padding[72] = { 0x80 };
+                size_t pad_size = (buffer_pos_ < 56) ? (56 - buffer_pos_) : (120 - buffer_pos_);
+                for (int i = 0; i < 8; ++i) {
+                    padding[pad_size + i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+                }
+                Update(reinterpret_cast<const char*>(padding), pad_size + 8);
+
+                uint8_t digest[32];
+                for (int i = 0; i < 8; ++i) {
+                    digest[i * 4] = static_cast<uint8_t>(state_[i] >> 24);
+                    digest[i * 4 + 1] = static_cast<uint8_t>(state_[i] >> 16);
+                    digest[i * 4 + 2] = static_cast<uint8_t>(state_[i] >> 8);
+                    digest[i * 4 + 3] = static_cast<uint8_t>(state_[i]);
+                }
+                Reset();
+                return ToHex(digest, sizeof(digest));
+            }
+
+            size_t SHA256Context::ExportState(uint8_t* out) const {
+                return ExportHashState(out, state_, total_bytes_, buffer_, buffer_pos_);
+            }
+
+            bool SHA256Context::ImportState(const uint8_t* data, size_t size) {
+                return ImportHashState(data, size, state_, total_bytes_, buffer_, buffer_pos_);
+            }
+
+            bool SHA256Context::IsHardwareAccelerated() {
+                return g_sha256_compress != &Sha256CompressScalar;
+            }
+
+            // ===== ChunkHashVerifier =====
+            ChunkHashVerifier::ChunkHashVerifier(HashAlgorithm algorithm, const std::string& expected_hex,
+                uint32_t total_chunks, uint32_t reorder_window)
+                : hash_(IncrementalHash::Create(algorithm))
+                , expected_hex_(expected_hex)
+                , total_chunks_(total_chunks)
+                , reorder_window_(reorder_window)
+                , next_chunk_(0)
+                , buffered_bytes_(0) {
+            }
+
+            ChunkHashVerifier::SubmitResult ChunkHashVerifier::SubmitChunk(uint32_t chunk_index,
+                const char* data, size_t size) {
+                if (chunk_index >= total_chunks_) {
+                    return SubmitResult::OUT_OF_RANGE;
+                }
+                if (chunk_index < next_chunk_ || pending_chunks_.count(chunk_index) > 0) {
+                    return SubmitResult::DUPLICATE;
+                }
+
+                //   ûũ   ٷ ݿ
+                if (chunk_index == next_chunk_) {
+                    hash_->Update(data, size);
+                    ++next_chunk_;
+                    DrainPending();
+                    return SubmitResult::ACCEPTED;
+                }
+
+                if (chunk_index - next_chunk_ > reorder_window_) {
+                    return SubmitResult::OUT_OF_WINDOW;
+                }
+
+                pending_chunks_.emplace(chunk_index, std::vector<char>(data, data + size));
+                buffered_bytes_ += size;
+                return SubmitResult::ACCEPTED;
+            }
+
+            bool ChunkHashVerifier::RestoreProgress(uint32_t hashed_chunks, uint64_t hashed_bytes,
+                const uint8_t* state, size_t state_size) {
+                if (next_chunk_ != 0 || !pending_chunks_.empty() || hashed_chunks > total_chunks_) {
+                    return false;
+                }
+                // ¿ ûũ   ٸ  ̸ ó · ǵ
+                if ((hashed_chunks > 0 && !hash_->ImportState(state, state_size)) ||
+                    hash_->GetTotalBytes() != hashed_bytes) {
+                    hash_->Reset();
+                    return false;
+                }
+                next_chunk_ = hashed_chunks;
+                return true;
+            }
+
+            void ChunkHashVerifier::DrainPending() {
+                auto it = pending_chunks_.begin();
+                while (it != pending_chunks_.end() && it->first == next_chunk_) {
+                    hash_->Update(it->second.data(), it->second.size());
+                    buffered_bytes_ -= it->second.size();
+                    ++next_chunk_;
+                    it = pending_chunks_.erase(it);
+                }
+            }
+
+            bool ChunkHashVerifier::Verify() {
+                if (!IsComplete()) {
+                    return false;
+                }
+                if (actual_hex_.empty()) {
+                    actual_hex_ = hash_->FinalizeHex();
+                }
+                if (actual_hex_.size() != expected_hex_.size()) {
+                    return false;
+                }
+                for (size_t i = 0; i < actual_hex_.size(); ++i) {
+                    char expected = expected_hex_[i];
+                    if (expected >= 'A' && expected <= 'F') {
+                        expected = static_cast<char>(expected - 'A' + 'a');
+                    }
+                    if (actual_hex_[i] != expected) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+        } // namespace Utils
+    } // namespace Common
+} // namespace NexusCore
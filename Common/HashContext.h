@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+
+namespace NexusCore {
+    namespace Common {
+        namespace Utils {
+
+            //  ؽ ˰
+            enum class HashAlgorithm {
+                MD5,
+                SHA256
+            };
+
+            //  ؽ ؽƮ (ûũ  Update  Finalize)
+            class IncrementalHash {
+            public:
+                virtual ~IncrementalHash() = default;
+
+                virtual void Update(const char* data, size_t size) = 0;
+                virtual std::string FinalizeHex() = 0; // ҹ 16 Ʈ
+                virtual void Reset() = 0;
+                virtual HashAlgorithm GetAlgorithm() const = 0;
+
+                //   / (ε ̾ޱ,  ӽſ ȿ)
+                static constexpr size_t MAX_STATE_SIZE = 128;
+                virtual size_t ExportState(uint8_t* out) const = 0;
+                virtual bool ImportState(const uint8_t* data, size_t size) = 0;
+                virtual uint64_t GetTotalBytes() const = 0; // ݱ ݿ Ʈ 
+
+                // 丮
+                static std::unique_ptr<IncrementalHash> Create(HashAlgorithm algorithm);
+
+                // 16 ̷ ˰  (32: MD5, 64: SHA256)
+                static bool DetectAlgorithm(const std::string& hex_digest, HashAlgorithm& out_algorithm);
+            };
+
+            class MD5Context : public IncrementalHash {
+            public:
+                MD5Context() { Reset(); }
+
+                void Update(const char* data, size_t size) override;
+                std::string FinalizeHex() override;
+                void Reset() override;
+                HashAlgorithm GetAlgorithm() const override { return HashAlgorithm::MD5; }
+                size_t ExportState(uint8_t* out) const override;
+                bool ImportState(const uint8_t* data, size_t size) override;
+                uint64_t GetTotalBytes() const override { return total_bytes_; }
+
+            private:
+                void ProcessBlocks(const uint8_t* data, size_t block_count);
+
+                uint32_t state_[4];
+                uint64_t total_bytes_;
+                uint8_t buffer_[64];
+                size_t buffer_pos_;
+            };
+
+            class SHA256Context : public IncrementalHash {
+            public:
+                SHA256Context() { Reset(); }
+
+                void Update(const char* data, size_t size) override;
+                std::string FinalizeHex() override;
+                void Reset() override;
+                HashAlgorithm GetAlgorithm() const override { return HashAlgorithm::SHA256; }
+                size_t ExportState(uint8_t* out) const override;
+                bool ImportState(const uint8_t* data, size_t size) override;
+                uint64_t GetTotalBytes() const override { return total_bytes_; }
+
+                // Ÿ CPU  (SHA-NI  )
+                static bool IsHardwareAccelerated();
+
+            private:
+                void ProcessBlocks(const uint8_t* data, size_t block_count);
+
+                uint32_t state_[8];
+                uint64_t total_bytes_;
+                uint8_t buffer_[64];
+                size_t buffer_pos_;
+            };
+
+            // ε ûũ ؽ 
+            //   ûũ  ؽÿ ݿϰ, ռ  ûũ
+            //   ȿ ޸𸮿 ߴٰ  ڸ ä ݿѴ.
+            class ChunkHashVerifier {
+            public:
+                enum class SubmitResult {
+                    ACCEPTED,       // ؽ ݿ Ǵ 쿡 
+                    DUPLICATE,      // ̹ ݿ ûũ
+                    OUT_OF_WINDOW,  //    (Ŭ̾Ʈ  ʿ)
+                    OUT_OF_RANGE    // ߸ ûũ ε
+                };
+
+                ChunkHashVerifier(HashAlgorithm algorithm, const std::string& expected_hex,
+                    uint32_t total_chunks, uint32_t reorder_window = DEFAULT_REORDER_WINDOW);
+
+                SubmitResult SubmitChunk(uint32_t chunk_index, const char* data, size_t size);
+
+                //  ûũ ؽÿ ݿǾ
+                bool IsComplete() const { return next_chunk_ == total_chunks_; }
+
+                // Ϸ   ؽÿ  (ҹ )
+                bool Verify();
+
+                // ̾ޱ: ؽÿ ݿ ûũ  / (  ûũ  )
+                // hashed_bytes hashed_chunks  Ʈ.   ̿ ٸ ( ) ź
+                size_t ExportProgress(uint8_t* state_out) const { return hash_->ExportState(state_out); }
+                bool RestoreProgress(uint32_t hashed_chunks, uint64_t hashed_bytes, const uint8_t* state, size_t state_size);
+
+                uint32_t GetNextExpectedChunk() const { return next_chunk_; }
+                uint32_t GetReorderWindow() const { return reorder_window_; }
+                size_t GetBufferedBytes() const { return buffered_bytes_; }
+
+                static constexpr uint32_t DEFAULT_REORDER_WINDOW = 16;
+
+            private:
+                void DrainPending();
+
+                std::unique_ptr<IncrementalHash> hash_;
+                std::string expected_hex_;
+                std::string actual_hex_;
+
+                uint32_t total_chunks_;
+                uint32_t reorder_window_;
+                uint32_t next_chunk_;
+
+                std::map<uint32_t, std::vector<char>> pending_chunks_; //   ûũ
+                size_t buffered_bytes_;
+            };
+
+        } // namespace Utils
+    } // namespace Common
+} // namespace NexusCore
@@ -1,2 +1,121 @@
 #include "pch.h"
 #include "Logger.h"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+namespace NexusCore {
+    namespace Common {
+
+        Logger* Logger::instance_ = nullptr;
+        std::once_flag Logger::init_flag_;
+
+        Logger* Logger::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new Logger();
+            });
+            return instance_;
+        }
+
+        Logger::Logger()
+            : min_log_level_(LogLevel::INFO)
+            , console_output_enabled_(true)
+            , is_initialized_(false) {
+        }
+
+        Logger::~Logger() {
+            Shutdown();
+        }
+
+        bool Logger::Initialize(const std::string& log_file_path, LogLevel min_level) {
+            std::lock_guard<std::mutex> lock(log_mutex_);
+            if (log_file_.is_open()) {
+                log_file_.close();
+            }
+            log_file_.open(log_file_path, std::ios::app);
+            min_log_level_.store(min_level, std::memory_order_relaxed);
+            is_initialized_ = log_file_.is_open();
+            return is_initialized_;
+        }
+
+        void Logger::Shutdown() {
+            std::lock_guard<std::mutex> lock(log_mutex_);
+            if (log_file_.is_open()) {
+                log_file_.flush();
+                log_file_.close();
+            }
+            is_initialized_ = false;
+        }
+
+        void Logger::Log(LogLevel level, const std::string& message) {
+            // ּ  Ʒ   ɷ ȣ 븸 
+            if (level < min_log_level_.load(std::memory_order_relaxed)) {
+                return;
+            }
+            WriteLog(level, message);
+        }
+
+        void Logger::Debug(const std::string& message) { Log(LogLevel::DEBUG, message); }
+        void Logger::Info(const std::string& message) { Log(LogLevel::INFO, message); }
+        void Logger::Warning(const std::string& message) { Log(LogLevel::WARNING, message); }
+        void Logger::Error(const std::string& message) { Log(LogLevel::ERROR, message); }
+        void Logger::Critical(const std::string& message) { Log(LogLevel::CRITICAL, message); }
+
+        void Logger::SetLogLevel(LogLevel level) {
+            min_log_level_.store(level, std::memory_order_relaxed);
+        }
+
+        void Logger::SetConsoleOutput(bool enable) {
+            std::lock_guard<std::mutex> lock(log_mutex_);
+            console_output_enabled_ = enable;
+        }
+
+        std::string Logger::GetCurrentTimeString() {
+            const auto now = std::chrono::system_clock::now();
+            const std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+            const int64_t millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now.time_since_epoch()).count() % 1000;
+
+            std::tm local_time{};
+#ifdef _WIN32
+            localtime_s(&local_time, &seconds);
+#else
+            localtime_r(&seconds, &local_time);
+#endif
+            char buffer[32];
+            const size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local_time);
+            snprintf(buffer + length, sizeof(buffer) - length, ".%03d", static_cast<int>(millis));
+            return buffer;
+        }
+
+        std::string Logger::LogLevelToString(LogLevel level) {
+            switch (level) {
+            case LogLevel::DEBUG: return "DEBUG";
+            case LogLevel::INFO: return "INFO";
+            case LogLevel::WARNING: return "WARNING";
+            case LogLevel::ERROR: return "ERROR";
+            case LogLevel::CRITICAL: return "CRITICAL";
+            default: return "UNKNOWN";
+            }
+        }
+
+        //  ϳ  ȿ ° Ἥ    ʰ  ( WARNING ̻ ٷ flush)
+        void Logger::WriteLog(LogLevel level, const std::string& message) {
+            std::string line = "[" + GetCurrentTimeString() + "] [" + LogLevelToString(level) + "] " + message + "\n";
+
+            std::lock_guard<std::mutex> lock(log_mutex_);
+            if (log_file_.is_open()) {
+                log_file_ << line;
+                if (level >= LogLevel::WARNING) {
+                    log_file_.flush();
+                }
+            }
+            if (console_output_enabled_) {
+                std::cout << line;
+            }
+        }
+
+    } // namespace Common
+} // namespace NexusCore
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <fstream>
 #include <mutex>
@@ -50,7 +51,7 @@ namespace NexusCore {
 
             std::mutex log_mutex_;
             std::ofstream log_file_;
-            LogLevel min_log_level_;
+            std::atomic<LogLevel> min_log_level_; // Log   
             bool console_output_enabled_;
             bool is_initialized_;
 
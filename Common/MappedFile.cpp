@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace NexusCore {
+    namespace Common {
+
+        MappedFile::MappedFile()
+            : data_(nullptr)
+            , size_(0)
+#ifdef _WIN32
+            , file_handle_(INVALID_HANDLE_VALUE)
+            , mapping_handle_(nullptr)
+#else
+            , fd_(-1)
+#endif
+        {
+        }
+
+        MappedFile::~MappedFile() {
+            Close();
+        }
+
+        bool MappedFile::Open(const std::string& file_path, uint64_t size) {
+            Close();
+            file_path_ = file_path;
+
+#ifdef _WIN32
+            file_handle_ = CreateFileA(file_path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS,
+                FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_handle_ == INVALID_HANDLE_VALUE) {
+                return false;
+            }
+
+            LARGE_INTEGER current_size;
+            if (!GetFileSizeEx(file_handle_, &current_size)) {
+                Close();
+                return false;
+            }
+            const uint64_t existing_size = static_cast<uint64_t>(current_size.QuadPart);
+#else
+            fd_ = open(file_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (fd_ < 0) {
+                return false;
+            }
+
+            struct stat info;
+            if (fstat(fd_, &info) != 0) {
+                Close();
+                return false;
+            }
+            const uint64_t existing_size = static_cast<uint64_t>(info.st_size);
+#endif
+            const uint64_t map_size = (size == 0) ? existing_size : size;
+            if (map_size == 0 || !MapView(map_size)) {
+                Close();
+                return false;
+            }
+            return true;
+        }
+
+        bool MappedFile::MapView(uint64_t size) {
+#ifdef _WIN32
+            //  ü    size Ȯ
+            mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+            if (mapping_handle_ == nullptr) {
+                return false;
+            }
+
+            data_ = static_cast<char*>(MapViewOfFile(mapping_handle_, FILE_MAP_ALL_ACCESS, 0, 0,
+                static_cast<SIZE_T>(size)));
+            if (data_ == nullptr) {
+                CloseHandle(mapping_handle_);
+                mapping_handle_ = nullptr;
+                return false;
+            }
+#else
+            struct stat info;
+            if (fstat(fd_, &info) != 0) {
+                return false;
+            }
+            if (static_cast<uint64_t>(info.st_size) < size &&
+                ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+                return false;
+            }
+
+            void* mapped = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            if (mapped == MAP_FAILED) {
+                return false;
+            }
+            data_ = static_cast<char*>(mapped);
+#endif
+            size_ = size;
+            return true;
+        }
+
+        void MappedFile::UnmapView() {
+            if (data_ == nullptr) {
+                return;
+            }
+#ifdef _WIN32
+            UnmapViewOfFile(data_);
+            CloseHandle(mapping_handle_);
+            mapping_handle_ = nullptr;
+#else
+            munmap(data_, static_cast<size_t>(size_));
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        bool MappedFile::Resize(uint64_t new_size) {
+            if (!IsOpen() || new_size == 0) {
+                return false;
+            }
+            UnmapView();
+            return MapView(new_size);
+        }
+
+        bool MappedFile::Flush(bool wait) {
+            if (!IsOpen()) {
+                return false;
+            }
+#ifdef _WIN32
+            if (!FlushViewOfFile(data_, 0)) {
+                return false;
+            }
+            return !wait || FlushFileBuffers(file_handle_);
+#else
+            return msync(data_, static_cast<size_t>(size_), wait ? MS_SYNC : MS_ASYNC) == 0;
+#endif
+        }
+
+        void MappedFile::Close() {
+            UnmapView();
+#ifdef _WIN32
+            if (file_handle_ != INVALID_HANDLE_VALUE) {
+                CloseHandle(file_handle_);
+                file_handle_ = INVALID_HANDLE_VALUE;
+            }
+#else
+            if (fd_ >= 0) {
+                close(fd_);
+                fd_ = -1;
+            }
+#endif
+        }
+
+    } // namespace Common
+} // namespace NexusCore
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace NexusCore {
+    namespace Common {
+
+        // б/ ޸  
+        // ε    μ  Ǿ OS  ĳÿ ´.
+        //  ֱ Ϸ Flush(true) ũ  ٸ.
+        class MappedFile {
+        public:
+            MappedFile();
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            //  ( ) size Ʈ   . size 0̸  ũ 
+            bool Open(const std::string& file_path, uint64_t size = 0);
+            void Close();
+
+            //  ũ  (  ,  ּҴ ٲ  )
+            bool Resize(uint64_t new_size);
+
+            //    û (wait true ũ  Ϸ )
+            bool Flush(bool wait = false);
+
+            bool IsOpen() const { return data_ != nullptr; }
+            char* GetData() const { return data_; }
+            uint64_t GetSize() const { return size_; }
+            const std::string& GetPath() const { return file_path_; }
+
+        private:
+            bool MapView(uint64_t size);
+            void UnmapView();
+
+            std::string file_path_;
+            char* data_;
+            uint64_t size_;
+
+#ifdef _WIN32
+            void* file_handle_;
+            void* mapping_handle_;
+#else
+            int fd_;
+#endif
+        };
+
+    } // namespace Common
+} // namespace NexusCore
@@ -0,0 +1,131 @@
+#include "pch.h"
+#include "MemoryAccountant.h"
+#include "Config.h"
+#include "Protocol.h"
+
+namespace NexusCore {
+    namespace Common {
+
+        MemoryAccountant* MemoryAccountant::instance_ = nullptr;
+        std::once_flag MemoryAccountant::init_flag_;
+
+        MemoryAccountant* MemoryAccountant::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new MemoryAccountant();
+            });
+            return instance_;
+        }
+
+        MemoryAccountant::MemoryAccountant()
+            : soft_limit_(Protocol::Config::MEMORY_SOFT_LIMIT_MB * 1024 * 1024)
+            , hard_limit_(Protocol::Config::MEMORY_HARD_LIMIT_MB * 1024 * 1024) {
+        }
+
+        void MemoryAccountant::Charge(MemoryCategory category, size_t bytes) {
+            usage_[static_cast<size_t>(category)].bytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+        }
+
+        void MemoryAccountant::Release(MemoryCategory category, size_t bytes) {
+            usage_[static_cast<size_t>(category)].bytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+        }
+
+        size_t MemoryAccountant::GetUsage() const {
+            int64_t total = 0;
+            for (const auto& usage : usage_) {
+                total += usage.bytes.load(std::memory_order_relaxed);
+            }
+            return total > 0 ? static_cast<size_t>(total) : 0;
+        }
+
+        size_t MemoryAccountant::GetUsage(MemoryCategory category) const {
+            const int64_t bytes = usage_[static_cast<size_t>(category)].bytes.load(std::memory_order_relaxed);
+            return bytes > 0 ? static_cast<size_t>(bytes) : 0;
+        }
+
+        void MemoryAccountant::SetLimits(size_t soft_limit_bytes, size_t hard_limit_bytes) {
+            soft_limit_ = soft_limit_bytes;
+            hard_limit_ = hard_limit_bytes;
+        }
+
+        void MemoryAccountant::LoadFromConfig() {
+            auto* config = Config::GetInstance();
+            const int soft_mb = config->GetInt("memory.soft_limit_mb", static_cast<int>(soft_limit_ / (1024 * 1024)));
+            const int hard_mb = config->GetInt("memory.hard_limit_mb", static_cast<int>(hard_limit_ / (1024 * 1024)));
+            SetLimits(soft_mb > 0 ? static_cast<size_t>(soft_mb) * 1024 * 1024 : 0,
+                hard_mb > 0 ? static_cast<size_t>(hard_mb) * 1024 * 1024 : 0);
+        }
+
+        MemoryPressure MemoryAccountant::GetPressure() const {
+            const size_t usage = GetUsage();
+            const size_t hard_limit = hard_limit_.load(std::memory_order_relaxed);
+            if (hard_limit != 0 && usage >= hard_limit) {
+                return MemoryPressure::HARD;
+            }
+            const size_t soft_limit = soft_limit_.load(std::memory_order_relaxed);
+            if (soft_limit != 0 && usage >= soft_limit) {
+                return MemoryPressure::SOFT;
+            }
+            return MemoryPressure::NORMAL;
+        }
+
+        bool MemoryAccountant::ShouldShedNotification(size_t recipient_queued_bytes) const {
+            switch (GetPressure()) {
+            case MemoryPressure::HARD:
+                return true;
+            case MemoryPressure::SOFT:
+                return recipient_queued_bytes >= Protocol::Config::MEMORY_SHED_QUEUE_BYTES;
+            default:
+                return false;
+            }
+        }
+
+        const char* MemoryAccountant::GetCategoryName(MemoryCategory category) {
+            switch (category) {
+            case MemoryCategory::SEND_QUEUE: return "send_queue";
+            case MemoryCategory::RECV_BUFFER: return "recv_buffer";
+            case MemoryCategory::REASSEMBLY: return "reassembly";
+            case MemoryCategory::POOL: return "pool";
+            case MemoryCategory::FILE_TRANSFER: return "file_transfer";
+            case MemoryCategory::REPLAY_BUFFER: return "replay_buffer";
+            default: return "unknown";
+            }
+        }
+
+        // ===== MemoryCharge =====
+
+        MemoryCharge::MemoryCharge(MemoryCategory category, size_t bytes) : category_(category) {
+            Resize(bytes);
+        }
+
+        MemoryCharge::~MemoryCharge() {
+            Resize(0);
+        }
+
+        MemoryCharge::MemoryCharge(MemoryCharge&& other) noexcept
+            : category_(other.category_)
+            , bytes_(other.bytes_) {
+            other.bytes_ = 0;
+        }
+
+        MemoryCharge& MemoryCharge::operator=(MemoryCharge&& other) noexcept {
+            if (this != &other) {
+                Resize(0);
+                category_ = other.category_;
+                bytes_ = other.bytes_;
+                other.bytes_ = 0;
+            }
+            return *this;
+        }
+
+        void MemoryCharge::Resize(size_t bytes) {
+            if (bytes > bytes_) {
+                MemoryAccountant::GetInstance()->Charge(category_, bytes - bytes_);
+            }
+            else if (bytes < bytes_) {
+                MemoryAccountant::GetInstance()->Release(category_, bytes_ - bytes);
+            }
+            bytes_ = bytes;
+        }
+
+    } // namespace Common
+} // namespace NexusCore
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Common {
+
+        // 뷮   ޸ 뵵
+        enum class MemoryCategory : uint8_t {
+            SEND_QUEUE = 0, //  ۽ ť ( +  Ŷ,   Ŷ  )
+            RECV_BUFFER,    //   Ǯ (   + Ǯ  )
+            REASSEMBLY,     //      뷮
+            POOL,           //   MemoryPool ü
+            FILE_TRANSFER,  // ε ¿ 
+            REPLAY_BUFFER   // ӿ   ֱ ۽ Ŷ
+        };
+        constexpr size_t MEMORY_CATEGORY_COUNT = 6;
+
+        enum class MemoryPressure : uint8_t {
+            NORMAL = 0,
+            SOFT,       //  ϸ   (α , ε , и  ˸ )
+            HARD        // ̹  ϵ  ( ˸ )
+        };
+
+        // μ ü ޸ 뷮  ѵ
+        // ū ޸𸮸   Charge/Release 뵵 Ʈ ˸, հ踦 ѵ  ܰ
+        // ϸ Ѵ. īʹ 뵵 ĳ   Ἥ ۽ γ ε ʴ´.
+        class MemoryAccountant {
+        public:
+            static MemoryAccountant* GetInstance();
+
+            void Charge(MemoryCategory category, size_t bytes);
+            void Release(MemoryCategory category, size_t bytes);
+
+            size_t GetUsage() const; // ü հ
+            size_t GetUsage(MemoryCategory category) const;
+
+            // 0̸  ѵ 
+            void SetLimits(size_t soft_limit_bytes, size_t hard_limit_bytes);
+            size_t GetSoftLimit() const { return soft_limit_; }
+            size_t GetHardLimit() const { return hard_limit_; }
+            void LoadFromConfig(); // "memory.soft_limit_mb", "memory.hard_limit_mb"
+
+            MemoryPressure GetPressure() const;
+
+            // ܰ  Ǵ
+            bool ShouldRejectLogins() const { return GetPressure() >= MemoryPressure::SOFT; }
+            bool ShouldPauseUploads() const { return GetPressure() >= MemoryPressure::SOFT; }
+            bool ShouldShedNotification(size_t recipient_queued_bytes) const; // Ʈ и ڸ, ϵ 
+
+            static const char* GetCategoryName(MemoryCategory category);
+
+        private:
+            MemoryAccountant();
+            ~MemoryAccountant() = default;
+
+            //  躸    ־ ȣ ִ  
+            struct alignas(64) CategoryUsage {
+                std::atomic<int64_t> bytes{ 0 };
+            };
+
+            CategoryUsage usage_[MEMORY_CATEGORY_COUNT];
+            std::atomic<size_t> soft_limit_;
+            std::atomic<size_t> hard_limit_;
+
+            static MemoryAccountant* instance_;
+            static std::once_flag init_flag_;
+        };
+
+        // ü    ִ  (Ҹ  ڵ ). ũⰡ ٲ Resize ̸ ݿ
+        class MemoryCharge {
+        public:
+            MemoryCharge() = default;
+            MemoryCharge(MemoryCategory category, size_t bytes);
+            ~MemoryCharge();
+
+            MemoryCharge(MemoryCharge&& other) noexcept;
+            MemoryCharge& operator=(MemoryCharge&& other) noexcept;
+            MemoryCharge(const MemoryCharge&) = delete;
+            MemoryCharge& operator=(const MemoryCharge&) = delete;
+
+            void Resize(size_t bytes);
+            size_t GetBytes() const { return bytes_; }
+
+        private:
+            MemoryCategory category_ = MemoryCategory::POOL;
+            size_t bytes_ = 0;
+        };
+
+    } // namespace Common
+} // namespace NexusCore
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <string>
+#include <functional>
+#include <vector>
 
 namespace NexusCore {
     namespace Protocol {
@@ -18,6 +20,13 @@ namespace NexusCore {
                 : packet_id(id), payload_length(len), crc32(checksum) {
             }
         };
+
+        //  ٿε    (PacketHeader ٷ ,  Ʈ )
+        //  Ʈ Ŀ  ϹǷ   crc32 0̸, Ἲ  ؽ÷ ȮѴ.
+        struct FileDownloadChunkHeader {
+            uint64_t download_id;    // ٿε ID (8Ʈ)
+            uint64_t offset;         //    (8Ʈ)
+        };
 #pragma pack(pop)
 
         // Ŷ ID  
@@ -29,6 +38,8 @@ namespace NexusCore {
             constexpr uint16_t LOGOUT_RES = 1004;
             constexpr uint16_t HEARTBEAT_REQ = 1005;
             constexpr uint16_t HEARTBEAT_RES = 1006;
+            constexpr uint16_t RESUME_REQ = 1007; //   ̾ ̱
+            constexpr uint16_t RESUME_RES = 1008;
 
             // ä (2000~)
             constexpr uint16_t ENTER_ROOM_REQ = 2001;
@@ -38,12 +49,17 @@ namespace NexusCore {
             constexpr uint16_t USER_LEFT_ROOM_NTF = 2005;
             constexpr uint16_t ROOM_CHAT_REQ = 2006;
             constexpr uint16_t ROOM_CHAT_NTF = 2007;
+            constexpr uint16_t ROOM_CHAT_BATCH_NTF = 2008; //  ROOM_CHAT_NTF  ˸
 
             //   (3000~)
             constexpr uint16_t FILE_UPLOAD_REQ = 3001;
             constexpr uint16_t FILE_UPLOAD_RES = 3002;
             constexpr uint16_t FILE_CHUNK_SEND = 3003;
             constexpr uint16_t FILE_UPLOAD_COMPLETE_NTF = 3004;
+            constexpr uint16_t FILE_DOWNLOAD_REQ = 3005;
+            constexpr uint16_t FILE_DOWNLOAD_RES = 3006;
+            constexpr uint16_t FILE_DOWNLOAD_DATA = 3007;
+            constexpr uint16_t FILE_DOWNLOAD_COMPLETE_NTF = 3008;
 
             //  (9000~)
             constexpr uint16_t ADMIN_USER_LIST_REQ = 9001;
@@ -52,17 +68,60 @@ namespace NexusCore {
             constexpr uint16_t KICK_USER_RES = 9004;
         }
 
+        //  Ŭ (Ŷ ID õ  뿪)
+        //  ó ۽ ť Ŭ  ξ ū   ƮƮ/ä о ʰ Ѵ.
+        //  ׻ ,  Config::LANE_WEIGHT_*   ó
+        enum class PacketClass : uint8_t {
+            CONTROL = 0, // 1000: α/ƮƮ
+            CHAT,        // 2000
+            BULK,        // 3000:  
+            ADMIN        // 9000
+        };
+        constexpr size_t PACKET_CLASS_COUNT = 4;
+
+        inline PacketClass GetPacketClass(uint16_t packet_id) {
+            switch (packet_id / 1000) {
+            case 1: return PacketClass::CONTROL;
+            case 2: return PacketClass::CHAT;
+            case 9: return PacketClass::ADMIN;
+            default: return PacketClass::BULK; //    뿪   
+            }
+        }
+
+        // ޸𸮰 ڶ   Ǵ ˸ (ĵ  ˸̳  ȸ)
+        inline bool IsSheddableNotify(uint16_t packet_id) {
+            switch (packet_id) {
+            case PacketID::NEW_USER_IN_ROOM_NTF:
+            case PacketID::USER_LEFT_ROOM_NTF:
+            case PacketID::ROOM_CHAT_NTF:
+            case PacketID::ROOM_CHAT_BATCH_NTF:
+                return true;
+            default:
+                return false;
+            }
+        }
+
         //  ڵ
         namespace ErrorCode {
             constexpr int32_t SUCCESS = 0;
             constexpr int32_t INVALID_USER_ID = 1001;
             constexpr int32_t INVALID_PASSWORD = 1002;
             constexpr int32_t USER_ALREADY_LOGGED_IN = 1003;
+            constexpr int32_t SERVER_BUSY = 1004;      // ޸ ѵ   α  
+            constexpr int32_t LOGIN_QUEUED = 1005;     // α ⿭  (  ʰ  ٽ )
+            constexpr int32_t RESUME_NOT_FOUND = 1006; // ū ų  ð 
+            constexpr int32_t RESUME_REPLAY_GAP = 1007; // ģ Ŷ   ̹ з
             constexpr int32_t ROOM_NOT_FOUND = 2001;
             constexpr int32_t ROOM_FULL = 2002;
             constexpr int32_t INVALID_ROOM_PASSWORD = 2003;
             constexpr int32_t FILE_TOO_LARGE = 3001;
             constexpr int32_t INVALID_FILE_FORMAT = 3002;
+            constexpr int32_t FILE_HASH_MISMATCH = 3003;
+            constexpr int32_t FILE_CHUNK_OUT_OF_WINDOW = 3004;
+            constexpr int32_t FILE_NOT_FOUND = 3005;
+            constexpr int32_t INVALID_FILE_RANGE = 3006;
+            constexpr int32_t FILE_VERSION_CHANGED = 3007;
+            constexpr int32_t UPLOAD_NOT_RESUMABLE = 3008;
             constexpr int32_t INSUFFICIENT_PERMISSION = 9001;
         }
 
@@ -74,9 +133,566 @@ namespace NexusCore {
             constexpr size_t RECV_BUFFER_SIZE = 4096;
             constexpr size_t SEND_BUFFER_SIZE = 4096;
             constexpr int32_t MAX_CLIENTS = 1000;
+            constexpr uint32_t SESSION_TABLE_CAPACITY = 262144; //   ̺ ũ (  ̸ Ҵ)
+            constexpr size_t SESSION_USER_MAP_STRIPES = 64;
+            constexpr uint32_t SESSION_HIBERNATE_IDLE_SEC = 60;  // ƮƮ  Ȱ  ۸  ð (0̸ )
+            constexpr uint32_t SESSION_RESUME_GRACE_SEC = 30;    //  α  ӿ  δ ð (0̸ )
+            constexpr size_t SESSION_REPLAY_MAX_PACKETS = 128;   // Ǹ ٽ   ְ  δ ֱ ä 뿪 Ŷ 
+            constexpr size_t SESSION_REPLAY_MAX_BYTES = 32 * 1024;
             constexpr int32_t MAX_ROOMS = 100;
+            constexpr size_t LARGE_ROOM_MAX_PARTICIPANTS = 100000; //    ִ ο
             constexpr uint64_t MAX_FILE_SIZE = 100 * 1024 * 1024; // 100MB
+            constexpr uint32_t UPLOAD_CHUNK_SIZE = 60 * 1024;     // FileUploadResponse.chunk_size ˷ִ ûũ ũ
+            constexpr uint32_t UPLOAD_IDLE_TIMEOUT_SEC = 600;     // ûũ ̸ŭ   ε 
+            constexpr uint32_t DOWNLOAD_CHUNK_SIZE = 60 * 1024;   // Ӵ  Ʈ (payload_length 16Ʈ ѵ )
+            constexpr uint32_t DOWNLOAD_PIPELINE_DEPTH = 4;       //  ۽ ť ̸ ÷  
+            constexpr uint32_t CONTENT_STORE_GC_GRACE_SEC = 3600; //       ð
+            constexpr uint64_t HISTORY_SEGMENT_SIZE = 1024 * 1024; // ä  ׸Ʈ  ũ
+            constexpr size_t HISTORY_MAX_SEGMENTS = 8;            // 渶  ׸Ʈ 
+            constexpr uint32_t HISTORY_FLUSH_INTERVAL_MS = 20;    // ׷ Ŀ 
+            constexpr uint32_t HISTORY_REPLAY_DEFAULT = 50;       //   ⺻  ֱ ޽ 
+            constexpr uint32_t HISTORY_REPLAY_MAX = 200;
+            constexpr uint32_t CHAT_BATCH_WINDOW_MS = 10;         // ġ   ˸  ð
+            constexpr uint32_t CHAT_BATCH_MAX_MESSAGES = 32;      // ̸ŭ ̸ ð  
+            constexpr size_t CHAT_BATCH_MAX_BYTES = 16 * 1024;    // ġ ̷ε ִ ũ
+            constexpr uint32_t LANE_WEIGHT_CHAT = 8;              //       (: ۾ , ۽: x SEND_LANE_QUANTUM Ʈ)
+            constexpr uint32_t LANE_WEIGHT_ADMIN = 2;
+            constexpr uint32_t LANE_WEIGHT_BULK = 1;
+            constexpr uint32_t SEND_LANE_QUANTUM = 16 * 1024;
+            constexpr uint32_t RATE_LIMIT_SESSION_PPS = 300;      //  ü ʴ Ŷ (  )
+            constexpr uint32_t RATE_LIMIT_SESSION_BURST = 600;
+            constexpr uint32_t RATE_LIMIT_CONTROL_PPS = 20;       //  
+            constexpr uint32_t RATE_LIMIT_CONTROL_BURST = 40;
+            constexpr uint32_t RATE_LIMIT_CHAT_PPS = 20;          //    
+            constexpr uint32_t RATE_LIMIT_CHAT_BURST = 40;
+            constexpr uint32_t RATE_LIMIT_BULK_PPS = 250;         // 60KB ûũ   15MB/s
+            constexpr uint32_t RATE_LIMIT_BULK_BURST = 64;
+            constexpr uint32_t RATE_LIMIT_ADMIN_PPS = 10;
+            constexpr uint32_t RATE_LIMIT_ADMIN_BURST = 20;
+            constexpr uint64_t UPLOAD_DISK_BYTES_PER_SEC = 64 * 1024 * 1024; //  ε尡   ũ  뿪
+            constexpr uint32_t UPLOAD_SHAPING_BURST_MS = 100;    // ̸ŭ ռ   
+            constexpr size_t MEMORY_SOFT_LIMIT_MB = 1024;        //   α , ε 
+            constexpr size_t MEMORY_HARD_LIMIT_MB = 1536;        //  ˸ 
+            constexpr size_t MEMORY_SHED_QUEUE_BYTES = 64 * 1024; // Ʈ ѵ ۽ ť ̸ŭ и  ˸ 
+            constexpr uint32_t MEMORY_UPLOAD_PAUSE_MS = 200;     // Ʈ ѵ ûũ δ  ߴ ð
+            constexpr uint32_t LOGIN_MAX_CONCURRENT = 32;        // ÿ óϴ α 
+            constexpr uint32_t LOGIN_QUEUE_CAPACITY = 65536;     //  SERVER_BUSY 
+            constexpr uint32_t ACCEPT_LOAD_LOW = 64;             // Ŀ и ۾ ̺    
+            constexpr uint32_t ACCEPT_LOAD_HIGH = 1024;          //  ̸̻ ִ 
+            constexpr uint32_t ACCEPT_MAX_DELAY_MS = 100;
+        }
+
+        // protobuf ̾   (Ʒ ڵ Բ )
+        // .proto  ޽  protocols.md  Ʈ   д´
+        namespace WireFormat {
+            constexpr uint8_t VARINT = 0;
+            constexpr uint8_t LENGTH_DELIMITED = 2;
+
+            inline size_t GetVarintSize(uint64_t value) {
+                size_t size = 1;
+                for (; value >= 0x80; value >>= 7) {
+                    ++size;
+                }
+                return size;
+            }
+
+            inline void AppendVarint(std::string& out, uint64_t value) {
+                while (value >= 0x80) {
+                    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                    value >>= 7;
+                }
+                out.push_back(static_cast<char>(value));
+            }
+
+            inline bool ReadVarint(const char* data, size_t size, size_t& pos, uint64_t& out_value) {
+                out_value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    if (pos >= size) {
+                        return false;
+                    }
+                    const uint8_t byte = static_cast<uint8_t>(data[pos++]);
+                    out_value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            inline void AppendTag(std::string& out, uint32_t field, uint8_t wire_type) {
+                AppendVarint(out, (static_cast<uint64_t>(field) << 3) | wire_type);
+            }
+
+            // ⺻(0,  ڿ) ʵ  (protobuf ).  int32 10Ʈ 2 
+            inline void AppendVarintField(std::string& out, uint32_t field, uint64_t value) {
+                if (value != 0) {
+                    AppendTag(out, field, VARINT);
+                    AppendVarint(out, value);
+                }
+            }
+
+            inline void AppendInt32Field(std::string& out, uint32_t field, int32_t value) {
+                AppendVarintField(out, field, static_cast<uint64_t>(static_cast<int64_t>(value)));
+            }
+
+            inline void AppendBytesField(std::string& out, uint32_t field, const char* data, size_t size) {
+                if (size != 0) {
+                    AppendTag(out, field, LENGTH_DELIMITED);
+                    AppendVarint(out, size);
+                    out.append(data, size);
+                }
+            }
+
+            inline void AppendBytesField(std::string& out, uint32_t field, const std::string& value) {
+                AppendBytesField(out, field, value.data(), value.size());
+            }
+
+            //  ޽  ־ ׸  (ݺ ʵ  ٲ ʰ)
+            inline void AppendMessageField(std::string& out, uint32_t field, const std::string& message) {
+                AppendTag(out, field, LENGTH_DELIMITED);
+                AppendVarint(out, message.size());
+                out.append(message);
+            }
+
+            // ʵ帶 visitor(ʵ ȣ, , , ) ȣ. varint ʵ Ͱ nullptr,
+            // length-delimited ʵ  .  ߸ưų  ʴ ̾ Ÿ̸ false
+            inline bool ForEachField(const char* payload, size_t size,
+                const std::function<void(uint32_t, uint64_t, const char*, size_t)>& visitor) {
+                size_t pos = 0;
+                while (pos < size) {
+                    uint64_t tag = 0;
+                    uint64_t value = 0;
+                    if (!ReadVarint(payload, size, pos, tag) || !ReadVarint(payload, size, pos, value)) {
+                        return false;
+                    }
+
+                    const uint32_t field = static_cast<uint32_t>(tag >> 3);
+                    switch (tag & 0x07) {
+                    case VARINT:
+                        visitor(field, value, nullptr, 0);
+                        break;
+                    case LENGTH_DELIMITED:
+                        if (value > size - pos) {
+                            return false;
+                        }
+                        visitor(field, value, payload + pos, static_cast<size_t>(value));
+                        pos += static_cast<size_t>(value);
+                        break;
+                    default:
+                        return false;
+                    }
+                }
+                return true;
+            }
         }
 
+        // ROOM_CHAT_BATCH_NTF ̷ε ڵ/ڵ ( Ŭ̾Ʈ Բ )
+        // RoomChatBatchNotify { repeated RoomChatNotify notifies = 1; }   Ʈ :
+        // ȭ RoomChatNotify ʵ ±(0x0A) + varint ̸ ٿ ̾ δ.
+        class ChatBatchCodec {
+        public:
+            static constexpr uint8_t FIELD_TAG = 0x0A; // field 1, length-delimited
+
+            // ׸ ϳ ٿ  þ Ʈ 
+            static size_t GetEncodedSize(size_t notify_size) {
+                return 1 + WireFormat::GetVarintSize(notify_size) + notify_size;
+            }
+
+            static void AppendEntry(std::string& batch_payload, const char* notify_payload, size_t notify_size) {
+                batch_payload.push_back(static_cast<char>(FIELD_TAG));
+                WireFormat::AppendVarint(batch_payload, notify_size);
+                batch_payload.append(notify_payload, notify_size);
+            }
+
+            // ׸񸶴 visitor(RoomChatNotify ̷ε, ũ) ȣ.  ߸Ǹ false
+            static bool ForEachEntry(const char* batch_payload, size_t size,
+                const std::function<void(const char*, size_t)>& visitor) {
+                size_t pos = 0;
+                while (pos < size) {
+                    if (static_cast<uint8_t>(batch_payload[pos++]) != FIELD_TAG) {
+                        return false;
+                    }
+
+                    uint64_t length = 0;
+                    if (!WireFormat::ReadVarint(batch_payload, size, pos, length) || length > size - pos) {
+                        return false;
+                    }
+                    visitor(batch_payload + pos, static_cast<size_t>(length));
+                    pos += static_cast<size_t>(length);
+                }
+                return true;
+            }
+        };
+
+        // LoginRequest ڵ
+        class LoginRequestCodec {
+        public:
+            // 𸣴 ʵ ǳʶ.  ߸Ǹ false ( user_id ڵ鷯 INVALID_USER_ID )
+            static bool Decode(const char* payload, size_t size, std::string& out_user_id, std::string& out_password) {
+                out_user_id.clear();
+                out_password.clear();
+
+                return WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t, const char* data, size_t length) {
+                        if (field == 1 && data) {
+                            out_user_id.assign(data, length);
+                        }
+                        else if (field == 2 && data) {
+                            out_password.assign(data, length);
+                        }
+                    });
+            }
+        };
+
+        // LoginResponse ȭ (ڵ鷯 ġ ʰ IO 忡 ٷ   )
+        class LoginResponseCodec {
+        public:
+            static std::string Encode(bool success, uint64_t session_id, const std::string& message, int32_t error_code,
+                uint32_t queue_position = 0, const std::string& resume_token = "") {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 2, session_id);
+                WireFormat::AppendBytesField(payload, 3, message);
+                WireFormat::AppendInt32Field(payload, 4, error_code);
+                WireFormat::AppendVarintField(payload, 5, queue_position);
+                WireFormat::AppendBytesField(payload, 6, resume_token);
+                return payload;
+            }
+        };
+
+        // LogoutResponse ȭ
+        class LogoutCodec {
+        public:
+            static std::string EncodeResponse(bool success, const std::string& message) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendBytesField(payload, 2, message);
+                return payload;
+            }
+        };
+
+        // ResumeRequest ڵ / ResumeResponse ȭ ( α ڵ鷯 ġ )
+        class SessionResumeCodec {
+        public:
+            // 𸣴 ʵ ǳʶ.  ߸ưų ū  false
+            static bool DecodeRequest(const char* payload, size_t size, std::string& out_token, uint64_t& out_last_sequence) {
+                out_token.clear();
+                out_last_sequence = 0;
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (field == 1 && data) {
+                            out_token.assign(data, length);
+                        }
+                        else if (field == 2 && !data) {
+                            out_last_sequence = value;
+                        }
+                    });
+                return valid && !out_token.empty();
+            }
+
+            static std::string EncodeResponse(bool success, uint64_t session_id, const std::string& message, int32_t error_code,
+                uint32_t replay_count) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 2, session_id);
+                WireFormat::AppendBytesField(payload, 3, message);
+                WireFormat::AppendInt32Field(payload, 4, error_code);
+                WireFormat::AppendVarintField(payload, 5, replay_count);
+                return payload;
+            }
+        };
+
+        //  /ä û ڵ /˸ ȭ (EnterRoom*, RoomChat*, NewUserInRoomNotify, UserLeftRoomNotify)
+        class RoomCodec {
+        public:
+            static constexpr int32_t MESSAGE_NORMAL = 0;
+            static constexpr int32_t MESSAGE_WHISPER = 1;
+            static constexpr int32_t MESSAGE_NOTICE = 2;
+
+            struct EnterRequest {
+                uint32_t room_id = 0;
+                std::string password;
+                uint32_t history_count = 0; // 0̸  ⺻
+            };
+
+            struct ChatRequest {
+                std::string message;
+                int32_t message_type = MESSAGE_NORMAL;
+                std::string target_user;
+            };
+
+            // 𸣴 ʵ ǳʶ.  ߸ưų  ID  false
+            static bool DecodeEnterRequest(const char* payload, size_t size, EnterRequest& out_request) {
+                out_request = EnterRequest();
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (field == 1 && !data) {
+                            out_request.room_id = static_cast<uint32_t>(value);
+                        }
+                        else if (field == 2 && data) {
+                            out_request.password.assign(data, length);
+                        }
+                        else if (field == 3 && !data) {
+                            out_request.history_count = static_cast<uint32_t>(value);
+                        }
+                    });
+                return valid && out_request.room_id != 0;
+            }
+
+            // room_id 0̸  ִ .  ߸Ǹ false
+            static bool DecodeLeaveRequest(const char* payload, size_t size, uint32_t& out_room_id) {
+                out_room_id = 0;
+
+                return WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t) {
+                        if (field == 1 && !data) {
+                            out_room_id = static_cast<uint32_t>(value);
+                        }
+                    });
+            }
+
+            //  ߸ưų ޽  false
+            static bool DecodeChatRequest(const char* payload, size_t size, ChatRequest& out_request) {
+                out_request = ChatRequest();
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (field == 1 && data) {
+                            out_request.message.assign(data, length);
+                        }
+                        else if (field == 2 && !data) {
+                            out_request.message_type = static_cast<int32_t>(value);
+                        }
+                        else if (field == 3 && data) {
+                            out_request.target_user.assign(data, length);
+                        }
+                    });
+                return valid && !out_request.message.empty();
+            }
+
+            static std::string EncodeChatNotify(const std::string& sender_id, const std::string& message,
+                int64_t timestamp, int32_t message_type) {
+                std::string payload;
+                WireFormat::AppendBytesField(payload, 1, sender_id);
+                WireFormat::AppendBytesField(payload, 2, message);
+                WireFormat::AppendVarintField(payload, 3, static_cast<uint64_t>(timestamp));
+                WireFormat::AppendInt32Field(payload, 4, message_type);
+                return payload;
+            }
+
+            static std::string EncodeUserInfo(const std::string& user_id, int64_t join_time) {
+                std::string payload;
+                WireFormat::AppendBytesField(payload, 1, user_id);
+                WireFormat::AppendVarintField(payload, 2, static_cast<uint64_t>(join_time));
+                return payload;
+            }
+
+            // user_infos EncodeUserInfo, recent_notifies EncodeChatNotify  ( )
+            static std::string EncodeEnterResponse(bool success, uint32_t room_id, const std::string& room_title,
+                const std::vector<std::string>& user_infos, const std::string& message,
+                const std::vector<std::string>& recent_notifies, uint64_t last_sequence) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 2, room_id);
+                WireFormat::AppendBytesField(payload, 3, room_title);
+                for (const std::string& user_info : user_infos) {
+                    WireFormat::AppendMessageField(payload, 4, user_info);
+                }
+                WireFormat::AppendBytesField(payload, 5, message);
+                for (const std::string& notify : recent_notifies) {
+                    WireFormat::AppendMessageField(payload, 6, notify);
+                }
+                WireFormat::AppendVarintField(payload, 7, last_sequence);
+                return payload;
+            }
+
+            static std::string EncodeNewUserNotify(uint32_t room_id, const std::string& user_id, int64_t join_time) {
+                std::string payload;
+                WireFormat::AppendMessageField(payload, 1, EncodeUserInfo(user_id, join_time));
+                WireFormat::AppendVarintField(payload, 2, room_id);
+                return payload;
+            }
+
+            static std::string EncodeUserLeftNotify(uint32_t room_id, const std::string& user_id, int64_t leave_time) {
+                std::string payload;
+                WireFormat::AppendBytesField(payload, 1, user_id);
+                WireFormat::AppendVarintField(payload, 2, room_id);
+                WireFormat::AppendVarintField(payload, 3, static_cast<uint64_t>(leave_time));
+                return payload;
+            }
+
+            // ݺ ʵ ׸ ϳ ϴ Ʈ  ( ũ ѵ )
+            static size_t GetMessageFieldSize(uint32_t field, size_t size) {
+                return WireFormat::GetVarintSize((static_cast<uint64_t>(field) << 3) | WireFormat::LENGTH_DELIMITED) +
+                    WireFormat::GetVarintSize(size) + size;
+            }
+
+        };
+
+        // FileUploadRequest, FileChunk ڵ / FileUploadResponse, FileUploadCompleteNotify ȭ
+        class FileUploadCodec {
+        public:
+            struct Request {
+                std::string file_name;
+                uint64_t file_size = 0;
+                std::string file_hash;
+                std::string target_user;
+                uint64_t resume_upload_id = 0;
+            };
+
+            // chunk_data ڵ ̷ε带 Ŵ
+            struct Chunk {
+                uint64_t upload_id = 0;
+                uint32_t chunk_index = 0;
+                const char* chunk_data = nullptr;
+                size_t chunk_size = 0;
+            };
+
+            // 𸣴 ʵ ǳʶ.  ߸ưų  εε  ̸  false
+            static bool DecodeRequest(const char* payload, size_t size, Request& out_request) {
+                out_request = Request();
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (data) {
+                            switch (field) {
+                            case 1: out_request.file_name.assign(data, length); break;
+                            case 3: out_request.file_hash.assign(data, length); break;
+                            case 4: out_request.target_user.assign(data, length); break;
+                            default: break;
+                            }
+                            return;
+                        }
+                        if (field == 2) {
+                            out_request.file_size = value;
+                        }
+                        else if (field == 5) {
+                            out_request.resume_upload_id = value;
+                        }
+                    });
+                return valid && (out_request.resume_upload_id != 0 || !out_request.file_name.empty());
+            }
+
+            // chunk_size ʵ尡 ִµ chunk_data ̿ ٸ ߸ ûũ 
+            static bool DecodeChunk(const char* payload, size_t size, Chunk& out_chunk) {
+                out_chunk = Chunk();
+                uint64_t declared_size = 0;
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (field == 1 && !data) {
+                            out_chunk.upload_id = value;
+                        }
+                        else if (field == 2 && !data) {
+                            out_chunk.chunk_index = static_cast<uint32_t>(value);
+                        }
+                        else if (field == 3 && !data) {
+                            declared_size = value;
+                        }
+                        else if (field == 4 && data) {
+                            out_chunk.chunk_data = data;
+                            out_chunk.chunk_size = length;
+                        }
+                    });
+                return valid && out_chunk.upload_id != 0 && out_chunk.chunk_data &&
+                    (declared_size == 0 || declared_size == out_chunk.chunk_size);
+            }
+
+            static std::string EncodeChunkRange(uint32_t first, uint32_t count) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, first);
+                WireFormat::AppendVarintField(payload, 2, count);
+                return payload;
+            }
+
+            // missing_chunks EncodeChunkRange 
+            static std::string EncodeResponse(bool success, uint64_t upload_id, uint32_t chunk_size, const std::string& message,
+                uint32_t reorder_window, bool resumed, const std::vector<std::string>& missing_chunks,
+                bool already_stored, const std::string& file_path) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 2, upload_id);
+                WireFormat::AppendVarintField(payload, 3, chunk_size);
+                WireFormat::AppendBytesField(payload, 4, message);
+                WireFormat::AppendVarintField(payload, 5, reorder_window);
+                WireFormat::AppendVarintField(payload, 6, resumed ? 1 : 0);
+                for (const std::string& range : missing_chunks) {
+                    WireFormat::AppendMessageField(payload, 7, range);
+                }
+                WireFormat::AppendVarintField(payload, 8, already_stored ? 1 : 0);
+                WireFormat::AppendBytesField(payload, 9, file_path);
+                return payload;
+            }
+
+            static std::string EncodeCompleteNotify(uint64_t upload_id, bool success, const std::string& file_path,
+                const std::string& message) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, upload_id);
+                WireFormat::AppendVarintField(payload, 2, success ? 1 : 0);
+                WireFormat::AppendBytesField(payload, 3, file_path);
+                WireFormat::AppendBytesField(payload, 4, message);
+                return payload;
+            }
+        };
+
+        // FileDownloadRequest ڵ / FileDownloadResponse, FileDownloadCompleteNotify ȭ
+        class FileDownloadCodec {
+        public:
+            struct Request {
+                std::string file_path;
+                uint64_t offset = 0;
+                uint64_t length = 0;
+                uint64_t if_version = 0;
+            };
+
+            // 𸣴 ʵ ǳʶ.  ߸ưų ΰ  false
+            static bool DecodeRequest(const char* payload, size_t size, Request& out_request) {
+                out_request = Request();
+
+                const bool valid = WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t value, const char* data, size_t length) {
+                        if (data) {
+                            if (field == 1) {
+                                out_request.file_path.assign(data, length);
+                            }
+                            return;
+                        }
+                        switch (field) {
+                        case 2: out_request.offset = value; break;
+                        case 3: out_request.length = value; break;
+                        case 4: out_request.if_version = value; break;
+                        default: break;
+                        }
+                    });
+                return valid && !out_request.file_path.empty();
+            }
+
+            static std::string EncodeResponse(bool success, uint64_t download_id, uint64_t file_size, uint64_t offset,
+                uint64_t length, uint64_t file_version, int32_t error_code, const std::string& message) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 2, download_id);
+                WireFormat::AppendVarintField(payload, 3, file_size);
+                WireFormat::AppendVarintField(payload, 4, offset);
+                WireFormat::AppendVarintField(payload, 5, length);
+                WireFormat::AppendVarintField(payload, 6, file_version);
+                WireFormat::AppendInt32Field(payload, 7, error_code);
+                WireFormat::AppendBytesField(payload, 8, message);
+                return payload;
+            }
+
+            static std::string EncodeCompleteNotify(uint64_t download_id, bool success, uint64_t bytes_sent,
+                const std::string& message) {
+                std::string payload;
+                WireFormat::AppendVarintField(payload, 1, download_id);
+                WireFormat::AppendVarintField(payload, 2, success ? 1 : 0);
+                WireFormat::AppendVarintField(payload, 3, bytes_sent);
+                WireFormat::AppendBytesField(payload, 4, message);
+                return payload;
+            }
+        };
+
     } // namespace Protocol
 } // namespace NexusCore
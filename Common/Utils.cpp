@@ -1,2 +1,93 @@
 #include "pch.h"
 #include "Utils.h"
+#include "HashContext.h"
+
+#include <array>
+#include <random>
+
+#ifdef _WIN32
+#include <bcrypt.h>
+#pragma comment(lib, "bcrypt.lib")
+#endif
+
+namespace NexusCore {
+    namespace Common {
+        namespace Utils {
+
+            namespace {
+
+                // slice-by-8 ̺ (0 Ʈ  ǥ CRC-32 ̺, k kƮ ڷ  )
+                constexpr std::array<std::array<uint32_t, 256>, 8> MakeCrc32Tables() {
+                    std::array<std::array<uint32_t, 256>, 8> tables{};
+                    for (uint32_t i = 0; i < 256; ++i) {
+                        uint32_t crc = i;
+                        for (int bit = 0; bit < 8; ++bit) {
+                            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+                        }
+                        tables[0][i] = crc;
+                    }
+                    for (uint32_t i = 0; i < 256; ++i) {
+                        for (size_t k = 1; k < 8; ++k) {
+                            tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+                        }
+                    }
+                    return tables;
+                }
+
+                constexpr std::array<std::array<uint32_t, 256>, 8> CRC32_TABLES = MakeCrc32Tables();
+
+            } // namespace
+
+            //   ؽô  ؽƮ  Ŀ 
+            std::string CryptoUtils::CalculateMD5(const char* data, size_t size) {
+                MD5Context context;
+                context.Update(data, size);
+                return context.FinalizeHex();
+            }
+
+            std::string CryptoUtils::CalculateSHA256(const char* data, size_t size) {
+                SHA256Context context;
+                context.Update(data, size);
+                return context.FinalizeHex();
+            }
+
+            // Ŷ   ۽    θǷ 8Ʈ ó
+            uint32_t CryptoUtils::CalculateCRC32(const char* data, size_t size) {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+                uint32_t crc = 0xFFFFFFFFu;
+
+                while (size >= 8) {
+                    const uint32_t low = crc ^ (uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) |
+                        (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24));
+                    crc = CRC32_TABLES[7][low & 0xFF] ^ CRC32_TABLES[6][(low >> 8) & 0xFF] ^
+                        CRC32_TABLES[5][(low >> 16) & 0xFF] ^ CRC32_TABLES[4][low >> 24] ^
+                        CRC32_TABLES[3][bytes[4]] ^ CRC32_TABLES[2][bytes[5]] ^
+                        CRC32_TABLES[1][bytes[6]] ^ CRC32_TABLES[0][bytes[7]];
+                    bytes += 8;
+                    size -= 8;
+                }
+                while (size-- > 0) {
+                    crc = (crc >> 8) ^ CRC32_TABLES[0][(crc ^ *bytes++) & 0xFF];
+                }
+                return ~crc;
+            }
+
+            //  ū Ƿ OS  ⸦ 
+            std::vector<char> CryptoUtils::GenerateRandomBytes(size_t length) {
+                std::vector<char> bytes(length);
+#ifdef _WIN32
+                if (length > 0 && BCRYPT_SUCCESS(BCryptGenRandom(nullptr, reinterpret_cast<PUCHAR>(bytes.data()),
+                    static_cast<ULONG>(length), BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+                    return bytes;
+                }
+#endif
+                std::random_device device;
+                for (char& byte : bytes) {
+                    byte = static_cast<char>(device() & 0xFF);
+                }
+                return bytes;
+            }
+
+        } // namespace Utils
+    } // namespace Common
+} // namespace NexusCore
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "Actor.h"
+#include "WorkerExecutor.h"
+#include "Statistics.h"
+
+#include <thread>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr size_t DRAIN_BUDGET = 64; //   ࿡ ó ִ ޽ 
+
+            thread_local const Actor* current_actor = nullptr;
+        }
+
+        // ===== ActorMailbox =====
+
+        ActorMailbox::ActorMailbox()
+            : head_(&stub_)
+            , tail_(&stub_) {
+        }
+
+        ActorMailbox::~ActorMailbox() {
+            Message ignored;
+            while (Pop(ignored)) {
+            }
+        }
+
+        void ActorMailbox::PushNode(Node* node) {
+            node->next.store(nullptr, std::memory_order_relaxed);
+            Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+        }
+
+        void ActorMailbox::Push(Message message) {
+            Node* node = new Node();
+            node->message = std::move(message);
+            PushNode(node);
+        }
+
+        bool ActorMailbox::Pop(Message& out) {
+            Node* tail = tail_;
+            Node* next = tail->next.load(std::memory_order_acquire);
+
+            if (tail == &stub_) {
+                if (!next) {
+                    return false;
+                }
+                tail_ = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (!next) {
+                // tail  : ڰ  ̸  ٽ õ
+                if (tail != head_.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                PushNode(&stub_);
+                next = tail->next.load(std::memory_order_acquire);
+                if (!next) {
+                    return false;
+                }
+            }
+
+            tail_ = next;
+            out = std::move(tail->message);
+            delete tail;
+            return true;
+        }
+
+        // ===== Actor =====
+
+        Actor::Actor(size_t home_worker)
+            : home_worker_(home_worker) {
+        }
+
+        Actor::~Actor() {
+            //  ̰ų  ó     (is_draining_  о 翹 ġ )
+            while (!IsCurrent() && (is_draining_.load() || is_scheduled_.load())) {
+                std::this_thread::yield();
+            }
+        }
+
+        bool Actor::IsCurrent() const {
+            return current_actor == this;
+        }
+
+        bool Actor::IsInsideActor() {
+            return current_actor != nullptr;
+        }
+
+        bool Actor::IsOnHomeWorker() const {
+            const int current = WorkerExecutor::GetCurrentWorkerIndex();
+            const size_t worker_count = WorkerExecutor::GetInstance()->GetWorkerCount();
+            return current >= 0 && worker_count > 0 && static_cast<size_t>(current) == home_worker_ % worker_count;
+        }
+
+        void Actor::RunInline(const Message& message) {
+            //  Ŀ ̹Ƿ ٸ  Drain   .  Drain ߿  Ϲڽ  
+            is_draining_.store(true);
+            const Actor* previous = current_actor;
+            current_actor = this;
+
+            Message pending;
+            size_t processed = 0;
+            while (mailbox_.Pop(pending)) {
+                --pending_count_;
+                pending();
+                pending = nullptr;
+                ++processed;
+            }
+            message();
+            processed_count_ += processed + 1;
+
+            current_actor = previous;
+            is_draining_.store(false);
+            STATS_INCREMENT("actor.inline_asks");
+        }
+
+        void Actor::Tell(Message message) {
+            ++pending_count_;
+            mailbox_.Push(std::move(message));
+            Schedule();
+        }
+
+        void Actor::Schedule() {
+            if (!is_scheduled_.exchange(true)) {
+                WorkerExecutor::GetInstance()->Post(home_worker_, [this]() { Drain(); });
+            }
+        }
+
+        void Actor::Drain() {
+            is_draining_.store(true);
+            const Actor* previous = current_actor; // Ⱑ  ־ ȣ 忡 ٷ Ǵ  
+            current_actor = this;
+
+            Message message;
+            size_t processed = 0;
+            while (processed < DRAIN_BUDGET && mailbox_.Pop(message)) {
+                --pending_count_;
+                message();
+                message = nullptr;
+                ++processed;
+            }
+            processed_count_ += processed;
+
+            current_actor = previous;
+
+            //     ޽  ٽ 
+            // (Tell pending_count_  øǷ   ޽ ġ )
+            is_scheduled_.store(false);
+            if (pending_count_.load() > 0) {
+                if (processed == DRAIN_BUDGET) {
+                    STATS_INCREMENT("actor.yields");
+                }
+                Schedule();
+            }
+            is_draining_.store(false); //  ڷδ   
+        }
+
+    } // namespace Core
+} // namespace NexusCore
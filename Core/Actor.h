@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+namespace NexusCore {
+    namespace Core {
+
+        //    / Һ ť (Vyukov   ť)
+        // Push  忡, Pop    忡 ȣѴ.
+        class ActorMailbox {
+        public:
+            using Message = std::function<void()>;
+
+            ActorMailbox();
+            ~ActorMailbox();
+
+            ActorMailbox(const ActorMailbox&) = delete;
+            ActorMailbox& operator=(const ActorMailbox&) = delete;
+
+            void Push(Message message);
+
+            //  ޽ out ű. ų ڰ  ̸ false
+            bool Pop(Message& out);
+
+        private:
+            struct Node {
+                std::atomic<Node*> next{ nullptr };
+                Message message;
+            };
+
+            void PushNode(Node* node);
+
+            alignas(64) std::atomic<Node*> head_; //  
+            alignas(64) Node* tail_;              // Һ 
+            Node stub_;
+        };
+
+        // : Ϲڽ  ޽    Ŀ  ó
+        // ޽   Ŀ   ǰ, 길ŭ ó   ޽ 
+        // ٽ   Ŀ ٸ ۾ ʸ ѱ (̹ó 纸).
+        //  ´ ޽ ȿ ٷǷ  ʿ .
+        class Actor {
+        public:
+            using Message = ActorMailbox::Message;
+
+            explicit Actor(size_t home_worker);
+            virtual ~Actor(); //  ó   ٸ
+
+            Actor(const Actor&) = delete;
+            Actor& operator=(const Actor&) = delete;
+
+            // ޽  (ٸ )
+            void Tell(Message message);
+
+            // ޽   ٸ.  ȿ ȣϸ ٷ .
+            //  Ŀ ȣϸ ٸ  Ϲڽ ó 尡 Ƿ, и ޽
+            //  ڸ  ó  Ѵ ( ). ٸ Ŀ Ƿ   ʿ  
+            // ٸ  ޽ ȿ ٸ Ŀ Ϳ Askϸ  ȴ: 밡 Ųٷ ʿ Askϰų
+            //  Ŀ  Ŀ ٸ  . ͳ Tell  䵵 Tell ޴´
+            template<typename Func>
+            auto Ask(Func func) -> decltype(func()) {
+                using Result = decltype(func());
+                if (IsCurrent()) {
+                    return func();
+                }
+
+                if (IsOnHomeWorker()) {
+                    if constexpr (std::is_void_v<Result>) {
+                        RunInline([&func]() { func(); });
+                        return;
+                    }
+                    else {
+                        std::optional<Result> result;
+                        RunInline([&func, &result]() { result.emplace(func()); });
+                        return std::move(*result);
+                    }
+                }
+
+                assert(!IsInsideActor() && "blocking Ask from inside another actor can deadlock; use Tell");
+
+                std::promise<Result> promise;
+                auto future = promise.get_future();
+                Tell([&promise, &func]() {
+                    if constexpr (std::is_void_v<Result>) {
+                        func();
+                        promise.set_value();
+                    }
+                    else {
+                        promise.set_value(func());
+                    }
+                });
+                return future.get();
+            }
+
+            //   尡   ޽ ó 
+            bool IsCurrent() const;
+            static bool IsInsideActor(); //   尡  ͵ ޽ ó 
+            bool IsOnHomeWorker() const; //  Ŀ  (  ó ⼭ Ͼ)
+
+            size_t GetHomeWorker() const { return home_worker_; }
+            size_t GetPendingCount() const { return pending_count_; }
+            uint64_t GetProcessedCount() const { return processed_count_; }
+
+        private:
+            void Schedule();
+            void Drain();
+            void RunInline(const Message& message); //  Ŀ: и ޽ ó  message 
+
+            ActorMailbox mailbox_;
+            size_t home_worker_;
+            std::atomic<size_t> pending_count_{ 0 };
+            std::atomic<bool> is_scheduled_{ false };
+            std::atomic<bool> is_draining_{ false };
+            std::atomic<uint64_t> processed_count_{ 0 };
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,675 @@
+#include "pch.h"
+#include "ChatHistory.h"
+#include "Statistics.h"
+
+#include <cstring>
+#include <chrono>
+#include <filesystem>
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr uint32_t SEGMENT_MAGIC = 0x4843584E; // "NXCH"
+            constexpr uint32_t SEGMENT_VERSION = 1;
+            constexpr uint32_t TRAILER_MAGIC = 0x444E4524; // "$END"
+            constexpr uint64_t TRAILER_SIZE = 8;
+
+            uint64_t AlignRecord(uint64_t size) {
+                return (size + 7) & ~static_cast<uint64_t>(7);
+            }
+
+            int64_t GetUnixTime() {
+                return std::chrono::duration_cast<std::chrono::seconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+        }
+
+#pragma pack(push, 1)
+        struct ChatHistoryLog::SegmentHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t room_id;
+            uint32_t reserved0;
+            uint64_t segment_no;
+            uint64_t first_sequence; // 0̸     ׸Ʈ
+            int64_t created_at;
+            uint8_t reserved[24];
+        };
+
+        // ڵ: RecordHeader | sender | message | е | trailer { record_size, TRAILER_MAGIC }
+        // record_size       (0̸ ĿԵ  )
+        // trailer п  Ųٷ ֱ  ã  ִ.
+        struct ChatHistoryLog::RecordHeader {
+            uint32_t record_size;
+            uint16_t sender_length;
+            uint16_t reserved;
+            uint32_t message_length;
+            int32_t message_type;
+            uint64_t sequence;
+            int64_t timestamp;
+        };
+#pragma pack(pop)
+
+        ChatHistoryLog::ChatHistoryLog(const std::string& directory, uint32_t room_id, const Options& options)
+            : directory_(directory)
+            , room_id_(room_id)
+            , options_(options)
+            , last_sequence_(0)
+            , next_segment_no_(1)
+            , is_dirty_(false) {
+            InitializeSRWLock(&log_lock_);
+        }
+
+        ChatHistoryLog::~ChatHistoryLog() {
+            // ڰ      쿡 и ϰ  ׸Ʈ 
+            FlushPending();
+            RemoveRetiredSegments();
+        }
+
+        std::unique_ptr<ChatHistoryLog> ChatHistoryLog::Open(const std::string& directory, uint32_t room_id,
+            const Options& options) {
+            static_assert(sizeof(SegmentHeader) == 64, "segment header must be 64 bytes");
+            static_assert(sizeof(RecordHeader) % 8 == 0, "record header must be 8-byte aligned");
+
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+            if (ec) {
+                return nullptr;
+            }
+
+            std::unique_ptr<ChatHistoryLog> log(new ChatHistoryLog(directory, room_id, options));
+            if (!log->Recover()) {
+                return nullptr;
+            }
+            return log;
+        }
+
+        std::string ChatHistoryLog::GetSegmentPath(uint64_t segment_no) const {
+            return directory_ + "/seg_" + std::to_string(segment_no) + ".log";
+        }
+
+        const ChatHistoryLog::RecordHeader* ChatHistoryLog::GetRecord(const Segment& segment, uint64_t offset) const {
+            return reinterpret_cast<const RecordHeader*>(segment.file->GetData() + offset);
+        }
+
+        HistoryRecordView ChatHistoryLog::MakeView(const RecordHeader* record) {
+            const char* payload = reinterpret_cast<const char*>(record) + sizeof(RecordHeader);
+
+            HistoryRecordView view;
+            view.sequence = record->sequence;
+            view.timestamp = record->timestamp;
+            view.message_type = record->message_type;
+            view.sender_id = std::string_view(payload, record->sender_length);
+            view.message = std::string_view(payload + record->sender_length, record->message_length);
+            return view;
+        }
+
+        bool ChatHistoryLog::Recover() {
+            std::error_code ec;
+            uint64_t max_segment_no = 0;
+
+            for (const auto& entry : std::filesystem::directory_iterator(directory_, ec)) {
+                const std::string name = entry.path().filename().string();
+                if (name.compare(0, 4, "seg_") != 0 || entry.path().extension() != ".log") {
+                    continue;
+                }
+
+                auto segment = std::make_unique<Segment>();
+                segment->file = std::make_unique<Common::MappedFile>();
+                if (!segment->file->Open(entry.path().string()) ||
+                    segment->file->GetSize() < sizeof(SegmentHeader) + sizeof(RecordHeader)) {
+                    continue;
+                }
+
+                const SegmentHeader* header = reinterpret_cast<const SegmentHeader*>(segment->file->GetData());
+                if (header->magic != SEGMENT_MAGIC || header->version != SEGMENT_VERSION || header->room_id != room_id_) {
+                    continue;
+                }
+                max_segment_no = std::max(max_segment_no, header->segment_no);
+
+                if (header->first_sequence == 0) {
+                    //    ׸Ʈ
+                    segment->file->Close();
+                    std::filesystem::remove(entry.path(), ec);
+                    continue;
+                }
+
+                segment->segment_no = header->segment_no;
+                segment->first_sequence = header->first_sequence;
+
+                // ĿԵ ϱ  ϸ  ε 籸
+                const uint64_t capacity = segment->file->GetSize();
+                uint64_t offset = sizeof(SegmentHeader);
+                uint64_t expected = segment->first_sequence;
+                while (offset + sizeof(RecordHeader) + TRAILER_SIZE <= capacity) {
+                    const RecordHeader* record = GetRecord(*segment, offset);
+                    const uint64_t size = record->record_size;
+                    if (size == 0 || size % 8 != 0 || offset + size > capacity ||
+                        size != AlignRecord(sizeof(RecordHeader) + record->sender_length + record->message_length) + TRAILER_SIZE ||
+                        record->sequence != expected) {
+                        break;
+                    }
+
+                    const uint32_t* trailer = reinterpret_cast<const uint32_t*>(segment->file->GetData() + offset + size - TRAILER_SIZE);
+                    if (trailer[0] != size || trailer[1] != TRAILER_MAGIC) {
+                        break;
+                    }
+
+                    if (segment->record_count % options_.index_interval == 0) {
+                        segment->index.push_back({ record->sequence, record->timestamp, offset });
+                    }
+                    ++segment->record_count;
+                    ++expected;
+                    offset += size;
+                }
+
+                //      ߰   ϵ
+                if (offset < capacity) {
+                    char* tail = segment->file->GetData() + offset;
+                    if (std::any_of(tail, tail + std::min<uint64_t>(capacity - offset, sizeof(RecordHeader)),
+                        [](char c) { return c != 0; })) {
+                        memset(tail, 0, static_cast<size_t>(capacity - offset));
+                    }
+                }
+                segment->write_offset = offset;
+                segments_.push_back(std::move(segment));
+            }
+
+            // ׸Ʈ ȣ ̸   ̹Ƿ ù   
+            std::sort(segments_.begin(), segments_.end(), [](const auto& a, const auto& b) {
+                return a->first_sequence < b->first_sequence;
+            });
+
+            //    ׸Ʈ 
+            for (size_t i = segments_.size(); i > 1; --i) {
+                const Segment& prev = *segments_[i - 2];
+                if (prev.first_sequence + prev.record_count != segments_[i - 1]->first_sequence) {
+                    for (size_t j = 0; j < i - 1; ++j) {
+                        retired_segments_.push_back(std::move(segments_[j]));
+                    }
+                    segments_.erase(segments_.begin(), segments_.begin() + (i - 1));
+                    break;
+                }
+            }
+
+            while (segments_.size() > options_.max_segments) {
+                retired_segments_.push_back(std::move(segments_.front()));
+                segments_.pop_front();
+            }
+
+            if (!segments_.empty()) {
+                const Segment& last = *segments_.back();
+                last_sequence_ = last.first_sequence + last.record_count - 1;
+            }
+            next_segment_no_ = max_segment_no + 1;
+            return true;
+        }
+
+        std::unique_ptr<ChatHistoryLog::Segment> ChatHistoryLog::CreateSegment(uint64_t segment_no) {
+            const std::string path = GetSegmentPath(segment_no);
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+
+            auto segment = std::make_unique<Segment>();
+            segment->file = std::make_unique<Common::MappedFile>();
+            if (!segment->file->Open(path, options_.segment_size)) {
+                return nullptr;
+            }
+
+            SegmentHeader* header = reinterpret_cast<SegmentHeader*>(segment->file->GetData());
+            memset(header, 0, sizeof(SegmentHeader));
+            header->version = SEGMENT_VERSION;
+            header->room_id = room_id_;
+            header->segment_no = segment_no;
+            header->created_at = GetUnixTime();
+            header->magic = SEGMENT_MAGIC;
+
+            segment->segment_no = segment_no;
+            segment->write_offset = sizeof(SegmentHeader);
+            return segment;
+        }
+
+        bool ChatHistoryLog::Rollover() {
+            std::unique_ptr<Segment> segment = std::move(spare_segment_);
+            if (!segment) {
+                // ÷ 尡  غ  -> ¿   ⼭ 
+                segment = CreateSegment(next_segment_no_++);
+                if (!segment) {
+                    return false;
+                }
+                STATS_INCREMENT("chat.history_inline_rollovers");
+            }
+
+            segment->first_sequence = last_sequence_ + 1;
+            reinterpret_cast<SegmentHeader*>(segment->file->GetData())->first_sequence = segment->first_sequence;
+            segments_.push_back(std::move(segment));
+
+            while (segments_.size() > options_.max_segments) {
+                retired_segments_.push_back(std::move(segments_.front()));
+                segments_.pop_front();
+            }
+            return true;
+        }
+
+        uint64_t ChatHistoryLog::Append(const std::string& sender_id, const std::string& message,
+            int32_t message_type, int64_t timestamp) {
+            const uint64_t record_size = AlignRecord(sizeof(RecordHeader) + sender_id.size() + message.size()) + TRAILER_SIZE;
+            if (sender_id.size() > UINT16_MAX || message.size() > UINT32_MAX ||
+                record_size > options_.segment_size - sizeof(SegmentHeader)) {
+                return 0;
+            }
+
+            AcquireSRWLockExclusive(&log_lock_);
+
+            if (segments_.empty() || segments_.back()->write_offset + record_size > segments_.back()->file->GetSize()) {
+                if (!Rollover()) {
+                    ReleaseSRWLockExclusive(&log_lock_);
+                    return 0;
+                }
+            }
+
+            Segment& segment = *segments_.back();
+            const uint64_t offset = segment.write_offset;
+            char* base = segment.file->GetData() + offset;
+            const uint64_t sequence = ++last_sequence_;
+
+            RecordHeader* record = reinterpret_cast<RecordHeader*>(base);
+            record->sender_length = static_cast<uint16_t>(sender_id.size());
+            record->reserved = 0;
+            record->message_length = static_cast<uint32_t>(message.size());
+            record->message_type = message_type;
+            record->sequence = sequence;
+            record->timestamp = timestamp;
+            memcpy(base + sizeof(RecordHeader), sender_id.data(), sender_id.size());
+            memcpy(base + sizeof(RecordHeader) + sender_id.size(), message.data(), message.size());
+
+            uint32_t* trailer = reinterpret_cast<uint32_t*>(base + record_size - TRAILER_SIZE);
+            trailer[0] = static_cast<uint32_t>(record_size);
+            trailer[1] = TRAILER_MAGIC;
+
+            std::atomic_thread_fence(std::memory_order_release);
+            record->record_size = static_cast<uint32_t>(record_size);
+
+            if (segment.record_count % options_.index_interval == 0) {
+                segment.index.push_back({ sequence, timestamp, offset });
+            }
+            ++segment.record_count;
+            segment.write_offset += record_size;
+            segment.is_dirty = true;
+            is_dirty_ = true;
+
+            ReleaseSRWLockExclusive(&log_lock_);
+            return sequence;
+        }
+
+        void ChatHistoryLog::ScanForward(size_t segment_pos, uint64_t offset,
+            const std::function<bool(const RecordHeader*)>& callback) const {
+            for (; segment_pos < segments_.size(); ++segment_pos, offset = sizeof(SegmentHeader)) {
+                const Segment& segment = *segments_[segment_pos];
+                while (offset < segment.write_offset) {
+                    const RecordHeader* record = GetRecord(segment, offset);
+                    if (!callback(record)) {
+                        return;
+                    }
+                    offset += record->record_size;
+                }
+            }
+        }
+
+        size_t ChatHistoryLog::ForEachRecent(size_t count, const Visitor& visitor) const {
+            std::vector<const RecordHeader*> records;
+            records.reserve(count);
+
+            AcquireSRWLockShared(&log_lock_);
+
+            // trailer   Ųٷ ̵
+            for (size_t pos = segments_.size(); pos > 0 && records.size() < count; --pos) {
+                const Segment& segment = *segments_[pos - 1];
+                uint64_t offset = segment.write_offset;
+                while (offset > sizeof(SegmentHeader) && records.size() < count) {
+                    const uint32_t* trailer = reinterpret_cast<const uint32_t*>(segment.file->GetData() + offset - TRAILER_SIZE);
+                    offset -= trailer[0];
+                    records.push_back(GetRecord(segment, offset));
+                }
+            }
+
+            for (auto it = records.rbegin(); it != records.rend(); ++it) {
+                visitor(MakeView(*it));
+            }
+
+            ReleaseSRWLockShared(&log_lock_);
+            return records.size();
+        }
+
+        std::vector<HistoryMessage> ChatHistoryLog::GetRecent(size_t count) const {
+            std::vector<HistoryMessage> messages;
+            messages.reserve(count);
+            ForEachRecent(count, [&messages](const HistoryRecordView& view) {
+                messages.push_back({ view.sequence, view.timestamp, view.message_type,
+                    std::string(view.sender_id), std::string(view.message) });
+            });
+            return messages;
+        }
+
+        size_t ChatHistoryLog::ReadFrom(uint64_t from_sequence, size_t max_count, const Visitor& visitor) const {
+            size_t visited = 0;
+
+            AcquireSRWLockShared(&log_lock_);
+
+            if (!segments_.empty() && max_count > 0 && from_sequence <= last_sequence_) {
+                //  ϴ ׸Ʈ ->    ε  ̺ Ž
+                auto segment_it = std::upper_bound(segments_.begin(), segments_.end(), from_sequence,
+                    [](uint64_t sequence, const auto& segment) { return sequence < segment->first_sequence; });
+                size_t segment_pos = (segment_it == segments_.begin()) ? 0 : static_cast<size_t>(segment_it - segments_.begin()) - 1;
+
+                const auto& index = segments_[segment_pos]->index;
+                auto point_it = std::upper_bound(index.begin(), index.end(), from_sequence,
+                    [](uint64_t sequence, const IndexPoint& point) { return sequence < point.sequence; });
+                uint64_t offset = (point_it == index.begin()) ? sizeof(SegmentHeader) : (point_it - 1)->offset;
+
+                ScanForward(segment_pos, offset, [&](const RecordHeader* record) {
+                    if (record->sequence >= from_sequence) {
+                        visitor(MakeView(record));
+                        ++visited;
+                    }
+                    return visited < max_count;
+                });
+            }
+
+            ReleaseSRWLockShared(&log_lock_);
+            return visited;
+        }
+
+        uint64_t ChatHistoryLog::FindSequenceByTime(int64_t timestamp) const {
+            AcquireSRWLockShared(&log_lock_);
+
+            uint64_t found = last_sequence_ + 1;
+            if (!segments_.empty()) {
+                // ù  ð timestamp ̻ ׸Ʈ ٷ տ Ž
+                auto segment_it = std::lower_bound(segments_.begin(), segments_.end(), timestamp,
+                    [](const auto& segment, int64_t value) {
+                        return !segment->index.empty() && segment->index.front().timestamp < value;
+                    });
+                size_t segment_pos = (segment_it == segments_.begin()) ? 0 : static_cast<size_t>(segment_it - segments_.begin()) - 1;
+
+                const auto& index = segments_[segment_pos]->index;
+                auto point_it = std::lower_bound(index.begin(), index.end(), timestamp,
+                    [](const IndexPoint& point, int64_t value) { return point.timestamp < value; });
+                uint64_t offset = (point_it == index.begin()) ? sizeof(SegmentHeader) : (point_it - 1)->offset;
+
+                ScanForward(segment_pos, offset, [&](const RecordHeader* record) {
+                    if (record->timestamp >= timestamp) {
+                        found = record->sequence;
+                        return false;
+                    }
+                    return true;
+                });
+            }
+
+            ReleaseSRWLockShared(&log_lock_);
+            return found;
+        }
+
+        uint64_t ChatHistoryLog::GetFirstSequence() const {
+            AcquireSRWLockShared(&log_lock_);
+            uint64_t sequence = segments_.empty() ? last_sequence_ + 1 : segments_.front()->first_sequence;
+            ReleaseSRWLockShared(&log_lock_);
+            return sequence;
+        }
+
+        uint64_t ChatHistoryLog::GetLastSequence() const {
+            AcquireSRWLockShared(&log_lock_);
+            uint64_t sequence = last_sequence_;
+            ReleaseSRWLockShared(&log_lock_);
+            return sequence;
+        }
+
+        size_t ChatHistoryLog::GetSegmentCount() const {
+            AcquireSRWLockShared(&log_lock_);
+            size_t count = segments_.size();
+            ReleaseSRWLockShared(&log_lock_);
+            return count;
+        }
+
+        void ChatHistoryLog::FlushPending(bool wait) {
+            std::vector<Common::MappedFile*> files;
+
+            AcquireSRWLockExclusive(&log_lock_);
+            if (is_dirty_) {
+                is_dirty_ = false;
+                // ÷   ׸Ʈ   Ѿ  Ƿ ߰ ־ ׸Ʈ  
+                for (auto& segment : segments_) {
+                    if (segment->is_dirty) {
+                        segment->is_dirty = false;
+                        files.push_back(segment->file.get());
+                    }
+                }
+            }
+            ReleaseSRWLockExclusive(&log_lock_);
+
+            // ׸Ʈ  ÷ (RemoveRetiredSegments) ϾǷ  ۿ ص 
+            for (auto* file : files) {
+                file->Flush(wait);
+            }
+        }
+
+        void ChatHistoryLog::PrepareNextSegment() {
+            uint64_t segment_no = 0;
+
+            AcquireSRWLockExclusive(&log_lock_);
+            const bool needs_spare = !spare_segment_ && (segments_.empty() ||
+                segments_.back()->write_offset > segments_.back()->file->GetSize() / 4 * 3);
+            if (needs_spare) {
+                segment_no = next_segment_no_++;
+            }
+            ReleaseSRWLockExclusive(&log_lock_);
+
+            if (!needs_spare) {
+                return;
+            }
+
+            //  /Ȯ ߰  ۿ
+            auto segment = CreateSegment(segment_no);
+            if (!segment) {
+                return;
+            }
+
+            AcquireSRWLockExclusive(&log_lock_);
+            if (!spare_segment_) {
+                spare_segment_ = std::move(segment);
+            }
+            ReleaseSRWLockExclusive(&log_lock_);
+
+            if (segment) {
+                std::error_code ec;
+                const std::string path = segment->file->GetPath();
+                segment->file->Close();
+                std::filesystem::remove(path, ec);
+            }
+        }
+
+        void ChatHistoryLog::RemoveRetiredSegments() {
+            std::vector<std::unique_ptr<Segment>> retired;
+
+            AcquireSRWLockExclusive(&log_lock_);
+            retired.swap(retired_segments_);
+            ReleaseSRWLockExclusive(&log_lock_);
+
+            std::error_code ec;
+            for (auto& segment : retired) {
+                const std::string path = segment->file->GetPath();
+                segment->file->Close();
+                std::filesystem::remove(path, ec);
+            }
+        }
+
+        // ===== ChatHistoryManager =====
+
+        ChatHistoryManager* ChatHistoryManager::instance_ = nullptr;
+        std::once_flag ChatHistoryManager::init_flag_;
+
+        ChatHistoryManager* ChatHistoryManager::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new ChatHistoryManager();
+            });
+            return instance_;
+        }
+
+        ChatHistoryManager::ChatHistoryManager() {
+            InitializeSRWLock(&logs_lock_);
+        }
+
+        ChatHistoryManager::~ChatHistoryManager() {
+            Stop();
+        }
+
+        bool ChatHistoryManager::Start(const std::string& history_root) {
+            if (is_running_.exchange(true)) {
+                return false;
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(history_root, ec);
+            if (ec) {
+                is_running_ = false;
+                return false;
+            }
+
+            history_root_ = history_root;
+            flush_thread_ = std::thread(&ChatHistoryManager::FlushLoop, this);
+            return true;
+        }
+
+        void ChatHistoryManager::Stop() {
+            if (!is_running_.exchange(false)) {
+                return;
+            }
+
+            flush_cv_.notify_all();
+            if (flush_thread_.joinable()) {
+                flush_thread_.join();
+            }
+
+            AcquireSRWLockExclusive(&logs_lock_);
+            for (auto& entry : logs_) {
+                entry.second->FlushPending(true);
+                entry.second->RemoveRetiredSegments();
+            }
+            for (auto& log : closing_logs_) {
+                log->FlushPending(true);
+                log->RemoveRetiredSegments();
+            }
+            logs_.clear();
+            closing_logs_.clear();
+            ReleaseSRWLockExclusive(&logs_lock_);
+        }
+
+        std::shared_ptr<ChatHistoryLog> ChatHistoryManager::GetRoomHistory(uint32_t room_id) {
+            if (!is_running_) {
+                return nullptr;
+            }
+
+            AcquireSRWLockShared(&logs_lock_);
+            auto it = logs_.find(room_id);
+            std::shared_ptr<ChatHistoryLog> log = (it != logs_.end()) ? it->second : nullptr;
+            ReleaseSRWLockShared(&logs_lock_);
+            if (log) {
+                return log;
+            }
+
+            AcquireSRWLockExclusive(&logs_lock_);
+            auto& slot = logs_[room_id];
+            if (!slot) {
+                slot = ChatHistoryLog::Open(history_root_ + "/room_" + std::to_string(room_id), room_id);
+            }
+            log = slot;
+            if (!log) {
+                logs_.erase(room_id);
+            }
+            ReleaseSRWLockExclusive(&logs_lock_);
+            return log;
+        }
+
+        void ChatHistoryManager::CloseRoomHistory(uint32_t room_id) {
+            //      Ƿ ÷ 尡      
+            AcquireSRWLockExclusive(&logs_lock_);
+            auto it = logs_.find(room_id);
+            if (it != logs_.end()) {
+                closing_logs_.push_back(std::move(it->second));
+                logs_.erase(it);
+            }
+            ReleaseSRWLockExclusive(&logs_lock_);
+        }
+
+        size_t ChatHistoryManager::GetOpenLogCount() const {
+            AcquireSRWLockShared(&logs_lock_);
+            size_t count = logs_.size();
+            ReleaseSRWLockShared(&logs_lock_);
+            return count;
+        }
+
+        size_t ChatHistoryManager::GetClosingLogCount() const {
+            AcquireSRWLockShared(&logs_lock_);
+            size_t count = closing_logs_.size();
+            ReleaseSRWLockShared(&logs_lock_);
+            return count;
+        }
+
+        void ChatHistoryManager::MaintainClosingLogs() {
+            std::vector<std::shared_ptr<ChatHistoryLog>> released;
+
+            AcquireSRWLockExclusive(&logs_lock_);
+            for (auto it = closing_logs_.begin(); it != closing_logs_.end();) {
+                if (it->use_count() == 1) {
+                    //   :  ۿ    
+                    released.push_back(std::move(*it));
+                    it = closing_logs_.erase(it);
+                    continue;
+                }
+                (*it)->FlushPending();
+                (*it)->PrepareNextSegment();
+                (*it)->RemoveRetiredSegments();
+                ++it;
+            }
+            ReleaseSRWLockExclusive(&logs_lock_);
+
+            for (auto& log : released) {
+                log->FlushPending(true);
+                log->RemoveRetiredSegments();
+            }
+        }
+
+        void ChatHistoryManager::FlushLoop() {
+            const auto interval = std::chrono::milliseconds(Protocol::Config::HISTORY_FLUSH_INTERVAL_MS);
+
+            while (is_running_) {
+                {
+                    std::unique_lock<std::mutex> lock(flush_mutex_);
+                    flush_cv_.wait_for(lock, interval, [this]() { return !is_running_; });
+                }
+
+                // ׷ Ŀ:    ߰ 渶   Flush 
+                auto start = std::chrono::steady_clock::now();
+
+                AcquireSRWLockShared(&logs_lock_);
+                for (auto& entry : logs_) {
+                    entry.second->FlushPending();
+                    entry.second->PrepareNextSegment();
+                    entry.second->RemoveRetiredSegments();
+                }
+                const bool has_closing = !closing_logs_.empty();
+                ReleaseSRWLockShared(&logs_lock_);
+
+                if (has_closing) {
+                    MaintainClosingLogs();
+                }
+
+                auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+                STATS_RECORD("chat.history_flush_ms", elapsed.count());
+            }
+        }
+
+    } // namespace Core
+} // namespace NexusCore
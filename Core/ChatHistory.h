@@ -0,0 +1,169 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include "../Common/MappedFile.h"
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // ε  ״ Ű  (湮 ݹ ȿ ȿ)
+        struct HistoryRecordView {
+            uint64_t sequence;
+            int64_t timestamp;
+            int32_t message_type;
+            std::string_view sender_id;
+            std::string_view message;
+        };
+
+        struct HistoryMessage {
+            uint64_t sequence;
+            int64_t timestamp;
+            int32_t message_type;
+            std::string sender_id;
+            std::string message;
+        };
+
+        //  ϳ ߰  ä 
+        //  ũ ׸Ʈ  ޸  ΰ  memcpyθ ߰Ѵ.
+        // ũ (Flush)  ׸Ʈ غ,  ׸Ʈ  ChatHistoryManager ÷ 尡 Ƽ óѴ.
+        class ChatHistoryLog {
+        public:
+            using Visitor = std::function<void(const HistoryRecordView&)>;
+
+            struct Options {
+                uint64_t segment_size = Protocol::Config::HISTORY_SEGMENT_SIZE;
+                size_t max_segments = Protocol::Config::HISTORY_MAX_SEGMENTS;
+                uint32_t index_interval = 64; //  ε  ( )
+            };
+
+            static std::unique_ptr<ChatHistoryLog> Open(const std::string& directory, uint32_t room_id,
+                const Options& options);
+            static std::unique_ptr<ChatHistoryLog> Open(const std::string& directory, uint32_t room_id) {
+                return Open(directory, room_id, Options());
+            }
+            ~ChatHistoryLog();
+
+            //  ߰. ο  ȯ (  0)
+            uint64_t Append(const std::string& sender_id, const std::string& message,
+                int32_t message_type, int64_t timestamp);
+
+            // ֱ count   湮 (ε  ٷ )
+            size_t ForEachRecent(size_t count, const Visitor& visitor) const;
+            std::vector<HistoryMessage> GetRecent(size_t count) const;
+
+            // from_sequence ִ max_count 湮 ( ε  ġ Ž)
+            size_t ReadFrom(uint64_t from_sequence, size_t max_count, const Visitor& visitor) const;
+
+            // timestamp  ù   ( GetLastSequence() + 1)
+            uint64_t FindSequenceByTime(int64_t timestamp) const;
+
+            uint64_t GetFirstSequence() const;
+            uint64_t GetLastSequence() const;
+            size_t GetSegmentCount() const;
+            uint32_t GetRoomId() const { return room_id_; }
+
+            // ÷ 忡 ȣ: ׷ Ŀ,  ׸Ʈ ̸ ,  Ⱓ  ׸Ʈ 
+            void FlushPending(bool wait = false);
+            void PrepareNextSegment();
+            void RemoveRetiredSegments();
+
+        private:
+            ChatHistoryLog(const std::string& directory, uint32_t room_id, const Options& options);
+
+            struct SegmentHeader;
+            struct RecordHeader;
+
+            struct IndexPoint {
+                uint64_t sequence;
+                int64_t timestamp;
+                uint64_t offset;
+            };
+
+            struct Segment {
+                uint64_t segment_no = 0;
+                uint64_t first_sequence = 0;
+                uint64_t record_count = 0;
+                uint64_t write_offset = 0;
+                bool is_dirty = false; //  ÷  ߰
+                std::vector<IndexPoint> index;
+                std::unique_ptr<Common::MappedFile> file;
+            };
+
+            bool Recover();
+            std::unique_ptr<Segment> CreateSegment(uint64_t segment_no);
+            bool Rollover();
+            std::string GetSegmentPath(uint64_t segment_no) const;
+            const RecordHeader* GetRecord(const Segment& segment, uint64_t offset) const;
+            // segment_pos/offset   ѱ. callback false ȯϸ ߴ
+            void ScanForward(size_t segment_pos, uint64_t offset,
+                const std::function<bool(const RecordHeader*)>& callback) const;
+            static HistoryRecordView MakeView(const RecordHeader* record);
+
+            std::string directory_;
+            uint32_t room_id_;
+            Options options_;
+
+            mutable SRWLOCK log_lock_;
+            std::deque<std::unique_ptr<Segment>> segments_;
+            uint64_t last_sequence_;
+            uint64_t next_segment_no_;
+            bool is_dirty_;
+
+            // ÷ 尡 غ/ϴ ׸Ʈ (log_lock_ ȣ)
+            std::unique_ptr<Segment> spare_segment_;
+            std::vector<std::unique_ptr<Segment>> retired_segments_;
+        };
+
+        // 溰 ä   + ׷ Ŀ 
+        class ChatHistoryManager {
+        public:
+            static ChatHistoryManager* GetInstance();
+
+            bool Start(const std::string& history_root);
+            void Stop();
+
+            //   ų  (Start ̸ nullptr). 浵   Ƿ
+            // CloseRoomHistory Ŀ     ִ
+            std::shared_ptr<ChatHistoryLog> GetRoomHistory(uint32_t room_id);
+            // ȸ 󿡼 . ׷ Ŀ/׸Ʈ      Ѵ
+            void CloseRoomHistory(uint32_t room_id);
+
+            size_t GetOpenLogCount() const;
+            size_t GetClosingLogCount() const; //      
+
+        private:
+            ChatHistoryManager();
+            ~ChatHistoryManager();
+
+            void FlushLoop();
+            void MaintainClosingLogs();
+
+            mutable SRWLOCK logs_lock_;
+            std::unordered_map<uint32_t, std::shared_ptr<ChatHistoryLog>> logs_;
+            std::vector<std::shared_ptr<ChatHistoryLog>> closing_logs_; // logs_lock_ ȣ
+            std::string history_root_;
+
+            std::thread flush_thread_;
+            std::atomic<bool> is_running_{ false };
+            std::mutex flush_mutex_;
+            std::condition_variable flush_cv_;
+
+            static ChatHistoryManager* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,456 @@
+#include "pch.h"
+#include "ChatRoom.h"
+#include "Session.h"
+#include "Statistics.h"
+#include "WorkerExecutor.h"
+#include "../Common/Utils.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            //  + ̷ε带  ۷ 
+            std::vector<char> BuildPacket(uint16_t packet_id, const char* payload, size_t size) {
+                Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(size),
+                    Common::Utils::CryptoUtils::CalculateCRC32(payload, size));
+
+                std::vector<char> packet(sizeof(header) + size);
+                memcpy(packet.data(), &header, sizeof(header));
+                memcpy(packet.data() + sizeof(header), payload, size);
+                return packet;
+            }
+        }
+
+        ChatRoom::ChatRoom(uint32_t room_id, const std::string& title, size_t max_participants)
+            : room_id_(room_id)
+            , title_(title)
+            , max_participants_(max_participants) {
+            InitializeSRWLock(&participants_lock_);
+            snapshot_ = new ParticipantSnapshot();
+            history_ = ChatHistoryManager::GetInstance()->GetRoomHistory(room_id);
+        }
+
+        ChatRoom::~ChatRoom() {
+            delete notify_batcher_.exchange(nullptr); // ٷ  ڿ ġ  
+            actor_.reset(); //  ޽  ó
+            delete fanout_.exchange(nullptr);
+            EpochReclaimer::GetInstance()->Retire(snapshot_.exchange(nullptr));
+        }
+
+        // =====   (   Ǵ   ȿ ȣ) =====
+
+        bool ChatRoom::AddParticipant(Session* session) {
+            if (participants_.size() >= max_participants_) {
+                return false;
+            }
+            const UserHandle user = UserIdInterner::GetInstance()->Intern(session->GetUserId());
+            if (participants_.emplace(session, user).second) {
+                user_index_[user] = session;
+                if (RoomFanout* fanout = GetFanout()) {
+                    fanout->AddMember(session); //  ȣ  ־ Leave  ڹٲ ʰ 
+                }
+                ++total_users_entered_;
+                PublishSnapshot();
+            }
+            return true;
+        }
+
+        void ChatRoom::RemoveParticipant(Session* session) {
+            auto it = participants_.find(session);
+            if (it != participants_.end()) {
+                auto index_it = user_index_.find(it->second);
+                if (index_it != user_index_.end() && index_it->second == session) {
+                    user_index_.erase(index_it);
+                }
+                participants_.erase(it);
+                if (RoomFanout* fanout = GetFanout()) {
+                    fanout->RemoveMember(session);
+                }
+                PublishSnapshot();
+            }
+        }
+
+        void ChatRoom::SwapParticipant(Session* old_session, Session* new_session) {
+            auto it = participants_.find(old_session);
+            if (it == participants_.end()) {
+                return;
+            }
+
+            const UserHandle user = it->second;
+            participants_.erase(it);
+            participants_.emplace(new_session, user);
+
+            auto index_it = user_index_.find(user);
+            if (index_it != user_index_.end() && index_it->second == old_session) {
+                index_it->second = new_session;
+            }
+            if (RoomFanout* fanout = GetFanout()) {
+                fanout->RemoveMember(old_session);
+                fanout->AddMember(new_session);
+            }
+            PublishSnapshot();
+        }
+
+        void ChatRoom::PublishSnapshot() {
+            if (GetFanout()) {
+                return; //  n 濡 n ϸ O(n) 簡 ǹǷ    ȸ
+            }
+
+            auto* snapshot = new ParticipantSnapshot();
+            snapshot->sessions.reserve(participants_.size());
+            for (const auto& entry : participants_) {
+                snapshot->sessions.push_back(entry.first);
+            }
+            snapshot->by_user = user_index_;
+
+            //   ȸ     
+            EpochReclaimer::GetInstance()->Retire(snapshot_.exchange(snapshot, std::memory_order_acq_rel));
+        }
+
+        void ChatRoom::SendToParticipants(const char* data, size_t size, Session* exclude_session) {
+            if (RoomFanout* fanout = GetFanout()) {
+                //  :  ۾ ְ ٷ ȯ (Ŷ ϳ  尡 )
+                fanout->Broadcast(std::make_shared<const std::vector<char>>(data, data + size), exclude_session);
+                return;
+            }
+
+            EpochGuard guard;
+            for (Session* session : GetSnapshot()->sessions) {
+                if (session != exclude_session) {
+                    session->PostSend(data, size);
+                }
+            }
+        }
+
+        Session* ChatRoom::FindParticipant(UserHandle user) const {
+            if (GetFanout()) {
+                AcquireSRWLockShared(&participants_lock_);
+                auto it = user_index_.find(user);
+                Session* session = (it != user_index_.end()) ? it->second : nullptr;
+                ReleaseSRWLockShared(&participants_lock_);
+                return session;
+            }
+
+            const auto& by_user = GetSnapshot()->by_user;
+            auto it = by_user.find(user);
+            return (it != by_user.end()) ? it->second : nullptr;
+        }
+
+        std::vector<Session*> ChatRoom::GetParticipantSessions() const {
+            if (!GetFanout()) {
+                return GetSnapshot()->sessions;
+            }
+
+            std::vector<Session*> sessions;
+            AcquireSRWLockShared(&participants_lock_);
+            sessions.reserve(participants_.size());
+            for (const auto& entry : participants_) {
+                sessions.push_back(entry.first);
+            }
+            ReleaseSRWLockShared(&participants_lock_);
+            return sessions;
+        }
+
+        template<typename Func>
+        auto ChatRoom::ChangeInActor(Func func) -> decltype(func()) {
+            if (!GetFanout()) {
+                return func();
+            }
+
+            AcquireSRWLockExclusive(&participants_lock_);
+            if constexpr (std::is_void_v<decltype(func())>) {
+                func();
+                ReleaseSRWLockExclusive(&participants_lock_);
+            }
+            else {
+                auto result = func();
+                ReleaseSRWLockExclusive(&participants_lock_);
+                return result;
+            }
+        }
+
+        // =====  ̽ (   Ϲڽ, ƴϸ  ) =====
+
+        bool ChatRoom::Enter(Session* session, const std::string& password) {
+            if (!password_.empty() && password != password_) {
+                return false;
+            }
+
+            if (actor_) {
+                return actor_->Ask([this, session]() {
+                    return ChangeInActor([this, session]() { return AddParticipant(session); });
+                });
+            }
+
+            AcquireSRWLockExclusive(&participants_lock_);
+            bool entered = AddParticipant(session);
+            ReleaseSRWLockExclusive(&participants_lock_);
+            return entered;
+        }
+
+        void ChatRoom::EnterAsync(Session* session, const std::string& password, std::function<void(bool)> on_result) {
+            if (!actor_ || (!password_.empty() && password != password_)) {
+                on_result(Enter(session, password));
+                return;
+            }
+
+            // (ENTER_ROOM_RES  )   ȿ óǹǷ   ۺ  
+            actor_->Tell([this, session, on_result = std::move(on_result)]() {
+                on_result(ChangeInActor([this, session]() { return AddParticipant(session); }));
+            });
+        }
+
+        void ChatRoom::Leave(Session* session) {
+            if (actor_) {
+                actor_->Tell([this, session]() {
+                    ChangeInActor([this, session]() { RemoveParticipant(session); });
+                });
+                return;
+            }
+
+            AcquireSRWLockExclusive(&participants_lock_);
+            RemoveParticipant(session);
+            ReleaseSRWLockExclusive(&participants_lock_);
+        }
+
+        void ChatRoom::ReplaceParticipant(Session* old_session, Session* new_session) {
+            if (actor_) {
+                actor_->Tell([this, old_session, new_session]() {
+                    ChangeInActor([this, old_session, new_session]() { SwapParticipant(old_session, new_session); });
+                });
+                return;
+            }
+
+            AcquireSRWLockExclusive(&participants_lock_);
+            SwapParticipant(old_session, new_session);
+            ReleaseSRWLockExclusive(&participants_lock_);
+        }
+
+        void ChatRoom::RunAfterLeave(Session* session, std::function<void()> func) {
+            // Ϲڽ ʸ ٸ  ( ̸)   ʸ    ٸ
+            Post([this, session, func = std::move(func)]() mutable {
+                if (RoomFanout* fanout = GetFanout()) {
+                    fanout->RunAfterRemoval(session, std::move(func));
+                    return;
+                }
+                func();
+            });
+        }
+
+        void ChatRoom::BroadcastMessage(const char* data, size_t size, Session* exclude_session) {
+            ++total_messages_sent_;
+
+            if (actor_) {
+                auto packet = std::make_shared<const std::vector<char>>(data, data + size);
+                actor_->Tell([this, packet, exclude_session]() {
+                    SendToParticipants(packet->data(), packet->size(), exclude_session);
+                });
+                return;
+            }
+
+            //  ȸϹǷ /  ٸ 
+            SendToParticipants(data, size, exclude_session);
+        }
+
+        void ChatRoom::SendToUser(const char* data, size_t size, const std::string& target_user_id) {
+            // α   ID 濡 
+            const UserHandle target_user = UserIdInterner::GetInstance()->Find(target_user_id);
+            if (target_user != INVALID_USER_HANDLE) {
+                SendToUser(data, size, target_user);
+            }
+        }
+
+        void ChatRoom::SendToUser(const char* data, size_t size, UserHandle target_user) {
+            if (actor_) {
+                auto packet = std::make_shared<const std::vector<char>>(data, data + size);
+                actor_->Tell([this, packet, target_user]() {
+                    if (Session* session = FindParticipant(target_user)) {
+                        session->PostSend(packet);
+                    }
+                });
+                return;
+            }
+
+            EpochGuard guard;
+            if (Session* session = FindParticipant(target_user)) {
+                session->PostSend(data, size);
+            }
+        }
+
+        bool ChatRoom::IsUserInRoom(const std::string& user_id) const {
+            const UserHandle user = UserIdInterner::GetInstance()->Find(user_id);
+            return user != INVALID_USER_HANDLE && IsUserInRoom(user);
+        }
+
+        bool ChatRoom::IsUserInRoom(UserHandle user) const {
+            EpochGuard guard;
+            return FindParticipant(user) != nullptr;
+        }
+
+        size_t ChatRoom::GetParticipantCount() const {
+            if (RoomFanout* fanout = GetFanout()) {
+                return fanout->GetMemberCount();
+            }
+
+            EpochGuard guard;
+            return GetSnapshot()->sessions.size();
+        }
+
+        bool ChatRoom::IsFull() const {
+            return GetParticipantCount() >= max_participants_;
+        }
+
+        bool ChatRoom::IsEmpty() const {
+            return GetParticipantCount() == 0;
+        }
+
+        std::vector<std::string> ChatRoom::GetParticipantIds() const {
+            std::vector<std::string> user_ids;
+
+            EpochGuard guard;
+            const std::vector<Session*> sessions = GetParticipantSessions();
+            user_ids.reserve(sessions.size());
+            for (Session* session : sessions) {
+                user_ids.push_back(session->GetUserId());
+            }
+            return user_ids;
+        }
+
+        void ChatRoom::SetPassword(const std::string& password) {
+            password_ = password;
+        }
+
+        void ChatRoom::SetMaxParticipants(size_t max_count) {
+            max_participants_ = max_count;
+        }
+
+        void ChatRoom::Post(std::function<void()> task) {
+            if (actor_) {
+                actor_->Tell(std::move(task));
+                return;
+            }
+            task();
+        }
+
+        void ChatRoom::EnableActorMode() {
+            const size_t worker_count = std::max<size_t>(1, WorkerExecutor::GetInstance()->GetWorkerCount());
+
+            //       ȯ
+            AcquireSRWLockExclusive(&participants_lock_);
+            if (!actor_) {
+                actor_ = std::make_unique<Actor>(room_id_ % worker_count);
+            }
+            ReleaseSRWLockExclusive(&participants_lock_);
+        }
+
+        void ChatRoom::EnableLargeRoomMode(size_t shard_count) {
+            auto fanout = std::make_unique<RoomFanout>(room_id_, shard_count,
+                [](Session* session, const RoomFanout::SharedPacket& packet) {
+                    session->PostSend(packet);
+                });
+
+            //  ڸ    release Խ (  ʴ /ȸ acquire )
+            AcquireSRWLockExclusive(&participants_lock_);
+            if (!GetFanout()) {
+                for (const auto& entry : participants_) {
+                    fanout->AddMember(entry.first);
+                }
+                fanout_.store(fanout.release(), std::memory_order_release);
+                max_participants_ = std::max(max_participants_, Protocol::Config::LARGE_ROOM_MAX_PARTICIPANTS);
+            }
+            ReleaseSRWLockExclusive(&participants_lock_);
+        }
+
+        uint64_t ChatRoom::RecordMessage(const std::string& sender_id, const std::string& message,
+            int32_t message_type, int64_t timestamp) {
+            if (!history_) {
+                return 0;
+            }
+            return history_->Append(sender_id, message, message_type, timestamp);
+        }
+
+        void ChatRoom::BroadcastChatNotify(const char* notify_payload, size_t size, Session* exclude_session) {
+            if (is_notify_batching_.load(std::memory_order_acquire)) {
+                NotifyBatcher* batcher = notify_batcher_.load(std::memory_order_acquire);
+                if (batcher->Add(notify_payload, size, exclude_session) == NotifyBatcher::AddResult::QUEUED) {
+                    return;
+                }
+            }
+
+            auto packet = BuildPacket(Protocol::PacketID::ROOM_CHAT_NTF, notify_payload, size);
+            BroadcastMessage(packet.data(), packet.size(), exclude_session);
+        }
+
+        void ChatRoom::EnableNotifyBatching(const NotifyBatcher::Options& options) {
+            if (!notify_batcher_.load(std::memory_order_acquire)) {
+                auto batcher = std::make_unique<NotifyBatcher>(options, [this](const NotifyBatcher::Batch& batch) {
+                    SendNotifyBatch(batch);
+                });
+                NotifyBatcher* expected = nullptr;
+                if (notify_batcher_.compare_exchange_strong(expected, batcher.get(), std::memory_order_acq_rel)) {
+                    batcher.release();
+                }
+            }
+            is_notify_batching_.store(true, std::memory_order_release);
+        }
+
+        void ChatRoom::DisableNotifyBatching() {
+            // ÷׸   ʰ  ˸ ٷ  ð ڿ Ƿ ǵ 
+            is_notify_batching_.store(false, std::memory_order_release);
+            NotifyBatcher* batcher = notify_batcher_.load(std::memory_order_acquire);
+            if (batcher) {
+                batcher->Flush();
+            }
+        }
+
+        void ChatRoom::SendNotifyBatch(const NotifyBatcher::Batch& batch) {
+            if (actor_ && !actor_->IsCurrent()) {
+                auto shared_batch = std::make_shared<const NotifyBatcher::Batch>(batch);
+                actor_->Tell([this, shared_batch]() { SendNotifyBatch(*shared_batch); });
+                return;
+            }
+
+            //  ׸ ޴ ڴ  Ŷ  (CRC   )
+            auto shared_packet = std::make_shared<const std::vector<char>>(BuildPacket(Protocol::PacketID::ROOM_CHAT_BATCH_NTF,
+                batch.payload.data(), batch.payload.size()));
+            std::string scratch;
+            total_messages_sent_ += batch.entries.size();
+
+            //  : ڱ ޽       ۿ ѱ ( ˸  ζ  )
+            if (RoomFanout* fanout = GetFanout()) {
+                auto overrides = std::make_shared<RoomFanout::PacketOverrides>();
+                for (Session* session : batch.excluded_sessions) {
+                    const std::string& payload = NotifyBatcher::GetPayloadFor(batch, session, scratch);
+                    overrides->emplace_back(session, payload.empty() ? nullptr : std::make_shared<const std::vector<char>>(
+                        BuildPacket(Protocol::PacketID::ROOM_CHAT_BATCH_NTF, payload.data(), payload.size())));
+                }
+                fanout->Broadcast(shared_packet, std::move(overrides), [](size_t delivered) {
+                    Statistics::GetInstance()->IncrementCounter("chat.batch_packets_sent", delivered);
+                });
+                return;
+            }
+
+            size_t packets_sent = 0;
+            EpochGuard guard;
+            for (Session* session : GetParticipantSessions()) {
+                const std::string& payload = NotifyBatcher::GetPayloadFor(batch, session, scratch);
+                if (&payload == &batch.payload) {
+                    session->PostSend(shared_packet);
+                }
+                else if (!payload.empty()) {
+                    auto packet = BuildPacket(Protocol::PacketID::ROOM_CHAT_BATCH_NTF, payload.data(), payload.size());
+                    session->PostSend(packet.data(), packet.size());
+                }
+                else {
+                    continue;
+                }
+                ++packets_sent;
+            }
+            Statistics::GetInstance()->IncrementCounter("chat.batch_packets_sent", packets_sent);
+        }
+
+    } // namespace Core
+} // namespace NexusCore
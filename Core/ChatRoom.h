@@ -1,9 +1,17 @@
 #pragma once
 
-#include <unordered_set>
+#include <unordered_map>
 #include <string>
+#include <vector>
 #include <memory>
+#include <atomic>
 #include "../Common/Protocol.h"
+#include "ChatHistory.h"
+#include "NotifyBatcher.h"
+#include "RoomFanout.h"
+#include "Actor.h"
+#include "EpochReclaimer.h"
+#include "UserIdInterner.h"
 
 namespace NexusCore {
     namespace Core {
@@ -17,13 +25,23 @@ namespace NexusCore {
 
             //  /
             bool Enter(Session* session, const std::string& password = "");
+            void EnterAsync(Session* session, const std::string& password, std::function<void(bool)> on_result); //  忡 Ŀ  
             void Leave(Session* session);
+            void ReplaceParticipant(Session* old_session, Session* new_session); // : /   ڸ ٲ
+
+            // ռ θ Leave/ReplaceParticipant session    ( Ϲڽ,   )
+            //   func .   ⼭ ؾ и    ǵ帮 
+            void RunAfterLeave(Session* session, std::function<void()> func);
 
             // ޽ 
             void BroadcastMessage(const char* data, size_t size, Session* exclude_session = nullptr);
             void SendToUser(const char* data, size_t size, const std::string& target_user_id);
+            void SendToUser(const char* data, size_t size, UserHandle target_user); // ε O(1) ȸ
+
+            // ä ˸  (RoomChatNotify ̷ε). ġ  ROOM_CHAT_BATCH_NTF  
+            void BroadcastChatNotify(const char* notify_payload, size_t size, Session* exclude_session = nullptr);
 
-            //  
+            //   (  ȸ  Ƿ  )
             uint32_t GetRoomId() const { return room_id_; }
             const std::string& GetTitle() const { return title_; }
             size_t GetParticipantCount() const;
@@ -33,19 +51,86 @@ namespace NexusCore {
             //  
             std::vector<std::string> GetParticipantIds() const;
             bool IsUserInRoom(const std::string& user_id) const;
+            bool IsUserInRoom(UserHandle user) const;
 
-            //  
+            //   ( ޱ , RoomManager::CreateRoom Ŀ ȣ)
             void SetPassword(const std::string& password);
             void SetMaxParticipants(size_t max_count);
 
+            // ˸ ġ  (޽  濡 Ŷ  )
+            // ó ó         Ѵ (  尡    Ƿ).
+            // ɼ ó   ǰ,   ˸ ٷ    ˸  
+            void EnableNotifyBatching(const NotifyBatcher::Options& options);
+            void DisableNotifyBatching();
+            bool IsNotifyBatching() const { return is_notify_batching_.load(std::memory_order_acquire); }
+
+            //    (ڸ Ŀ    Ҿƿ, ִ LARGE_ROOM_MAX_PARTICIPANTS)
+            //     ʰ  ۾ ְ ƿ´. shard_count 0̸ Ŀ 
+            // /帶 ü ϴ   ʰ, ӼӸ/  ȸ  () Ѵ
+            // ˸ ġ   Ҵ (Ѹ ġ    )
+            void EnableLargeRoomMode(size_t shard_count = 0);
+            bool IsLargeRoom() const { return GetFanout() != nullptr; }
+
+            //  :  ¸   Ϲڽθ  (  ,    )
+            // ///ӼӸ  Ŀ ʷ óȴ.   Ŀ Ҵ
+            void EnableActorMode();
+            bool IsActorMode() const { return actor_ != nullptr; }
+
+            //  ʿ  ۾ (ٸ / ڵ鷯  ȣ).    Ϲڽ ٸ 
+            // , ƴϸ ȣ 忡 ٷ 
+            void Post(std::function<void()> task);
+
+            // ä  (ChatHistoryManager  ,    )
+            //    ڰ  ̸   ڵ δ. ٲ    
+            void SetHistory(std::shared_ptr<ChatHistoryLog> history) { history_ = std::move(history); }
+            ChatHistoryLog* GetHistory() const { return history_.get(); }
+            uint64_t RecordMessage(const std::string& sender_id, const std::string& message,
+                int32_t message_type, int64_t timestamp); // εĳƮ  ȣ
+
         private:
+            //   Һ .     Խϰ   EpochReclaimer ȸ
+            struct ParticipantSnapshot {
+                std::vector<Session*> sessions;
+                std::unordered_map<UserHandle, Session*> by_user; // ӼӸ/  ȸ
+            };
+
+            //    (participants_lock_  Ǵ   ȿ ȣ)
+            bool AddParticipant(Session* session);
+            void RemoveParticipant(Session* session);
+            void SwapParticipant(Session* old_session, Session* new_session);
+            void PublishSnapshot(); //  ̸ ƹ͵  
+
+            //   ȿ  .   ȸ   Ƿ  ȿ  ȿ 
+            template<typename Func>
+            auto ChangeInActor(Func func) -> decltype(func());
+
+            //  ȸ (EpochGuard ȿ ȣ)
+            const ParticipantSnapshot* GetSnapshot() const { return snapshot_.load(std::memory_order_acquire); }
+            void SendToParticipants(const char* data, size_t size, Session* exclude_session);
+            Session* FindParticipant(UserHandle user) const;
+            std::vector<Session*> GetParticipantSessions() const; //  ̸   ȿ 
+
             uint32_t room_id_;
             std::string title_;
             std::string password_;
             size_t max_participants_;
 
-            mutable SRWLOCK participants_lock_;
-            std::unordered_set<Session*> participants_;
+            mutable SRWLOCK participants_lock_; //  波 ȭ (/ȸ  )
+            std::unordered_map<Session*, UserHandle> participants_;
+            std::unordered_map<UserHandle, Session*> user_index_;
+            std::atomic<const ParticipantSnapshot*> snapshot_{ nullptr };
+
+            std::shared_ptr<ChatHistoryLog> history_;
+
+            // ġ : ڸ ġ Ŷ ϳ ( ̸  ,  Ŷ ϳ ڱ ޽  纻 )
+            void SendNotifyBatch(const NotifyBatcher::Batch& batch);
+            std::atomic<NotifyBatcher*> notify_batcher_{ nullptr };
+            std::atomic<bool> is_notify_batching_{ false };
+
+            //   忡   Խϰ    . /ȸ   Ƿ acquire/release
+            RoomFanout* GetFanout() const { return fanout_.load(std::memory_order_acquire); }
+            std::atomic<RoomFanout*> fanout_{ nullptr };
+            std::unique_ptr<Actor> actor_;
 
             //  
             std::atomic<uint64_t> total_messages_sent_{ 0 };
@@ -0,0 +1,423 @@
+#include "pch.h"
+#include "ContentStore.h"
+#include "Statistics.h"
+
+#include <cstring>
+#include <filesystem>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr uint32_t INDEX_MAGIC = 0x5343584E; // "NXCS"
+            constexpr uint32_t INDEX_VERSION = 1;
+            constexpr uint32_t INITIAL_CAPACITY = 1024;
+
+            constexpr uint8_t SLOT_FREE = 0;
+            constexpr uint8_t SLOT_LIVE = 1;
+
+            size_t GetDigestSize(Common::Utils::HashAlgorithm algorithm) {
+                return algorithm == Common::Utils::HashAlgorithm::MD5 ? 16 : 32;
+            }
+
+            int HexValue(char c) {
+                if (c >= '0' && c <= '9') return c - '0';
+                if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+                return -1;
+            }
+
+            int64_t GetUnixTime() {
+                return std::chrono::duration_cast<std::chrono::seconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+        }
+
+#pragma pack(push, 1)
+        struct ContentStore::IndexHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t capacity;     // Ҵ  
+            uint32_t used_slots;   //  ̶    (ĵ )
+            uint64_t stored_bytes;
+            uint8_t reserved[40];
+        };
+
+        struct ContentStore::IndexEntry {
+            uint8_t digest[32];
+            uint64_t file_size;
+            uint32_t ref_count;
+            uint8_t algorithm;
+            uint8_t state;         // ٸ ʵ带     
+            uint16_t reserved0;
+            int64_t released_at;   //  0  ð (GC  )
+            uint8_t reserved[8];
+        };
+#pragma pack(pop)
+
+        ContentStore* ContentStore::instance_ = nullptr;
+        std::once_flag ContentStore::init_flag_;
+
+        ContentStore* ContentStore::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new ContentStore();
+            });
+            return instance_;
+        }
+
+        ContentStore::ContentStore() {
+            InitializeSRWLock(&store_lock_);
+        }
+
+        ContentStore::~ContentStore() {
+            Shutdown();
+        }
+
+        bool ContentStore::ContentKey::operator==(const ContentKey& other) const {
+            return algorithm == other.algorithm && file_size == other.file_size &&
+                memcmp(digest, other.digest, GetDigestSize(algorithm)) == 0;
+        }
+
+        size_t ContentStore::ContentKeyHash::operator()(const ContentKey& key) const {
+            // Ʈ ü  ̹Ƿ  8Ʈ 
+            uint64_t prefix;
+            memcpy(&prefix, key.digest, sizeof(prefix));
+            return static_cast<size_t>(prefix ^ (key.file_size * 0x9E3779B97F4A7C15ULL));
+        }
+
+        bool ContentStore::MakeKey(const std::string& file_hash, uint64_t file_size, ContentKey& out_key) {
+            if (!Common::Utils::IncrementalHash::DetectAlgorithm(file_hash, out_key.algorithm)) {
+                return false;
+            }
+
+            memset(out_key.digest, 0, sizeof(out_key.digest));
+            for (size_t i = 0; i < file_hash.size() / 2; ++i) {
+                int high = HexValue(file_hash[i * 2]);
+                int low = HexValue(file_hash[i * 2 + 1]);
+                if (high < 0 || low < 0) {
+                    return false;
+                }
+                out_key.digest[i] = static_cast<uint8_t>((high << 4) | low);
+            }
+            out_key.file_size = file_size;
+            return true;
+        }
+
+        ContentStore::IndexHeader* ContentStore::GetHeader() const {
+            return reinterpret_cast<IndexHeader*>(index_file_.GetData());
+        }
+
+        ContentStore::IndexEntry* ContentStore::GetEntry(uint32_t slot) const {
+            return reinterpret_cast<IndexEntry*>(index_file_.GetData() + sizeof(IndexHeader)) + slot;
+        }
+
+        std::string ContentStore::GetObjectPath(const ContentKey& key) const {
+            static const char* hex = "0123456789abcdef";
+            std::string name;
+            for (size_t i = 0; i < GetDigestSize(key.algorithm); ++i) {
+                name += hex[key.digest[i] >> 4];
+                name += hex[key.digest[i] & 0x0F];
+            }
+
+            // objects/< 2ڸ>/<ؽ>-<ũ>  ͸   л
+            return store_root_ + "/objects/" + name.substr(0, 2) + "/" + name + "-" + std::to_string(key.file_size);
+        }
+
+        bool ContentStore::Initialize(const std::string& store_root) {
+            static_assert(sizeof(IndexHeader) == 64, "index header must be 64 bytes");
+            static_assert(sizeof(IndexEntry) == 64, "index entry must be 64 bytes");
+
+            AcquireSRWLockExclusive(&store_lock_);
+
+            std::error_code ec;
+            std::filesystem::create_directories(store_root + "/objects", ec);
+
+            const std::string index_path = store_root + "/content.idx";
+            const bool exists = std::filesystem::exists(index_path, ec);
+            const uint64_t initial_size = exists ? 0 : sizeof(IndexHeader) + sizeof(IndexEntry) * INITIAL_CAPACITY;
+
+            if (ec || !index_file_.Open(index_path, initial_size)) {
+                ReleaseSRWLockExclusive(&store_lock_);
+                return false;
+            }
+
+            store_root_ = store_root;
+            slots_.clear();
+            free_slots_.clear();
+
+            IndexHeader* header = GetHeader();
+            const bool valid = index_file_.GetSize() >= sizeof(IndexHeader) &&
+                header->magic == INDEX_MAGIC && header->version == INDEX_VERSION &&
+                index_file_.GetSize() >= sizeof(IndexHeader) + sizeof(IndexEntry) * static_cast<uint64_t>(header->capacity) &&
+                header->used_slots <= header->capacity;
+
+            if (!valid) {
+                //  ε̰ų ջ ->  ε ʱȭ
+                if (index_file_.GetSize() < sizeof(IndexHeader) + sizeof(IndexEntry) * INITIAL_CAPACITY &&
+                    !index_file_.Resize(sizeof(IndexHeader) + sizeof(IndexEntry) * INITIAL_CAPACITY)) {
+                    index_file_.Close();
+                    ReleaseSRWLockExclusive(&store_lock_);
+                    return false;
+                }
+                header = GetHeader();
+                memset(index_file_.GetData(), 0, static_cast<size_t>(index_file_.GetSize()));
+                header->version = INDEX_VERSION;
+                header->capacity = INITIAL_CAPACITY;
+                header->magic = INDEX_MAGIC;
+            }
+
+            //  ý ǵ帮 ʰ ڵ 迭  ĵ
+            uint64_t stored_bytes = 0;
+            for (uint32_t slot = 0; slot < header->used_slots; ++slot) {
+                const IndexEntry* entry = GetEntry(slot);
+                if (entry->state != SLOT_LIVE) {
+                    free_slots_.push_back(slot);
+                    continue;
+                }
+
+                ContentKey key;
+                key.algorithm = static_cast<Common::Utils::HashAlgorithm>(entry->algorithm);
+                memcpy(key.digest, entry->digest, sizeof(key.digest));
+                key.file_size = entry->file_size;
+                slots_[key] = slot;
+                stored_bytes += entry->file_size;
+            }
+            header->stored_bytes = stored_bytes;
+            const size_t entry_count = slots_.size();
+
+            ReleaseSRWLockExclusive(&store_lock_);
+
+            STATS_SET_GAUGE("file.store_entries", static_cast<double>(entry_count));
+            return true;
+        }
+
+        void ContentStore::Shutdown() {
+            AcquireSRWLockExclusive(&store_lock_);
+            if (index_file_.IsOpen()) {
+                index_file_.Flush(true);
+                index_file_.Close();
+            }
+            slots_.clear();
+            free_slots_.clear();
+            ReleaseSRWLockExclusive(&store_lock_);
+        }
+
+        bool ContentStore::IsInitialized() const {
+            AcquireSRWLockShared(&store_lock_);
+            bool is_open = index_file_.IsOpen();
+            ReleaseSRWLockShared(&store_lock_);
+            return is_open;
+        }
+
+        bool ContentStore::GrowIndex() {
+            const uint32_t new_capacity = GetHeader()->capacity * 2;
+            if (!index_file_.Resize(sizeof(IndexHeader) + sizeof(IndexEntry) * static_cast<uint64_t>(new_capacity))) {
+                return false;
+            }
+            GetHeader()->capacity = new_capacity;
+            return true;
+        }
+
+        uint32_t ContentStore::AllocateSlot() {
+            if (!free_slots_.empty()) {
+                uint32_t slot = free_slots_.back();
+                free_slots_.pop_back();
+                return slot;
+            }
+
+            IndexHeader* header = GetHeader();
+            if (header->used_slots == header->capacity && !GrowIndex()) {
+                return UINT32_MAX;
+            }
+            return GetHeader()->used_slots++;
+        }
+
+        void ContentStore::FreeSlot(uint32_t slot) {
+            IndexEntry* entry = GetEntry(slot);
+            memset(entry, 0, sizeof(IndexEntry));
+            entry->state = SLOT_FREE;
+            free_slots_.push_back(slot);
+        }
+
+        bool ContentStore::AcquireExisting(const ContentKey& key, std::string& out_file_path) {
+            AcquireSRWLockExclusive(&store_lock_);
+
+            auto it = slots_.find(key);
+            if (it == slots_.end() || !index_file_.IsOpen()) {
+                ReleaseSRWLockExclusive(&store_lock_);
+                return false;
+            }
+
+            // ε   ˻ Ƿ     Ȯ (߸ ü   ó)
+            std::string path = GetObjectPath(key);
+            std::error_code ec;
+            const uintmax_t object_size = std::filesystem::file_size(path, ec);
+            if (ec || object_size != key.file_size) {
+                std::filesystem::remove(path, ec);
+                GetHeader()->stored_bytes -= key.file_size;
+                FreeSlot(it->second);
+                slots_.erase(it);
+                ReleaseSRWLockExclusive(&store_lock_);
+                STATS_INCREMENT("file.store_missing_objects");
+                return false;
+            }
+
+            IndexEntry* entry = GetEntry(it->second);
+            ++entry->ref_count;
+            entry->released_at = 0;
+            ReleaseSRWLockExclusive(&store_lock_);
+
+            out_file_path = std::move(path);
+            STATS_INCREMENT("file.dedup_hits");
+            Statistics::GetInstance()->IncrementCounter("file.dedup_saved_bytes", key.file_size);
+            return true;
+        }
+
+        bool ContentStore::Commit(const ContentKey& key, const std::string& temp_file_path, std::string& out_file_path) {
+            std::error_code ec;
+
+            AcquireSRWLockExclusive(&store_lock_);
+            if (!index_file_.IsOpen()) {
+                ReleaseSRWLockExclusive(&store_lock_);
+                return false;
+            }
+
+            const std::string path = GetObjectPath(key);
+
+            auto it = slots_.find(key);
+            if (it != slots_.end()) {
+                // ÿ   ö :    
+                IndexEntry* entry = GetEntry(it->second);
+                ++entry->ref_count;
+                entry->released_at = 0;
+                ReleaseSRWLockExclusive(&store_lock_);
+
+                std::filesystem::remove(temp_file_path, ec);
+                out_file_path = path;
+                STATS_INCREMENT("file.dedup_hits");
+                return true;
+            }
+
+            std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+            std::filesystem::rename(temp_file_path, path, ec);
+            if (ec) {
+                // ٸ ̸   
+                ec.clear();
+                std::filesystem::copy_file(temp_file_path, path,
+                    std::filesystem::copy_options::overwrite_existing, ec);
+                if (ec) {
+                    ReleaseSRWLockExclusive(&store_lock_);
+                    return false;
+                }
+                std::filesystem::remove(temp_file_path, ec);
+            }
+
+            const uint32_t slot = AllocateSlot();
+            if (slot == UINT32_MAX) {
+                ReleaseSRWLockExclusive(&store_lock_);
+                return false;
+            }
+
+            // ü   ű  ڵ带  state  
+            IndexEntry* entry = GetEntry(slot);
+            memcpy(entry->digest, key.digest, sizeof(entry->digest));
+            entry->file_size = key.file_size;
+            entry->ref_count = 1;
+            entry->algorithm = static_cast<uint8_t>(key.algorithm);
+            entry->released_at = 0;
+            entry->state = SLOT_LIVE;
+
+            slots_[key] = slot;
+            GetHeader()->stored_bytes += key.file_size;
+            const size_t entry_count = slots_.size();
+            ReleaseSRWLockExclusive(&store_lock_);
+
+            out_file_path = path;
+            STATS_SET_GAUGE("file.store_entries", static_cast<double>(entry_count));
+            return true;
+        }
+
+        void ContentStore::Release(const ContentKey& key) {
+            AcquireSRWLockExclusive(&store_lock_);
+            auto it = slots_.find(key);
+            if (it != slots_.end()) {
+                IndexEntry* entry = GetEntry(it->second);
+                if (entry->ref_count > 0 && --entry->ref_count == 0) {
+                    entry->released_at = GetUnixTime();
+                }
+            }
+            ReleaseSRWLockExclusive(&store_lock_);
+        }
+
+        bool ContentStore::Contains(const ContentKey& key) const {
+            AcquireSRWLockShared(&store_lock_);
+            bool found = slots_.find(key) != slots_.end();
+            ReleaseSRWLockShared(&store_lock_);
+            return found;
+        }
+
+        uint32_t ContentStore::GetRefCount(const ContentKey& key) const {
+            AcquireSRWLockShared(&store_lock_);
+            auto it = slots_.find(key);
+            uint32_t ref_count = (it != slots_.end()) ? GetEntry(it->second)->ref_count : 0;
+            ReleaseSRWLockShared(&store_lock_);
+            return ref_count;
+        }
+
+        size_t ContentStore::CollectGarbage(std::chrono::seconds grace_period) {
+            const int64_t deadline = GetUnixTime() - grace_period.count();
+            size_t collected = 0;
+
+            // ϵ  ȿ .  ۿ      Commit ü ϱ 
+            // (ü ΰ  Ƿ  ü  ü  )
+            AcquireSRWLockExclusive(&store_lock_);
+            std::error_code ec;
+            for (auto it = slots_.begin(); it != slots_.end();) {
+                IndexEntry* entry = GetEntry(it->second);
+                if (entry->ref_count == 0 && entry->released_at <= deadline) {
+                    std::filesystem::remove(GetObjectPath(it->first), ec);
+                    GetHeader()->stored_bytes -= entry->file_size;
+                    FreeSlot(it->second);
+                    it = slots_.erase(it);
+                    ++collected;
+                }
+                else {
+                    ++it;
+                }
+            }
+            const size_t entry_count = slots_.size();
+            ReleaseSRWLockExclusive(&store_lock_);
+
+            if (collected > 0) {
+                Statistics::GetInstance()->IncrementCounter("file.store_collected", collected);
+                STATS_SET_GAUGE("file.store_entries", static_cast<double>(entry_count));
+            }
+            return collected;
+        }
+
+        size_t ContentStore::GetEntryCount() const {
+            AcquireSRWLockShared(&store_lock_);
+            size_t count = slots_.size();
+            ReleaseSRWLockShared(&store_lock_);
+            return count;
+        }
+
+        uint64_t ContentStore::GetStoredBytes() const {
+            AcquireSRWLockShared(&store_lock_);
+            uint64_t bytes = index_file_.IsOpen() ? GetHeader()->stored_bytes : 0;
+            ReleaseSRWLockShared(&store_lock_);
+            return bytes;
+        }
+
+        uint64_t ContentStore::GetLogicalBytes() const {
+            AcquireSRWLockShared(&store_lock_);
+            uint64_t bytes = 0;
+            for (const auto& entry : slots_) {
+                bytes += GetEntry(entry.second)->file_size * GetEntry(entry.second)->ref_count;
+            }
+            ReleaseSRWLockShared(&store_lock_);
+            return bytes;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
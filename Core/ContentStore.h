@@ -0,0 +1,91 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include "../Common/MappedFile.h"
+#include "../Common/HashContext.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        //  ּ    (ؽ + ũ ߺ )
+        //   ũ   ϰ   Ѵ.
+        // ε  ũ ڵ 迭 ޸  ̶    ĵ   ȴ.
+        class ContentStore {
+        public:
+            static ContentStore* GetInstance();
+
+            struct ContentKey {
+                Common::Utils::HashAlgorithm algorithm;
+                uint8_t digest[32];  // MD5  16Ʈ 
+                uint64_t file_size;
+
+                bool operator==(const ContentKey& other) const;
+            };
+
+            struct ContentKeyHash {
+                size_t operator()(const ContentKey& key) const;
+            };
+
+            // 16 ؽ ڿ Ű ȯ ( ߸Ǹ false)
+            static bool MakeKey(const std::string& file_hash, uint64_t file_size, ContentKey& out_key);
+
+            //   (ε ,    ׸ )
+            bool Initialize(const std::string& store_root);
+            void Shutdown();
+            bool IsInitialized() const;
+
+            // ̹  ̸  ϳ ø  ȯ (ε )
+            // Ű δ  ؽ/ũ⸦ ״ ϴ´.   ʰ  ֹǷ
+            // ؽÿ ũ⸸ ˸     ޵ȴ ( ̸ file.dedup_enabled ).
+            //     ü  ũ⸸ Ȯϰ,  Commit    .
+            bool AcquireExisting(const ContentKey& key, std::string& out_file_path);
+
+            //   ӽ  ҷ ̵ϰ  ߰. ̹  ӽ  
+            bool Commit(const ContentKey& key, const std::string& temp_file_path, std::string& out_file_path);
+
+            //  .  0    ð  CollectGarbage 
+            void Release(const ContentKey& key);
+
+            bool Contains(const ContentKey& key) const;
+            uint32_t GetRefCount(const ContentKey& key) const;
+
+            //  0̰ grace_period ̻   .  ׸  ȯ
+            size_t CollectGarbage(std::chrono::seconds grace_period);
+
+            // 
+            size_t GetEntryCount() const;
+            uint64_t GetStoredBytes() const;  // ũ   Ʈ
+            uint64_t GetLogicalBytes() const; //   ݿ  Ʈ (ߺ  )
+
+        private:
+            ContentStore();
+            ~ContentStore();
+
+            struct IndexHeader;
+            struct IndexEntry;
+
+            IndexHeader* GetHeader() const;
+            IndexEntry* GetEntry(uint32_t slot) const;
+            uint32_t AllocateSlot();
+            bool GrowIndex();
+            void FreeSlot(uint32_t slot);
+            std::string GetObjectPath(const ContentKey& key) const;
+
+            mutable SRWLOCK store_lock_;
+            std::string store_root_;
+            Common::MappedFile index_file_;
+            std::unordered_map<ContentKey, uint32_t, ContentKeyHash> slots_; // Ű -> ε 
+            std::vector<uint32_t> free_slots_;
+
+            static ContentStore* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
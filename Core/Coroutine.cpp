@@ -0,0 +1,322 @@
+#include "pch.h"
+#include "Coroutine.h"
+#include "EpochReclaimer.h"
+#include "Statistics.h"
+
+#include <new>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace NexusCore {
+    namespace Core {
+
+        // ===== CoroutineFramePool =====
+
+        namespace {
+            std::atomic<uint64_t> frames_allocated{ 0 };
+            std::atomic<uint64_t> frames_reused{ 0 };
+            std::atomic<size_t> frames_live{ 0 };
+
+            // ݳ  ڸ    ּҸ  
+            struct FreeFrame {
+                FreeFrame* next;
+            };
+
+            struct FrameCache {
+                FreeFrame* heads[CoroutineFramePool::SIZE_CLASS_COUNT] = {};
+                size_t counts[CoroutineFramePool::SIZE_CLASS_COUNT] = {};
+
+                ~FrameCache() {
+                    for (FreeFrame* head : heads) {
+                        while (head) {
+                            FreeFrame* next = head->next;
+                            ::operator delete(head);
+                            head = next;
+                        }
+                    }
+                }
+            };
+
+            thread_local FrameCache frame_cache;
+
+            // ũ  ( ̸ SIZE_CLASS_COUNT)
+            size_t GetSizeClass(size_t size) {
+                size_t class_size = CoroutineFramePool::MIN_FRAME_SIZE;
+                for (size_t size_class = 0; size_class < CoroutineFramePool::SIZE_CLASS_COUNT; ++size_class) {
+                    if (size <= class_size) {
+                        return size_class;
+                    }
+                    class_size <<= 1;
+                }
+                return CoroutineFramePool::SIZE_CLASS_COUNT;
+            }
+        }
+
+        void* CoroutineFramePool::Allocate(size_t size) {
+            ++frames_live;
+            const size_t size_class = GetSizeClass(size);
+            if (size_class == SIZE_CLASS_COUNT) {
+                ++frames_allocated;
+                return ::operator new(size);
+            }
+
+            FreeFrame*& head = frame_cache.heads[size_class];
+            if (head) {
+                FreeFrame* frame = head;
+                head = frame->next;
+                --frame_cache.counts[size_class];
+                ++frames_reused;
+                return frame;
+            }
+
+            ++frames_allocated;
+            return ::operator new(MIN_FRAME_SIZE << size_class);
+        }
+
+        void CoroutineFramePool::Deallocate(void* frame, size_t size) {
+            --frames_live;
+            const size_t size_class = GetSizeClass(size);
+            // ٸ 忡       (   ݳ)
+            if (size_class == SIZE_CLASS_COUNT || frame_cache.counts[size_class] >= MAX_CACHED_PER_CLASS) {
+                ::operator delete(frame);
+                return;
+            }
+
+            auto* free_frame = static_cast<FreeFrame*>(frame);
+            free_frame->next = frame_cache.heads[size_class];
+            frame_cache.heads[size_class] = free_frame;
+            ++frame_cache.counts[size_class];
+        }
+
+        uint64_t CoroutineFramePool::GetAllocatedCount() {
+            return frames_allocated;
+        }
+
+        uint64_t CoroutineFramePool::GetReusedCount() {
+            return frames_reused;
+        }
+
+        size_t CoroutineFramePool::GetLiveCount() {
+            return frames_live;
+        }
+
+        // ===== Task  =====
+
+        namespace {
+            //    ϴ ֻ ڷƾ
+            struct DetachedTask {
+                struct promise_type : Detail::PromiseBase {
+                    DetachedTask get_return_object() { return {}; }
+                    std::suspend_never initial_suspend() noexcept { return {}; }
+                    std::suspend_never final_suspend() noexcept { return {}; }
+                    void return_void() {}
+                    void unhandled_exception() { std::terminate(); }
+                };
+            };
+
+            DetachedTask RunDetached(Task<bool> task, std::function<void(bool)> on_complete) {
+                const bool result = co_await task;
+                if (on_complete) {
+                    on_complete(result);
+                }
+            }
+        }
+
+        void SpawnTask(Task<bool> task, std::function<void(bool)> on_complete) {
+            RunDetached(std::move(task), std::move(on_complete));
+        }
+
+        Detail::ResumeTarget Detail::ResumeTarget::Capture() {
+            ResumeTarget target;
+            if (TaskStrand* strand = TaskStrand::GetCurrent()) {
+                target.strand_ = strand->shared_from_this();
+            }
+            return target;
+        }
+
+        void Detail::ResumeTarget::Resume(std::coroutine_handle<> handle) const {
+            auto resume = [handle]() {
+                EpochGuard guard;
+                handle.resume();
+            };
+
+            if (strand_) {
+                strand_->Post(std::move(resume));
+            }
+            else {
+                TaskScheduler::GetInstance()->Submit(std::move(resume));
+            }
+        }
+
+        void YieldAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+            Detail::ResumeTarget::Capture().Resume(handle);
+        }
+
+        // ===== CoroutineTimer =====
+
+        CoroutineTimer* CoroutineTimer::instance_ = nullptr;
+        std::once_flag CoroutineTimer::init_flag_;
+
+        CoroutineTimer* CoroutineTimer::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new CoroutineTimer();
+            });
+            return instance_;
+        }
+
+        CoroutineTimer::~CoroutineTimer() {
+            Stop();
+        }
+
+        void CoroutineTimer::Start() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (is_running_.exchange(true)) {
+                return;
+            }
+            timer_thread_ = std::thread(&CoroutineTimer::TimerLoop, this);
+        }
+
+        void CoroutineTimer::Stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!is_running_.exchange(false)) {
+                    return;
+                }
+            }
+            wake_cv_.notify_one();
+            if (timer_thread_.joinable()) {
+                timer_thread_.join();
+            }
+
+            std::vector<Callback> remaining;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                while (!entries_.empty()) {
+                    remaining.push_back(std::move(const_cast<Entry&>(entries_.top()).callback));
+                    entries_.pop();
+                }
+            }
+            for (auto& callback : remaining) {
+                callback();
+            }
+        }
+
+        void CoroutineTimer::Schedule(Clock::time_point due, Callback callback) {
+            if (!is_running_) {
+                Start();
+            }
+
+            bool is_earliest = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                is_earliest = entries_.empty() || due < entries_.top().due;
+                entries_.push({ due, next_sequence_++, std::move(callback) });
+            }
+            if (is_earliest) {
+                wake_cv_.notify_one();
+            }
+        }
+
+        size_t CoroutineTimer::GetPendingCount() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+        void CoroutineTimer::TimerLoop() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (is_running_) {
+                if (entries_.empty()) {
+                    wake_cv_.wait(lock);
+                    continue;
+                }
+
+                const auto due = entries_.top().due;
+                if (Clock::now() < due) {
+                    //  ̸ Ÿ̸Ӱ ų ߸  ٽ 
+                    wake_cv_.wait_until(lock, due);
+                    continue;
+                }
+
+                Callback callback = std::move(const_cast<Entry&>(entries_.top()).callback);
+                entries_.pop();
+
+                lock.unlock();
+                callback();
+                lock.lock();
+            }
+        }
+
+        void DelayAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+            CoroutineTimer::GetInstance()->Schedule(CoroutineTimer::Clock::now() + delay_,
+                [target = Detail::ResumeTarget::Capture(), handle]() { target.Resume(handle); });
+        }
+
+        // ===== FileReadAwaiter =====
+
+        bool FileReadAwaiter::await_suspend(std::coroutine_handle<> handle) {
+            out_.resize(length_);
+            handle_ = handle;
+            target_ = Detail::ResumeTarget::Capture();
+
+#ifdef _WIN32
+            overlapped_ = {};
+            overlapped_.Offset = static_cast<DWORD>(offset_ & 0xFFFFFFFF);
+            overlapped_.OffsetHigh = static_cast<DWORD>(offset_ >> 32);
+            overlapped_.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+            if (!overlapped_.hEvent) {
+                Finish(false, 0);
+                return false;
+            }
+
+            if (!ReadFile(file_->GetNativeHandle(), out_.data(), length_, nullptr, &overlapped_) &&
+                GetLastError() != ERROR_IO_PENDING) {
+                CloseHandle(overlapped_.hEvent);
+                Finish(false, 0);
+                return false;
+            }
+
+            // Ϸ ̺Ʈ  Ǯ ⿡ ɾ  (  ϳ  б⸦ Բ ٸ)
+            wait_ = CreateThreadpoolWait(&FileReadAwaiter::OnReadSignaled, this, nullptr);
+            if (!wait_) {
+                DWORD bytes_read = 0;
+                const bool success = GetOverlappedResult(file_->GetNativeHandle(), &overlapped_, &bytes_read, TRUE) != FALSE;
+                CloseHandle(overlapped_.hEvent);
+                Finish(success, bytes_read);
+                return false;
+            }
+            SetThreadpoolWait(wait_, overlapped_.hEvent, nullptr);
+            return true;
+#else
+            const ssize_t bytes_read = pread(file_->GetNativeHandle(), out_.data(), length_, static_cast<off_t>(offset_));
+            Finish(bytes_read >= 0, bytes_read > 0 ? static_cast<size_t>(bytes_read) : 0);
+            return false;
+#endif
+        }
+
+#ifdef _WIN32
+        void CALLBACK FileReadAwaiter::OnReadSignaled(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WAIT wait, TP_WAIT_RESULT) {
+            auto* awaiter = static_cast<FileReadAwaiter*>(context);
+
+            DWORD bytes_read = 0;
+            const bool success = GetOverlappedResult(awaiter->file_->GetNativeHandle(), &awaiter->overlapped_,
+                &bytes_read, FALSE) != FALSE;
+            CloseHandle(awaiter->overlapped_.hEvent);
+            CloseThreadpoolWait(wait);
+
+            awaiter->Finish(success, bytes_read);
+            awaiter->target_.Resume(awaiter->handle_); //  awaiter ڷƾ 簳Ǹ   
+        }
+#endif
+
+        void FileReadAwaiter::Finish(bool success, size_t bytes_read) {
+            success_ = success;
+            out_.resize(success ? bytes_read : 0);
+            if (success) {
+                Statistics::GetInstance()->IncrementCounter("coroutine.file_read_bytes", bytes_read);
+            }
+        }
+
+    } // namespace Core
+} // namespace NexusCore
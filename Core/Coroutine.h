@@ -0,0 +1,355 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <memory>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include "TaskScheduler.h"
+#include "SharedFile.h"
+#include "Session.h"
+#include "ChatRoom.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // ڷƾ  Ǯ
+        // ߴܵ ڵ鷯    ϳ Ѵ.  ũ⺰(256/512/1024/2048)   Ͽ
+        // ϰ, ׺ ũų    Ϲ  .
+        class CoroutineFramePool {
+        public:
+            static constexpr size_t MIN_FRAME_SIZE = 256;
+            static constexpr size_t SIZE_CLASS_COUNT = 4;
+            static constexpr size_t MAX_CACHED_PER_CLASS = 1024; //  ũ⺰  
+
+            static void* Allocate(size_t size);
+            static void Deallocate(void* frame, size_t size);
+
+            static uint64_t GetAllocatedCount(); // Ǯ    Ҵ 
+            static uint64_t GetReusedCount();
+            static size_t GetLiveCount();        //    ڷƾ 
+        };
+
+        template<typename T>
+        class Task;
+
+        namespace Detail {
+
+            class PromiseBase {
+            public:
+                static void* operator new(size_t size) { return CoroutineFramePool::Allocate(size); }
+                static void operator delete(void* frame, size_t size) { CoroutineFramePool::Deallocate(frame, size); }
+
+                //  : co_await ǰų SpawnTask Ѱ  
+                std::suspend_always initial_suspend() noexcept { return {}; }
+
+                //  ٸ ڷƾ ٷ Ѿ (  )
+                struct FinalAwaiter {
+                    bool await_ready() const noexcept { return false; }
+
+                    template<typename Promise>
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                        std::coroutine_handle<> continuation = handle.promise().continuation_;
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+
+                FinalAwaiter final_suspend() noexcept { return {}; }
+                void unhandled_exception() { exception_ = std::current_exception(); }
+
+                void SetContinuation(std::coroutine_handle<> continuation) { continuation_ = continuation; }
+
+            protected:
+                void RethrowIfFailed() const {
+                    if (exception_) {
+                        std::rethrow_exception(exception_);
+                    }
+                }
+
+            private:
+                std::coroutine_handle<> continuation_;
+                std::exception_ptr exception_;
+            };
+
+            template<typename T>
+            class TaskPromise : public PromiseBase {
+            public:
+                Task<T> get_return_object();
+                void return_value(T value) { value_.emplace(std::move(value)); }
+
+                T TakeResult() {
+                    RethrowIfFailed();
+                    return std::move(*value_);
+                }
+
+            private:
+                std::optional<T> value_;
+            };
+
+            template<>
+            class TaskPromise<void> : public PromiseBase {
+            public:
+                Task<void> get_return_object();
+                void return_void() {}
+                void TakeResult() { RethrowIfFailed(); }
+            };
+
+            // ߴܵ ڷƾ ٽ  
+            // Ʈ ȿ ߴ  Ʈ( Ŷ   ϳ), ƴϸ ٷ.
+            // 簳  EpochGuard ȿ ȴ.
+            class ResumeTarget {
+            public:
+                static ResumeTarget Capture();
+                void Resume(std::coroutine_handle<> handle) const;
+
+            private:
+                std::shared_ptr<TaskStrand> strand_;
+            };
+
+        } // namespace Detail
+
+        // ڷƾ  ( ,   co_await)
+        template<typename T = void>
+        class [[nodiscard]] Task {
+        public:
+            using promise_type = Detail::TaskPromise<T>;
+            using Handle = std::coroutine_handle<promise_type>;
+
+            Task() = default;
+            explicit Task(Handle handle) : handle_(handle) {}
+            Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+            Task& operator=(Task&& other) noexcept {
+                if (this != &other) {
+                    if (handle_) {
+                        handle_.destroy();
+                    }
+                    handle_ = std::exchange(other.handle_, nullptr);
+                }
+                return *this;
+            }
+
+            ~Task() {
+                if (handle_) {
+                    handle_.destroy();
+                }
+            }
+
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            bool IsValid() const { return handle_ != nullptr; }
+
+            bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle_.promise().SetContinuation(awaiting);
+                return handle_;
+            }
+
+            T await_resume() { return handle_.promise().TakeResult(); }
+
+        private:
+            Handle handle_;
+        };
+
+        template<typename T>
+        Task<T> Detail::TaskPromise<T>::get_return_object() {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> Detail::TaskPromise<void>::get_return_object() {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+
+        // ٸ   ڷƾ  (Ŷ ڵ鷯 ). ȣ 忡 ù ߴ  ϰ,
+        //  on_complete  Բ ȣ. ó  ܴ std::terminate
+        void SpawnTask(Task<bool> task, std::function<void(bool)> on_complete = nullptr);
+
+        // =====  ü =====
+
+        //   ġ(Ʈ/ٷ) ٽ ְ ٸ ۾ ʸ ѱ
+        class YieldAwaiter {
+        public:
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) const;
+            void await_resume() const noexcept {}
+        };
+
+        inline YieldAwaiter Yield() { return {}; }
+
+        // ڷƾ Ÿ̸ (Ÿ̸  ϳ   , ݹ ª 簳 ۾ )
+        class CoroutineTimer {
+        public:
+            using Clock = std::chrono::steady_clock;
+            using Callback = std::function<void()>;
+
+            static CoroutineTimer* GetInstance();
+
+            void Start();
+            void Stop(); //  Ÿ̸Ӵ   (ߴܵ   ʰ)
+
+            //  ð callback .   ƴϸ 
+            void Schedule(Clock::time_point due, Callback callback);
+            size_t GetPendingCount() const;
+
+        private:
+            CoroutineTimer() = default;
+            ~CoroutineTimer();
+
+            struct Entry {
+                Clock::time_point due;
+                uint64_t sequence; //    
+                Callback callback;
+
+                bool operator>(const Entry& other) const {
+                    return due != other.due ? due > other.due : sequence > other.sequence;
+                }
+            };
+
+            void TimerLoop();
+
+            mutable std::mutex mutex_;
+            std::condition_variable wake_cv_;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> entries_;
+            uint64_t next_sequence_ = 0;
+
+            std::thread timer_thread_;
+            std::atomic<bool> is_running_{ false };
+
+            static CoroutineTimer* instance_;
+            static std::once_flag init_flag_;
+        };
+
+        class DelayAwaiter {
+        public:
+            explicit DelayAwaiter(std::chrono::milliseconds delay) : delay_(delay) {}
+
+            bool await_ready() const noexcept { return delay_.count() <= 0; }
+            void await_suspend(std::coroutine_handle<> handle) const;
+            void await_resume() const noexcept {}
+
+        private:
+            std::chrono::milliseconds delay_;
+        };
+
+        inline DelayAwaiter Delay(std::chrono::milliseconds delay) { return DelayAwaiter(delay); }
+
+        //   б. Windows overlapped ReadFile ϷḦ  Ǯ  ޾ 簳ϰ,
+        //   ÷ pread ٷ о ߴ ʴ´.    (out  ŭ)
+        class FileReadAwaiter {
+        public:
+            FileReadAwaiter(std::shared_ptr<SharedFile> file, uint64_t offset, uint32_t length, std::vector<char>& out)
+                : file_(std::move(file)), offset_(offset), length_(length), out_(out) {
+            }
+
+            bool await_ready() const noexcept { return !file_ || length_ == 0; }
+            bool await_suspend(std::coroutine_handle<> handle); // ٷ  false (ߴ  )
+            bool await_resume() const noexcept { return file_ != nullptr && (length_ == 0 || success_); }
+
+        private:
+            void Finish(bool success, size_t bytes_read);
+#ifdef _WIN32
+            static void CALLBACK OnReadSignaled(PTP_CALLBACK_INSTANCE instance, PVOID context, PTP_WAIT wait, TP_WAIT_RESULT result);
+
+            OVERLAPPED overlapped_{};
+            PTP_WAIT wait_ = nullptr;
+#endif
+            std::shared_ptr<SharedFile> file_;
+            uint64_t offset_;
+            uint32_t length_;
+            std::vector<char>& out_;
+            bool success_ = false;
+
+            Detail::ResumeTarget target_;
+            std::coroutine_handle<> handle_;
+        };
+
+        inline FileReadAwaiter ReadFileAsync(std::shared_ptr<SharedFile> file, uint64_t offset, uint32_t length,
+            std::vector<char>& out) {
+            return FileReadAwaiter(std::move(file), offset, length, out);
+        }
+
+        // ۽ ť ø.  ۽ IOCP  óϹǷ ť ö  ,
+        //  PostSend  (  false)
+        class SendAwaiter {
+        public:
+            SendAwaiter(Session* session, SharedPacket packet) : session_(session), packet_(std::move(packet)) {}
+
+            bool await_ready() const noexcept { return true; }
+            void await_suspend(std::coroutine_handle<>) const noexcept {}
+            bool await_resume() { return session_ && packet_ && session_->PostSend(std::move(packet_)); }
+
+        private:
+            Session* session_;
+            SharedPacket packet_;
+        };
+
+        inline SendAwaiter SendAsync(Session* session, SharedPacket packet) { return SendAwaiter(session, std::move(packet)); }
+
+        // ٸ  ¿ func(room) ϰ  
+        //   ̸  Ϲڽ ϴ  ߴܵǰ, ƴϸ ٷ Ѵ.
+        template<typename Func>
+        class RoomCallAwaiter {
+        public:
+            using Result = std::invoke_result_t<Func&, ChatRoom&>;
+
+            RoomCallAwaiter(ChatRoom* room, Func func) : room_(room), func_(std::move(func)) {}
+
+            bool await_ready() const noexcept { return !room_->IsActorMode(); }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                target_ = Detail::ResumeTarget::Capture();
+                room_->Post([this, handle]() {
+                    Invoke();
+                    target_.Resume(handle);
+                });
+            }
+
+            Result await_resume() {
+                if (!is_done_) {
+                    Invoke();
+                }
+                if constexpr (!std::is_void_v<Result>) {
+                    return std::move(*result_);
+                }
+            }
+
+        private:
+            void Invoke() {
+                if constexpr (std::is_void_v<Result>) {
+                    func_(*room_);
+                }
+                else {
+                    result_.emplace(func_(*room_));
+                }
+                is_done_ = true;
+            }
+
+            ChatRoom* room_;
+            Func func_;
+            std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>> result_;
+            bool is_done_ = false;
+            Detail::ResumeTarget target_;
+        };
+
+        template<typename Func>
+        RoomCallAwaiter<Func> CallRoom(ChatRoom* room, Func func) {
+            return RoomCallAwaiter<Func>(room, std::move(func));
+        }
+
+    } // namespace Core
+} // namespace NexusCore
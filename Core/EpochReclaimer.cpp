@@ -0,0 +1,163 @@
+#include "pch.h"
+#include "EpochReclaimer.h"
+#include "Statistics.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            // 庰 . 尡   ݳ
+            struct ThreadEpochState {
+                std::atomic<bool>* slot_in_use = nullptr;
+                std::atomic<uint64_t>* slot_state = nullptr;
+                uint32_t depth = 0;
+                bool is_overflow = false;
+
+                ~ThreadEpochState() {
+                    if (slot_in_use) {
+                        slot_in_use->store(false, std::memory_order_release);
+                    }
+                }
+            };
+
+            thread_local ThreadEpochState thread_state;
+        }
+
+        EpochReclaimer* EpochReclaimer::instance_ = nullptr;
+        std::once_flag EpochReclaimer::init_flag_;
+
+        EpochReclaimer* EpochReclaimer::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new EpochReclaimer();
+            });
+            return instance_;
+        }
+
+        EpochReclaimer::EpochReclaimer() = default;
+
+        EpochReclaimer::~EpochReclaimer() {
+            for (auto& object : retired_) {
+                object.deleter();
+            }
+        }
+
+        std::atomic<uint64_t>* EpochReclaimer::AcquireSlot() {
+            if (thread_state.slot_state) {
+                return thread_state.slot_state;
+            }
+
+            for (auto& slot : slots_) {
+                bool expected = false;
+                if (!slot.in_use.load(std::memory_order_relaxed) &&
+                    slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    thread_state.slot_state = &slot.state;
+                    thread_state.slot_in_use = &slot.in_use;
+                    return &slot.state;
+                }
+            }
+            return nullptr;
+        }
+
+        void EpochReclaimer::Enter() {
+            if (thread_state.depth++ > 0) {
+                return;
+            }
+
+            std::atomic<uint64_t>* slot_state = AcquireSlot();
+            if (slot_state) {
+                slot_state->store(global_epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            else {
+                thread_state.is_overflow = true;
+                overflow_readers_.fetch_add(1, std::memory_order_relaxed);
+            }
+            // ũ ǥð    б⺸  ̰ 
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void EpochReclaimer::Exit() {
+            if (--thread_state.depth > 0) {
+                return;
+            }
+
+            if (thread_state.is_overflow) {
+                thread_state.is_overflow = false;
+                overflow_readers_.fetch_sub(1, std::memory_order_release);
+            }
+            else {
+                thread_state.slot_state->store(0, std::memory_order_release);
+            }
+        }
+
+        void EpochReclaimer::Retire(std::function<void()> deleter) {
+            bool should_reclaim = false;
+            {
+                std::lock_guard<std::mutex> lock(retired_mutex_);
+                retired_.push_back({ global_epoch_.load(std::memory_order_acquire), std::move(deleter) });
+                should_reclaim = retired_.size() >= RECLAIM_THRESHOLD;
+            }
+            if (should_reclaim) {
+                Reclaim();
+            }
+        }
+
+        bool EpochReclaimer::TryAdvance() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+            if (overflow_readers_.load(std::memory_order_acquire) > 0) {
+                return false;
+            }
+            for (const auto& slot : slots_) {
+                const uint64_t state = slot.state.load(std::memory_order_acquire);
+                if (state != 0 && state != epoch) {
+                    return false; //  ũ д  尡 
+                }
+            }
+
+            global_epoch_.store(epoch + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t EpochReclaimer::Reclaim() {
+            std::vector<RetiredObject> reclaimable;
+            {
+                std::lock_guard<std::mutex> lock(retired_mutex_);
+                // д 尡       ܰ 
+                if (TryAdvance()) {
+                    TryAdvance();
+                }
+
+                // Խ   ũ     ü  б   
+                const uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+                auto keep = retired_.begin();
+                for (auto it = retired_.begin(); it != retired_.end(); ++it) {
+                    if (it->epoch + 2 <= epoch) {
+                        reclaimable.push_back(std::move(*it));
+                    }
+                    else {
+                        if (keep != it) {
+                            *keep = std::move(*it);
+                        }
+                        ++keep;
+                    }
+                }
+                retired_.erase(keep, retired_.end());
+            }
+
+            for (auto& object : reclaimable) {
+                object.deleter();
+            }
+            if (!reclaimable.empty()) {
+                Statistics::GetInstance()->IncrementCounter("epoch.reclaimed", reclaimable.size());
+            }
+            return reclaimable.size();
+        }
+
+        size_t EpochReclaimer::GetRetiredCount() const {
+            std::lock_guard<std::mutex> lock(retired_mutex_);
+            return retired_.size();
+        }
+
+    } // namespace Core
+} // namespace NexusCore
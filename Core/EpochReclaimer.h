@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        // ũ  ޸ ȸ (EBR)
+        // д  EpochGuard  ǥϰ    ü д´.
+        //    ü Խ   ü Retire ѱ,   д 尡
+        //    ( ũ    ) ȴ.
+        class EpochReclaimer {
+        public:
+            static EpochReclaimer* GetInstance();
+
+            static constexpr size_t MAX_THREAD_SLOTS = 256;
+            static constexpr size_t RECLAIM_THRESHOLD = 64; //   ü ̸ŭ ̸ ȸ õ
+
+            // б  (ø ). EpochGuard 
+            void Enter();
+            void Exit();
+
+            //  ̻   ʴ ü  ̷
+            void Retire(std::function<void()> deleter);
+
+            template<typename T>
+            void Retire(const T* object) {
+                if (object) {
+                    Retire([object]() { delete object; });
+                }
+            }
+
+            // ũ     ü .   ȯ
+            size_t Reclaim();
+
+            uint64_t GetEpoch() const { return global_epoch_; }
+            size_t GetRetiredCount() const;
+
+        private:
+            EpochReclaimer();
+            ~EpochReclaimer();
+
+            // 帶 ϳ. state 0̸  , ƴϸ      ũ
+            struct alignas(64) ThreadSlot {
+                std::atomic<uint64_t> state{ 0 };
+                std::atomic<bool> in_use{ false };
+            };
+
+            struct RetiredObject {
+                uint64_t epoch;
+                std::function<void()> deleter;
+            };
+
+            std::atomic<uint64_t>* AcquireSlot(); // ȣ   state ( ڶ nullptr)
+            bool TryAdvance(); // retired_mutex_ ȿ ȣ
+
+            ThreadSlot slots_[MAX_THREAD_SLOTS];
+            std::atomic<uint32_t> overflow_readers_{ 0 }; //     (ִ  ũ   )
+            std::atomic<uint64_t> global_epoch_{ 1 };
+
+            mutable std::mutex retired_mutex_;
+            std::vector<RetiredObject> retired_;
+
+            static EpochReclaimer* instance_;
+            static std::once_flag init_flag_;
+        };
+
+        // б  RAII
+        class EpochGuard {
+        public:
+            EpochGuard() { EpochReclaimer::GetInstance()->Enter(); }
+            ~EpochGuard() { EpochReclaimer::GetInstance()->Exit(); }
+
+            EpochGuard(const EpochGuard&) = delete;
+            EpochGuard& operator=(const EpochGuard&) = delete;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,262 @@
+#include "pch.h"
+#include "FileDownload.h"
+#include "Session.h"
+#include "Statistics.h"
+#include "../Common/Config.h"
+#include "../Common/Utils.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace NexusCore {
+    namespace Core {
+
+        FileDownloadManager* FileDownloadManager::instance_ = nullptr;
+        std::once_flag FileDownloadManager::init_flag_;
+
+        FileDownloadManager* FileDownloadManager::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new FileDownloadManager();
+            });
+            return instance_;
+        }
+
+        FileDownloadManager::FileDownloadManager() {
+            InitializeSRWLock(&downloads_lock_);
+        }
+
+        FileDownloadManager::~FileDownloadManager() = default;
+
+        bool FileDownloadManager::IsPathAllowed(const std::string& file_path) const {
+            // ε      
+            // ڿ λ簡 ƴ϶ ȭ   ҷ  ("uploads_private/x", "uploads/../x" ź)
+            const std::string root = Common::Config::GetInstance()->GetString("file.storage_root", "uploads");
+
+            std::error_code ec;
+            std::filesystem::path root_path = std::filesystem::weakly_canonical(root, ec);
+            if (ec) {
+                return false;
+            }
+            if (!root_path.has_filename()) {
+                root_path = root_path.parent_path(); //   
+            }
+            const std::filesystem::path target = std::filesystem::weakly_canonical(file_path, ec);
+            if (ec) {
+                return false;
+            }
+
+            const std::filesystem::path relative = target.lexically_relative(root_path);
+            return !relative.empty() && relative != "." && *relative.begin() != "..";
+        }
+
+        std::shared_ptr<SharedFile> FileDownloadManager::AcquireFile(const std::string& file_path) {
+            std::lock_guard<std::mutex> lock(open_files_mutex_);
+
+            //  ִ ڵ̶ ũ  ٲ   (  ٿε  ڵ )
+            auto it = open_files_.find(file_path);
+            if (it != open_files_.end()) {
+                if (auto file = it->second.lock()) {
+                    if (file->IsCurrent()) {
+                        return file;
+                    }
+                    STATS_INCREMENT("file.download_reopened");
+                }
+            }
+
+            auto file = SharedFile::Open(file_path);
+            if (file) {
+                open_files_[file_path] = file;
+            }
+            else if (it != open_files_.end()) {
+                open_files_.erase(it);
+            }
+            return file;
+        }
+
+        int32_t FileDownloadManager::StartDownload(Session* session, const std::string& file_path,
+            uint64_t offset, uint64_t length, uint64_t if_version, DownloadInfo& out_info) {
+            if (!IsPathAllowed(file_path)) {
+                return Protocol::ErrorCode::INSUFFICIENT_PERMISSION;
+            }
+
+            auto file = AcquireFile(file_path);
+            if (!file) {
+                return Protocol::ErrorCode::FILE_NOT_FOUND;
+            }
+            if (if_version != 0 && if_version != file->GetVersion()) {
+                return Protocol::ErrorCode::FILE_VERSION_CHANGED;
+            }
+            if (offset > file->GetSize()) {
+                return Protocol::ErrorCode::INVALID_FILE_RANGE;
+            }
+
+            const uint64_t available = file->GetSize() - offset;
+            const uint64_t range_length = (length == 0) ? available : std::min(length, available);
+
+            auto info = std::make_unique<DownloadInfo>();
+            info->download_id = next_download_id_.fetch_add(1);
+            info->session_id = session->GetSessionId();
+            info->file = std::move(file);
+            info->range_begin = offset;
+            info->range_end = offset + range_length;
+            info->next_offset = offset;
+            info->bytes_sent = 0;
+            info->frames_in_flight = 0;
+
+            out_info = *info;
+
+            AcquireSRWLockExclusive(&downloads_lock_);
+            active_downloads_[info->download_id] = std::move(info);
+            ReleaseSRWLockExclusive(&downloads_lock_);
+
+            STATS_INCREMENT("file.downloads_started");
+            return Protocol::ErrorCode::SUCCESS;
+        }
+
+        void FileDownloadManager::PumpDownload(Session* session, uint64_t download_id) {
+            struct PendingFrame {
+                Protocol::PacketHeader header;
+                Protocol::FileDownloadChunkHeader chunk_header;
+                FileRegion region;
+            };
+            std::vector<PendingFrame> frames;
+
+            bool is_complete = false;
+
+            // ť ø   ȿ ϰ,  ۽ û  ۿ 
+            AcquireSRWLockExclusive(&downloads_lock_);
+            auto it = active_downloads_.find(download_id);
+            if (it != active_downloads_.end() && it->second->range_begin == it->second->range_end) {
+                is_complete = true; //  0    ٷ Ϸ
+                active_downloads_.erase(it);
+            }
+            else if (it != active_downloads_.end()) {
+                DownloadInfo& info = *it->second;
+                while (info.frames_in_flight < Protocol::Config::DOWNLOAD_PIPELINE_DEPTH &&
+                    info.next_offset < info.range_end) {
+                    const uint32_t length = static_cast<uint32_t>(std::min<uint64_t>(
+                        Protocol::Config::DOWNLOAD_CHUNK_SIZE, info.range_end - info.next_offset));
+
+                    PendingFrame frame;
+                    frame.header = Protocol::PacketHeader(Protocol::PacketID::FILE_DOWNLOAD_DATA,
+                        static_cast<uint16_t>(sizeof(Protocol::FileDownloadChunkHeader) + length));
+                    frame.chunk_header.download_id = info.download_id;
+                    frame.chunk_header.offset = info.next_offset;
+                    frame.region.file = info.file;
+                    frame.region.offset = info.next_offset;
+                    frame.region.length = length;
+                    frames.push_back(std::move(frame));
+
+                    info.next_offset += length;
+                    ++info.frames_in_flight;
+                }
+            }
+            ReleaseSRWLockExclusive(&downloads_lock_);
+
+            if (is_complete) {
+                NotifyComplete(session, download_id, 0);
+                return;
+            }
+
+            for (auto& frame : frames) {
+                char head[sizeof(Protocol::PacketHeader) + sizeof(Protocol::FileDownloadChunkHeader)];
+                memcpy(head, &frame.header, sizeof(frame.header));
+                memcpy(head + sizeof(frame.header), &frame.chunk_header, sizeof(frame.chunk_header));
+
+                if (!session->PostSendFile(head, sizeof(head), std::move(frame.region), download_id)) {
+                    CancelDownload(download_id);
+                    return;
+                }
+                STATS_INCREMENT("file.download_frames");
+            }
+        }
+
+        bool FileDownloadManager::OnFrameSent(Session* session, uint64_t download_id, uint32_t file_bytes) {
+            bool is_complete = false;
+            bool needs_pump = false;
+            uint64_t bytes_sent = 0;
+
+            AcquireSRWLockExclusive(&downloads_lock_);
+            auto it = active_downloads_.find(download_id);
+            if (it != active_downloads_.end()) {
+                DownloadInfo& info = *it->second;
+                info.bytes_sent += file_bytes;
+                bytes_sent = info.bytes_sent;
+                if (info.frames_in_flight > 0) {
+                    --info.frames_in_flight;
+                }
+
+                if (info.range_begin + info.bytes_sent >= info.range_end) {
+                    is_complete = true;
+                    active_downloads_.erase(it);
+                }
+                else {
+                    needs_pump = info.next_offset < info.range_end;
+                }
+            }
+            ReleaseSRWLockExclusive(&downloads_lock_);
+
+            Statistics::GetInstance()->IncrementCounter("file.download_bytes", file_bytes);
+
+            if (needs_pump) {
+                PumpDownload(session, download_id);
+            }
+            if (is_complete) {
+                NotifyComplete(session, download_id, bytes_sent);
+            }
+            return is_complete;
+        }
+
+        void FileDownloadManager::NotifyComplete(Session* session, uint64_t download_id, uint64_t bytes_sent) {
+            const std::string payload = Protocol::FileDownloadCodec::EncodeCompleteNotify(download_id, true, bytes_sent, "");
+            Protocol::PacketHeader header(Protocol::PacketID::FILE_DOWNLOAD_COMPLETE_NTF, static_cast<uint16_t>(payload.size()),
+                Common::Utils::CryptoUtils::CalculateCRC32(payload.data(), payload.size()));
+
+            std::vector<char> packet(sizeof(header) + payload.size());
+            memcpy(packet.data(), &header, sizeof(header));
+            memcpy(packet.data() + sizeof(header), payload.data(), payload.size());
+            session->PostSend(packet.data(), packet.size());
+            STATS_INCREMENT("file.downloads_completed");
+        }
+
+        void FileDownloadManager::CancelDownload(uint64_t download_id) {
+            AcquireSRWLockExclusive(&downloads_lock_);
+            active_downloads_.erase(download_id);
+            ReleaseSRWLockExclusive(&downloads_lock_);
+        }
+
+        void FileDownloadManager::CancelDownloadsForSession(uint64_t session_id) {
+            AcquireSRWLockExclusive(&downloads_lock_);
+            for (auto it = active_downloads_.begin(); it != active_downloads_.end();) {
+                if (it->second->session_id == session_id) {
+                    it = active_downloads_.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ReleaseSRWLockExclusive(&downloads_lock_);
+        }
+
+        size_t FileDownloadManager::GetActiveDownloadCount() const {
+            AcquireSRWLockShared(&downloads_lock_);
+            size_t count = active_downloads_.size();
+            ReleaseSRWLockShared(&downloads_lock_);
+            return count;
+        }
+
+        size_t FileDownloadManager::GetOpenFileCount() const {
+            std::lock_guard<std::mutex> lock(open_files_mutex_);
+            size_t count = 0;
+            for (const auto& entry : open_files_) {
+                if (!entry.second.expired()) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
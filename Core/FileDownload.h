@@ -0,0 +1,73 @@
+#pragma once
+
+#include <winsock2.h>
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include "SharedFile.h"
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        class Session; //  
+
+        //  ٿε Ŵ
+        //  Ʈ  ۽ ť FileRegionθ ö󰡰, ̹    .
+        class FileDownloadManager {
+        public:
+            static FileDownloadManager* GetInstance();
+
+            struct DownloadInfo {
+                uint64_t download_id;
+                uint64_t session_id;
+                std::shared_ptr<SharedFile> file;
+                uint64_t range_begin;      // û  
+                uint64_t range_end;        // û   ()
+                uint64_t next_offset;      //  ť ø 
+                uint64_t bytes_sent;       // ۽ Ϸ Ʈ
+                uint32_t frames_in_flight; // ۽ ť ö  
+            };
+
+            // ٿε  ( û  ̾ޱ).   ErrorCode ȯ
+            int32_t StartDownload(Session* session, const std::string& file_path,
+                uint64_t offset, uint64_t length, uint64_t if_version, DownloadInfo& out_info);
+
+            //  ̸ŭ   ۽ ť  (FILE_DOWNLOAD_RES   ȣ)
+            void PumpDownload(Session* session, uint64_t download_id);
+
+            //  ۽ Ϸ  ( ۽ ΰ ȣ). ٿε尡  FILE_DOWNLOAD_COMPLETE_NTF  true
+            bool OnFrameSent(Session* session, uint64_t download_id, uint32_t file_bytes);
+
+            void CancelDownload(uint64_t download_id);
+            void CancelDownloadsForSession(uint64_t session_id);
+
+            size_t GetActiveDownloadCount() const;
+            size_t GetOpenFileCount() const;
+
+        private:
+            FileDownloadManager();
+            ~FileDownloadManager();
+
+            //   ϳ ڵ  (α   Ŭ̾Ʈ    ĳø )
+            //  üǾ (ũ/ ð ٸ)  ڵ ٲ
+            std::shared_ptr<SharedFile> AcquireFile(const std::string& file_path);
+            bool IsPathAllowed(const std::string& file_path) const;
+            void NotifyComplete(Session* session, uint64_t download_id, uint64_t bytes_sent);
+
+            mutable SRWLOCK downloads_lock_;
+            std::unordered_map<uint64_t, std::unique_ptr<DownloadInfo>> active_downloads_;
+
+            mutable std::mutex open_files_mutex_;
+            std::unordered_map<std::string, std::weak_ptr<SharedFile>> open_files_;
+
+            std::atomic<uint64_t> next_download_id_{ 1 };
+
+            static FileDownloadManager* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,399 @@
+#include "pch.h"
+#include "Managers.h"
+#include "Statistics.h"
+#include "../Common/Config.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace NexusCore {
+    namespace Core {
+
+        FileTransferManager* FileTransferManager::instance_ = nullptr;
+        std::once_flag FileTransferManager::init_flag_;
+
+        FileTransferManager* FileTransferManager::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new FileTransferManager();
+            });
+            return instance_;
+        }
+
+        FileTransferManager::FileTransferManager()
+            : temp_directory_((std::filesystem::temp_directory_path() / "nexus_uploads").string()) {
+            InitializeSRWLock(&transfers_lock_);
+        }
+
+        FileTransferManager::~FileTransferManager() = default;
+
+        uint64_t FileTransferManager::StartFileUpload(const std::string& file_name, uint64_t file_size,
+            const std::string& file_hash, const std::string& sender_id, const std::string& receiver_id) {
+            Common::Utils::HashAlgorithm algorithm;
+            if (file_size == 0 || file_size > Protocol::Config::MAX_FILE_SIZE ||
+                !Common::Utils::IncrementalHash::DetectAlgorithm(file_hash, algorithm)) {
+                STATS_INCREMENT("file.upload_rejected");
+                return 0;
+            }
+
+            auto info = std::make_shared<FileTransferInfo>();
+            info->upload_id = next_upload_id_.fetch_add(1);
+            info->file_name = file_name;
+            info->file_size = file_size;
+            info->file_hash = file_hash;
+            info->sender_id = sender_id;
+            info->receiver_id = receiver_id;
+            info->chunk_size = Protocol::Config::UPLOAD_CHUNK_SIZE;
+            info->total_chunks = static_cast<size_t>((file_size + info->chunk_size - 1) / info->chunk_size);
+            info->received_chunks = 0;
+            info->is_complete = false;
+            info->is_detached = false;
+            info->is_deduplicated = false;
+            info->last_activity = std::chrono::steady_clock::now();
+
+            //   ҿ  ûũ  ٷ Ϸ
+            ContentStore* store = OpenContentStore();
+            if (store && ContentStore::MakeKey(file_hash, file_size, info->content_key) &&
+                Common::Config::GetInstance()->GetBool("file.dedup_enabled", true) &&
+                store->AcquireExisting(info->content_key, info->stored_file_path)) {
+                info->received_chunks = info->total_chunks;
+                info->is_complete = true;
+                info->is_deduplicated = true;
+
+                const uint64_t upload_id = info->upload_id;
+                AcquireSRWLockExclusive(&transfers_lock_);
+                active_transfers_[upload_id] = std::move(info);
+                ReleaseSRWLockExclusive(&transfers_lock_);
+
+                STATS_INCREMENT("file.uploads_deduplicated");
+                return upload_id;
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(temp_directory_, ec);
+            info->temp_file_path = (std::filesystem::path(temp_directory_) /
+                ("upload_" + std::to_string(info->upload_id) + ".tmp")).string();
+            if (!info->temp_file.Open(info->temp_file_path, file_size)) {
+                STATS_INCREMENT("file.temp_open_failures");
+                return 0;
+            }
+
+            info->hash_verifier = std::make_unique<Common::Utils::ChunkHashVerifier>(algorithm, file_hash,
+                static_cast<uint32_t>(info->total_chunks));
+
+            // ӽ      ų  ص ̾  ְ 
+            UploadJournal::TransferMeta meta;
+            meta.upload_id = info->upload_id;
+            meta.file_name = file_name;
+            meta.file_size = file_size;
+            meta.file_hash = file_hash;
+            meta.sender_id = sender_id;
+            meta.receiver_id = receiver_id;
+            meta.chunk_size = info->chunk_size;
+            meta.total_chunks = static_cast<uint32_t>(info->total_chunks);
+            info->journal = UploadJournal::Create(UploadJournal::GetJournalPath(info->temp_file_path), meta);
+            if (!info->journal) {
+                STATS_INCREMENT("file.journal_create_failures"); // ̾ޱ⸸    ε 
+            }
+
+            const uint64_t upload_id = info->upload_id;
+            AcquireSRWLockExclusive(&transfers_lock_);
+            active_transfers_[upload_id] = std::move(info);
+            ReleaseSRWLockExclusive(&transfers_lock_);
+
+            STATS_INCREMENT("file.uploads_started");
+            return upload_id;
+        }
+
+        bool FileTransferManager::ProcessFileChunk(uint64_t upload_id, uint32_t chunk_index,
+            const char* chunk_data, size_t chunk_size) {
+            std::shared_ptr<FileTransferInfo> info = FindTransfer(upload_id);
+            if (!info) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(info->transfer_mutex);
+            if (info->is_complete || info->is_detached || !info->temp_file.IsOpen() || chunk_index >= info->total_chunks) {
+                return false;
+            }
+
+            //  ûũ ª  
+            const uint64_t offset = static_cast<uint64_t>(chunk_index) * info->chunk_size;
+            if (chunk_size != std::min<uint64_t>(info->chunk_size, info->file_size - offset)) {
+                STATS_INCREMENT("file.chunk_size_mismatch");
+                return false;
+            }
+
+            switch (info->hash_verifier->SubmitChunk(chunk_index, chunk_data, chunk_size)) {
+            case Common::Utils::ChunkHashVerifier::SubmitResult::ACCEPTED:
+                break;
+            case Common::Utils::ChunkHashVerifier::SubmitResult::DUPLICATE:
+                return true; // ۵ ûũ 
+            case Common::Utils::ChunkHashVerifier::SubmitResult::OUT_OF_WINDOW:
+                STATS_INCREMENT("file.chunks_out_of_window");
+                return false;
+            default:
+                return false;
+            }
+
+            // ûũ ӽ Ͽ  ڿ  Ʈ  (  ε  μ ׾ )
+            memcpy(info->temp_file.GetData() + offset, chunk_data, chunk_size);
+            if (info->journal) {
+                info->journal->MarkChunkReceived(chunk_index);
+                info->journal->SaveHashProgress(*info->hash_verifier);
+            }
+            ++info->received_chunks;
+            info->last_activity = std::chrono::steady_clock::now();
+            info->memory_charge.Resize(sizeof(FileTransferInfo) + info->hash_verifier->GetBufferedBytes());
+            STATS_INCREMENT("file.chunks_received");
+            return true;
+        }
+
+        FileTransferManager::FileTransferInfo* FileTransferManager::GetTransferInfo(uint64_t upload_id) {
+            return FindTransfer(upload_id).get();
+        }
+
+        bool FileTransferManager::CompleteTransfer(uint64_t upload_id) {
+            std::shared_ptr<FileTransferInfo> info = FindTransfer(upload_id);
+            if (!info) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(info->transfer_mutex);
+            if (info->is_complete) {
+                return true;
+            }
+
+            // ûũ 鼭  ؽ÷  (ӽ  б )
+            if (!info->hash_verifier->IsComplete() || !info->hash_verifier->Verify()) {
+                STATS_INCREMENT("file.hash_mismatch");
+                return false;
+            }
+
+            info->temp_file.Flush();
+            info->temp_file.Close();
+            if (info->journal) {
+                info->journal->Remove();
+                info->journal.reset();
+            }
+
+            //  ӽ  ҷ ̵ (Ҹ   ӽ  ״ )
+            ContentStore* store = OpenContentStore();
+            if (!store || !ContentStore::MakeKey(info->file_hash, info->file_size, info->content_key) ||
+                !store->Commit(info->content_key, info->temp_file_path, info->stored_file_path)) {
+                info->stored_file_path = info->temp_file_path;
+            }
+            info->is_complete = true;
+            info->last_activity = std::chrono::steady_clock::now();
+            info->memory_charge.Resize(sizeof(FileTransferInfo));
+            STATS_INCREMENT("file.uploads_completed");
+            return true;
+        }
+
+        void FileTransferManager::CancelTransfer(uint64_t upload_id) {
+            std::shared_ptr<FileTransferInfo> info = FindTransfer(upload_id);
+            if (!info) {
+                return;
+            }
+
+            EraseTransfer(upload_id);
+
+            std::lock_guard<std::mutex> lock(info->transfer_mutex);
+            if (!info->is_complete) {
+                info->temp_file.Close();
+                if (info->journal) {
+                    info->journal->Remove();
+                }
+                std::error_code ec;
+                std::filesystem::remove(info->temp_file_path, ec);
+                STATS_INCREMENT("file.uploads_cancelled");
+            }
+        }
+
+        bool FileTransferManager::ResumeFileUpload(uint64_t upload_id, const std::string& sender_id,
+            std::vector<UploadJournal::ChunkRange>& missing_chunks) {
+            std::shared_ptr<FileTransferInfo> info = FindTransfer(upload_id);
+            if (!info) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(info->transfer_mutex);
+            if (info->is_complete || !info->journal || info->sender_id != sender_id) {
+                return false;
+            }
+
+            info->is_detached = false;
+            info->last_activity = std::chrono::steady_clock::now();
+            missing_chunks = info->journal->GetMissingRanges();
+            STATS_INCREMENT("file.uploads_resumed");
+            return true;
+        }
+
+        void FileTransferManager::DetachTransfersForUser(const std::string& sender_id) {
+            std::vector<std::shared_ptr<FileTransferInfo>> transfers;
+            AcquireSRWLockShared(&transfers_lock_);
+            for (const auto& entry : active_transfers_) {
+                if (entry.second->sender_id == sender_id) {
+                    transfers.push_back(entry.second);
+                }
+            }
+            ReleaseSRWLockShared(&transfers_lock_);
+
+            //  ִ ۸   û ( ̾  Ƿ )
+            for (const auto& info : transfers) {
+                bool cancel = false;
+                {
+                    std::lock_guard<std::mutex> lock(info->transfer_mutex);
+                    if (info->is_complete) {
+                        continue;
+                    }
+                    if (info->journal) {
+                        info->is_detached = true;
+                        info->last_activity = std::chrono::steady_clock::now();
+                        info->temp_file.Flush();
+                        info->journal->Flush();
+                    }
+                    else {
+                        cancel = true;
+                    }
+                }
+                if (cancel) {
+                    CancelTransfer(info->upload_id);
+                }
+            }
+        }
+
+        size_t FileTransferManager::RecoverPersistedTransfers(const std::string& temp_directory) {
+            temp_directory_ = temp_directory;
+
+            size_t recovered = 0;
+            for (const std::string& journal_path : UploadJournal::FindJournals(temp_directory)) {
+                std::unique_ptr<UploadJournal> journal = UploadJournal::Open(journal_path);
+                const std::string temp_file_path = journal_path.substr(0, journal_path.size() - std::string(".journal").size());
+
+                // ؽ   ·,  ڿ  ûũ ӽ Ͽ ٽ о 
+                std::unique_ptr<Common::Utils::ChunkHashVerifier> verifier;
+                if (journal) {
+                    verifier = journal->RestoreVerifier(temp_file_path);
+                }
+
+                auto info = std::make_shared<FileTransferInfo>();
+                if (!verifier || !info->temp_file.Open(temp_file_path, journal->GetMeta().file_size)) {
+                    STATS_INCREMENT("file.journal_recover_failures");
+                    if (journal) {
+                        journal->Remove();
+                    }
+                    else {
+                        std::error_code ec;
+                        std::filesystem::remove(journal_path, ec);
+                    }
+                    std::error_code ec;
+                    std::filesystem::remove(temp_file_path, ec);
+                    continue;
+                }
+
+                const UploadJournal::TransferMeta& meta = journal->GetMeta();
+                info->upload_id = meta.upload_id;
+                info->file_name = meta.file_name;
+                info->file_size = meta.file_size;
+                info->file_hash = meta.file_hash;
+                info->sender_id = meta.sender_id;
+                info->receiver_id = meta.receiver_id;
+                info->chunk_size = meta.chunk_size;
+                info->total_chunks = meta.total_chunks;
+                info->received_chunks = journal->GetReceivedCount();
+                info->temp_file_path = temp_file_path;
+                info->is_complete = false;
+                info->is_detached = true; // ۽ڰ ٽ   
+                info->is_deduplicated = false;
+                info->last_activity = std::chrono::steady_clock::now();
+                info->hash_verifier = std::move(verifier);
+                info->journal = std::move(journal);
+
+                //  ID  ε ID ġ ʰ 
+                uint64_t next_id = next_upload_id_.load();
+                while (next_id <= info->upload_id &&
+                    !next_upload_id_.compare_exchange_weak(next_id, info->upload_id + 1)) {
+                    // ϸ next_id   ٲ ٽ 
+                }
+
+                const uint64_t upload_id = info->upload_id;
+                AcquireSRWLockExclusive(&transfers_lock_);
+                active_transfers_[upload_id] = std::move(info);
+                ReleaseSRWLockExclusive(&transfers_lock_);
+                ++recovered;
+            }
+
+            STATS_SET_GAUGE("file.recovered_transfers", static_cast<double>(recovered));
+            return recovered;
+        }
+
+        size_t FileTransferManager::GetActiveTransferCount() const {
+            AcquireSRWLockShared(&transfers_lock_);
+            const size_t count = active_transfers_.size();
+            ReleaseSRWLockShared(&transfers_lock_);
+            return count;
+        }
+
+        void FileTransferManager::CleanupExpiredTransfers() {
+            const auto expire_before = std::chrono::steady_clock::now() -
+                std::chrono::seconds(Protocol::Config::UPLOAD_IDLE_TIMEOUT_SEC);
+
+            std::vector<uint64_t> expired;
+            AcquireSRWLockShared(&transfers_lock_);
+            for (const auto& [upload_id, info] : active_transfers_) {
+                std::lock_guard<std::mutex> lock(info->transfer_mutex);
+                if (info->last_activity < expire_before) {
+                    expired.push_back(upload_id);
+                }
+            }
+            ReleaseSRWLockShared(&transfers_lock_);
+
+            // Ϸ   , ̿Ϸ  ӽ ϱ 
+            for (uint64_t upload_id : expired) {
+                CancelTransfer(upload_id);
+            }
+
+            ContentStore* store = OpenContentStore();
+            if (store) {
+                store->CollectGarbage(std::chrono::seconds(Protocol::Config::CONTENT_STORE_GC_GRACE_SEC));
+            }
+        }
+
+        ContentStore* FileTransferManager::OpenContentStore() {
+            ContentStore* store = ContentStore::GetInstance();
+            if (store->IsInitialized()) {
+                return store;
+            }
+
+            // ó   file.storage_root Ʒ  (ٿε  ο  Ʈ)
+            std::lock_guard<std::mutex> lock(store_open_mutex_);
+            if (!store->IsInitialized()) {
+                const std::string root = Common::Config::GetInstance()->GetString("file.storage_root", "uploads");
+                if (!store->Initialize((std::filesystem::path(root) / "store").string())) {
+                    STATS_INCREMENT("file.store_open_failures");
+                    return nullptr;
+                }
+            }
+            return store;
+        }
+
+        std::shared_ptr<FileTransferManager::FileTransferInfo> FileTransferManager::FindTransfer(uint64_t upload_id) const {
+            std::shared_ptr<FileTransferInfo> info;
+            AcquireSRWLockShared(&transfers_lock_);
+            auto it = active_transfers_.find(upload_id);
+            if (it != active_transfers_.end()) {
+                info = it->second;
+            }
+            ReleaseSRWLockShared(&transfers_lock_);
+            return info;
+        }
+
+        void FileTransferManager::EraseTransfer(uint64_t upload_id) {
+            AcquireSRWLockExclusive(&transfers_lock_);
+            active_transfers_.erase(upload_id);
+            ReleaseSRWLockExclusive(&transfers_lock_);
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        //  Ŭ ť    
+        //    켱,  DRR(deficit round robin): ʰ   ġ x quantumŭ  ް
+        //   ׸   ȿ  .    Ƿ   Ѳ   ʴ´.
+        // ť ȣ  , ȭ ȣ  Ѵ.
+        class LaneSelector {
+        public:
+            using PacketClass = Protocol::PacketClass;
+            static constexpr size_t LANE_COUNT = Protocol::PACKET_CLASS_COUNT;
+
+            // quantum: ġ 1    (۾   1, Ʈ  Ʈ )
+            explicit LaneSelector(uint32_t quantum = 1) : quantum_(quantum) {
+                weights_[static_cast<size_t>(PacketClass::CONTROL)] = 0; //  켱̶  
+                weights_[static_cast<size_t>(PacketClass::CHAT)] = Protocol::Config::LANE_WEIGHT_CHAT;
+                weights_[static_cast<size_t>(PacketClass::BULK)] = Protocol::Config::LANE_WEIGHT_BULK;
+                weights_[static_cast<size_t>(PacketClass::ADMIN)] = Protocol::Config::LANE_WEIGHT_ADMIN;
+            }
+
+            void SetWeight(PacketClass lane, uint32_t weight) {
+                if (lane != PacketClass::CONTROL) {
+                    weights_[static_cast<size_t>(lane)] = weight > 0 ? weight : 1; // 0̸  ʰ  
+                }
+            }
+
+            uint32_t GetWeight(PacketClass lane) const { return weights_[static_cast<size_t>(lane)]; }
+
+            // has_work(lane) -> bool, head_cost(lane) ->   ׸ .    false
+            template<typename HasWork, typename HeadCost>
+            bool Select(HasWork&& has_work, HeadCost&& head_cost, PacketClass& out_lane) {
+                if (has_work(PacketClass::CONTROL)) {
+                    out_lane = PacketClass::CONTROL;
+                    return true;
+                }
+
+                bool has_any = false;
+                for (size_t lane = 1; lane < LANE_COUNT; ++lane) {
+                    has_any = has_any || has_work(static_cast<PacketClass>(lane));
+                }
+                if (!has_any) {
+                    return false;
+                }
+
+                //  ִ  ϳ ̻̹Ƿ  ̴  ݵ 
+                for (;;) {
+                    const PacketClass lane = static_cast<PacketClass>(current_);
+                    if (lane != PacketClass::CONTROL && has_work(lane)) {
+                        if (!is_turn_started_) {
+                            deficits_[current_] += static_cast<uint64_t>(weights_[current_]) * quantum_;
+                            is_turn_started_ = true;
+                        }
+                        const uint64_t cost = head_cost(lane);
+                        if (deficits_[current_] >= cost) {
+                            deficits_[current_] -= cost;
+                            out_lane = lane;
+                            return true;
+                        }
+                    }
+                    else {
+                        deficits_[current_] = 0;
+                    }
+
+                    current_ = (current_ + 1) % LANE_COUNT;
+                    is_turn_started_ = false;
+                }
+            }
+
+        private:
+            uint32_t weights_[LANE_COUNT];
+            uint64_t deficits_[LANE_COUNT] = {};
+            uint32_t quantum_;
+            size_t current_ = 1;
+            bool is_turn_started_ = false;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
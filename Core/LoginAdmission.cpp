@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "LoginAdmission.h"
+#include "TaskScheduler.h"
+#include "Statistics.h"
+#include "../Common/Protocol.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace NexusCore {
+    namespace Core {
+
+        LoginAdmission* LoginAdmission::instance_ = nullptr;
+        std::once_flag LoginAdmission::init_flag_;
+
+        LoginAdmission* LoginAdmission::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new LoginAdmission();
+            });
+            return instance_;
+        }
+
+        LoginAdmission::LoginAdmission()
+            : max_concurrent_(Protocol::Config::LOGIN_MAX_CONCURRENT)
+            , queue_capacity_(Protocol::Config::LOGIN_QUEUE_CAPACITY) {
+        }
+
+        void LoginAdmission::SetLimits(uint32_t max_concurrent, uint32_t queue_capacity) {
+            std::vector<StartCallback> to_start;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                max_concurrent_ = max_concurrent > 0 ? max_concurrent : 1;
+                queue_capacity_ = queue_capacity;
+                while (in_flight_ < max_concurrent_ && !waiting_.empty()) {
+                    ++in_flight_;
+                    to_start.push_back(PopNextLocked());
+                }
+            }
+            for (auto& start : to_start) {
+                start();
+            }
+        }
+
+        LoginAdmission::Result LoginAdmission::Request(uint64_t session_id, StartCallback start, uint32_t& out_position) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (in_flight_ >= max_concurrent_ || !waiting_.empty()) {
+                    if (waiting_sessions_.count(session_id) != 0) {
+                        return Result::DUPLICATE;
+                    }
+                    if (waiting_.size() >= queue_capacity_) {
+                        STATS_INCREMENT("login.rejected");
+                        return Result::REJECTED;
+                    }
+
+                    waiting_.push_back({ session_id, std::move(start), Clock::now() });
+                    waiting_sessions_.insert(session_id);
+                    out_position = static_cast<uint32_t>(waiting_.size());
+                    STATS_INCREMENT("login.queued");
+                    return Result::QUEUED;
+                }
+                ++in_flight_;
+            }
+
+            STATS_INCREMENT("login.admitted");
+            start();
+            return Result::ADMITTED;
+        }
+
+        void LoginAdmission::Complete() {
+            StartCallback next;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (waiting_.empty() || in_flight_ > max_concurrent_) {
+                    //   ĸ ģ ŭ ڸ ѱ 
+                    if (in_flight_ > 0) {
+                        --in_flight_;
+                    }
+                    return;
+                }
+                next = PopNextLocked(); //  α ڸ ״ ѱ
+            }
+            next();
+        }
+
+        LoginAdmission::StartCallback LoginAdmission::PopNextLocked() {
+            Waiting waiting = std::move(waiting_.front());
+            waiting_.pop_front();
+            waiting_sessions_.erase(waiting.session_id);
+
+            const double wait_ms = std::chrono::duration<double, std::milli>(Clock::now() - waiting.queued_at).count();
+            STATS_INCREMENT("login.admitted");
+            STATS_RECORD("login.queue_wait_ms", wait_ms);
+            return std::move(waiting.start);
+        }
+
+        size_t LoginAdmission::GetInFlightCount() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return in_flight_;
+        }
+
+        size_t LoginAdmission::GetQueuedCount() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return waiting_.size();
+        }
+
+        uint32_t LoginAdmission::ComputeAcceptDelayMs(size_t load_per_worker) {
+            using namespace Protocol::Config;
+            if (load_per_worker <= ACCEPT_LOAD_LOW) {
+                return 0;
+            }
+            if (load_per_worker >= ACCEPT_LOAD_HIGH) {
+                return ACCEPT_MAX_DELAY_MS;
+            }
+            //   ̿ и ۾  ø
+            return static_cast<uint32_t>(static_cast<uint64_t>(load_per_worker - ACCEPT_LOAD_LOW) * ACCEPT_MAX_DELAY_MS /
+                (ACCEPT_LOAD_HIGH - ACCEPT_LOAD_LOW));
+        }
+
+        uint32_t LoginAdmission::GetAcceptDelayMs() const {
+            TaskScheduler* scheduler = TaskScheduler::GetInstance();
+            const size_t worker_count = (std::max)(scheduler->GetWorkerCount(), static_cast<size_t>(1));
+            return ComputeAcceptDelayMs((scheduler->GetQueueDepth() + GetQueuedCount()) / worker_count);
+        }
+
+        void LoginAdmission::PublishStatistics() const {
+            STATS_SET_GAUGE("login.in_flight", static_cast<double>(GetInFlightCount()));
+            STATS_SET_GAUGE("login.queue_depth", static_cast<double>(GetQueuedCount()));
+            STATS_SET_GAUGE("login.accept_delay_ms", static_cast<double>(GetAcceptDelayMs()));
+        }
+
+    } // namespace Core
+} // namespace NexusCore
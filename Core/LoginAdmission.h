@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <unordered_set>
+#include <functional>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        // α/  
+        //  ó α Ѳ  ÿ óϴ α 길ŭ ,   
+        // ⿭  ƮƮ ä ó и ʰ Ѵ.   û ⿭    ٷ ϹǷ
+        //  ٸ û  ʴ´.   Ŀ и ۾  .
+        class LoginAdmission {
+        public:
+            using StartCallback = std::function<void()>;
+
+            enum class Result : uint8_t {
+                ADMITTED,  // ٷ 
+                QUEUED,    // ⿭  (ʰ  start ȣ)
+                DUPLICATE, //   ̹   ( û )
+                REJECTED   // ⿭  
+            };
+
+            static LoginAdmission* GetInstance();
+
+            void SetLimits(uint32_t max_concurrent, uint32_t queue_capacity); //  ø   û ٷ 
+
+            // α û .   start ȣϸ(ADMITTED ȯ ), start  α
+            //   ݵ Complete   ȣؾ  (  ó   ).
+            // QUEUED out_position   (1)
+            Result Request(uint64_t session_id, StartCallback start, uint32_t& out_position);
+            void Complete(); // α ϳ . ⿭   û ڸ ѱ
+
+            size_t GetInFlightCount() const;
+            size_t GetQueuedCount() const;
+
+            //   尡  accept   ð. Ŀ и ۾(  α ) 
+            uint32_t GetAcceptDelayMs() const;
+            static uint32_t ComputeAcceptDelayMs(size_t load_per_worker);
+
+            void PublishStatistics() const; // Statistics   ( ȭ  ֱ⿡ ȣ)
+
+        private:
+            LoginAdmission();
+            ~LoginAdmission() = default;
+
+            using Clock = std::chrono::steady_clock;
+
+            struct Waiting {
+                uint64_t session_id;
+                StartCallback start;
+                Clock::time_point queued_at;
+            };
+
+            StartCallback PopNextLocked(); // mutex_ ȿ ȣ. ⿭     ݹ ȯ
+
+            mutable std::mutex mutex_;
+            std::deque<Waiting> waiting_;
+            std::unordered_set<uint64_t> waiting_sessions_;
+            size_t in_flight_ = 0;
+            uint32_t max_concurrent_;
+            uint32_t queue_capacity_;
+
+            static LoginAdmission* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "LoopbackTransport.h"
+#include "Managers.h"
+#include "EpochReclaimer.h"
+#include "Statistics.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NexusCore {
+    namespace Core {
+
+        LoopbackTransport::LoopbackTransport() {
+            InitializeSRWLock(&endpoints_lock_);
+        }
+
+        LoopbackTransport::~LoopbackTransport() {
+            std::vector<uint64_t> session_ids;
+            AcquireSRWLockShared(&endpoints_lock_);
+            for (const auto& entry : endpoints_) {
+                session_ids.push_back(entry.first);
+            }
+            ReleaseSRWLockShared(&endpoints_lock_);
+
+            for (uint64_t session_id : session_ids) {
+                Close(session_id);
+            }
+        }
+
+        uint64_t LoopbackTransport::Connect() {
+            Session* session = SessionManager::GetInstance()->CreateSession(INVALID_SOCKET);
+            if (!session) {
+                return 0;
+            }
+
+            // ù PostRecv ã  ֵ   
+            const uint64_t session_id = session->GetSessionId();
+            AcquireSRWLockExclusive(&endpoints_lock_);
+            endpoints_[session_id] = std::make_shared<Endpoint>();
+            ReleaseSRWLockExclusive(&endpoints_lock_);
+
+            if (!session->PostRecv()) {
+                Close(session_id);
+                return 0;
+            }
+            return session_id;
+        }
+
+        void LoopbackTransport::Close(uint64_t session_id) {
+            AcquireSRWLockExclusive(&endpoints_lock_);
+            const bool erased = endpoints_.erase(session_id) > 0;
+            ReleaseSRWLockExclusive(&endpoints_lock_);
+
+            if (erased) {
+                SessionManager::GetInstance()->RemoveSession(session_id);
+            }
+        }
+
+        void LoopbackTransport::Drop(uint64_t session_id) {
+            AcquireSRWLockExclusive(&endpoints_lock_);
+            const bool erased = endpoints_.erase(session_id) > 0;
+            ReleaseSRWLockExclusive(&endpoints_lock_);
+
+            if (erased) {
+                SessionManager::GetInstance()->SuspendSession(session_id);
+            }
+        }
+
+        size_t LoopbackTransport::GetConnectionCount() const {
+            AcquireSRWLockShared(&endpoints_lock_);
+            const size_t count = endpoints_.size();
+            ReleaseSRWLockShared(&endpoints_lock_);
+            return count;
+        }
+
+        std::shared_ptr<LoopbackTransport::Endpoint> LoopbackTransport::FindEndpoint(uint64_t session_id) const {
+            AcquireSRWLockShared(&endpoints_lock_);
+            auto it = endpoints_.find(session_id);
+            std::shared_ptr<Endpoint> endpoint = it != endpoints_.end() ? it->second : nullptr;
+            ReleaseSRWLockShared(&endpoints_lock_);
+            return endpoint;
+        }
+
+        void LoopbackTransport::MarkReady(uint64_t session_id, Endpoint& endpoint) {
+            if (endpoint.is_ready || !endpoint.has_recv || endpoint.inbound_offset == endpoint.inbound.size()) {
+                return;
+            }
+            endpoint.is_ready = true;
+
+            std::lock_guard<std::mutex> lock(ready_mutex_);
+            ready_.push_back(session_id);
+        }
+
+        void LoopbackTransport::Write(uint64_t session_id, const char* data, size_t size) {
+            std::shared_ptr<Endpoint> endpoint = FindEndpoint(session_id);
+            if (!endpoint || size == 0) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(endpoint->mutex);
+            endpoint->inbound.insert(endpoint->inbound.end(), data, data + size);
+            MarkReady(session_id, *endpoint);
+        }
+
+        bool LoopbackTransport::PostRecv(Session* session, char* buffer, size_t capacity) {
+            const uint64_t session_id = session->GetSessionId();
+            std::shared_ptr<Endpoint> endpoint = FindEndpoint(session_id);
+            if (!endpoint) {
+                return false; // ̹  
+            }
+
+            std::lock_guard<std::mutex> lock(endpoint->mutex);
+            endpoint->recv_buffer = buffer;
+            endpoint->recv_capacity = capacity;
+            endpoint->has_recv = true;
+            MarkReady(session_id, *endpoint); // 0Ʈ ŵ  Ͱ ־ Ϸ
+            return true;
+        }
+
+        size_t LoopbackTransport::Pump() {
+            std::deque<uint64_t> ready;
+            {
+                std::lock_guard<std::mutex> lock(ready_mutex_);
+                ready.swap(ready_); // ̹ ʿ ٽ غ   Pump
+            }
+
+            size_t delivered = 0;
+            for (uint64_t session_id : ready) {
+                std::shared_ptr<Endpoint> endpoint = FindEndpoint(session_id);
+                if (!endpoint) {
+                    continue;
+                }
+
+                DWORD bytes = 0;
+                {
+                    std::lock_guard<std::mutex> lock(endpoint->mutex);
+                    endpoint->is_ready = false;
+                    if (!endpoint->has_recv) {
+                        continue;
+                    }
+                    endpoint->has_recv = false;
+
+                    if (endpoint->recv_buffer) {
+                        const size_t pending = endpoint->inbound.size() - endpoint->inbound_offset;
+                        const size_t size = (std::min)(pending, endpoint->recv_capacity);
+                        memcpy(endpoint->recv_buffer, endpoint->inbound.data() + endpoint->inbound_offset, size);
+                        endpoint->inbound_offset += size;
+                        if (endpoint->inbound_offset == endpoint->inbound.size()) {
+                            endpoint->inbound.clear();
+                            endpoint->inbound_offset = 0;
+                        }
+                        bytes = static_cast<DWORD>(size);
+                    }
+                }
+
+                // IOCP Ϸ ó  : Ϸ ->   ɱ, ϸ  
+                bool alive = false;
+                {
+                    EpochGuard guard;
+                    Session* session = SessionManager::GetInstance()->FindSession(session_id);
+                    alive = session && session->OnRecvCompleted(bytes) && session->PostRecv();
+                }
+                if (!alive) {
+                    STATS_INCREMENT("loopback.closed_by_session");
+                    Close(session_id);
+                }
+                ++delivered;
+            }
+            return delivered;
+        }
+
+        bool LoopbackTransport::Send(Session* session, const SendData& send_data) {
+            if (send_data.size < sizeof(Protocol::PacketHeader)) {
+                return false;
+            }
+
+            Protocol::PacketHeader header;
+            memcpy(&header, send_data.data, sizeof(header));
+            if (packet_callback_) {
+                const char* payload = send_data.HasFileRegion() ? nullptr : send_data.data + sizeof(header);
+                packet_callback_(session->GetSessionId(), header, payload);
+            }
+            return true;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
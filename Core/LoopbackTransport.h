@@ -0,0 +1,72 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Session.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // μ  ¥  (   )
+        // Ŭ̾Ʈ  Write  Ʈ Pump θ 尡 IO ó ɸ  ۿ ä
+        // OnRecvCompleted -> PostRecv θ,   Ŷ  忡 ٷ Ŷ ݹ ѱ.
+        // Pump   Ḷ ɸ  ϳ äǷ  Է̸  ޴  .
+        // Pump  忡 θ (IOCPó    Ϸᰡ ġ ʰ).
+        class LoopbackTransport : public SessionTransport {
+        public:
+            //   Ŷ  ѱ payload nullptr ( ũ header.payload_length)
+            using PacketCallback = std::function<void(uint64_t session_id, const Protocol::PacketHeader& header, const char* payload)>;
+
+            LoopbackTransport();
+            ~LoopbackTransport() override; //    Close
+
+            void SetPacketCallback(PacketCallback callback) { packet_callback_ = std::move(callback); } // Connect 
+
+            //   ù  .  ̺   0
+            uint64_t Connect();
+            void Close(uint64_t session_id); //   ( Write )
+            void Drop(uint64_t session_id);  // Ḹ :   óó SuspendSession (  ƴϸ )
+
+            // Ŭ̾Ʈ ->  Ʈ (ϼ Ŷ ƴϾ )
+            void Write(uint64_t session_id, const char* data, size_t size);
+
+            //  ɷ ְ  Ʈ ִ Ḷ   .   ȯ (0̸   )
+            size_t Pump();
+
+            size_t GetConnectionCount() const;
+
+            // SessionTransport
+            bool PostRecv(Session* session, char* buffer, size_t capacity) override;
+            bool Send(Session* session, const SendData& send_data) override;
+
+        private:
+            struct Endpoint {
+                std::mutex mutex;
+                std::vector<char> inbound;  //  ǿ ѱ  Ŭ̾Ʈ Ʈ
+                size_t inbound_offset = 0;
+                char* recv_buffer = nullptr; // ɸ  (nullptr + has_recv 0Ʈ )
+                size_t recv_capacity = 0;
+                bool has_recv = false;
+                bool is_ready = false;       // ready_ ⿭  
+            };
+
+            std::shared_ptr<Endpoint> FindEndpoint(uint64_t session_id) const;
+            void MarkReady(uint64_t session_id, Endpoint& endpoint); // endpoint.mutex ȿ ȣ
+
+            PacketCallback packet_callback_;
+
+            mutable SRWLOCK endpoints_lock_;
+            std::unordered_map<uint64_t, std::shared_ptr<Endpoint>> endpoints_;
+
+            std::mutex ready_mutex_;
+            std::deque<uint64_t> ready_; //   ְ  
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -3,40 +3,111 @@
 #include <unordered_map>
 #include <memory>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include "Session.h"
 #include "ChatRoom.h"
+#include "../Common/HashContext.h"
+#include "../Common/MemoryAccountant.h"
+#include "../Common/MappedFile.h"
+#include "UploadJournal.h"
+#include "ContentStore.h"
+#include "SlotTable.h"
+#include "StripedMap.h"
 
 namespace NexusCore {
     namespace Core {
 
+        // ü  Ϸ ڵ
+        //  Ŀ   ķ ,    Ϸȴ.
+        class BroadcastCompletion {
+        public:
+            explicit BroadcastCompletion(size_t partition_count) : remaining_(partition_count) {}
+
+            bool IsComplete() const { return remaining_ == 0; }
+            size_t GetDeliveredCount() const { return delivered_; } // Ϸ  ݱ  
+
+            // Ϸ       ȯ
+            size_t Wait() {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return remaining_ == 0; });
+                return delivered_;
+            }
+
+            //  ϳ  (SessionManager ȣ).  ̸ true
+            bool CompletePartition(size_t delivered) {
+                delivered_ += delivered;
+                if (remaining_.fetch_sub(1) != 1) {
+                    return false;
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                cv_.notify_all();
+                return true;
+            }
+
+        private:
+            std::atomic<size_t> remaining_;
+            std::atomic<size_t> delivered_{ 0 };
+            std::mutex mutex_;
+            std::condition_variable cv_;
+        };
+
+        using BroadcastHandle = std::shared_ptr<BroadcastCompletion>;
+
         // ̱  Ŵ
         class SessionManager {
         public:
             static SessionManager* GetInstance();
 
-            //  
+            //   ( ID =  ε + ,    nullptr)
             Session* CreateSession(SOCKET socket);
-            void RemoveSession(uint64_t session_id);
+            void RemoveSession(uint64_t session_id); // 濡 ,  и    EpochReclaimer 
+
+            //   ȸ. ̹   ID nullptr.  ʹ EpochGuard ȿ 
             Session* FindSession(uint64_t session_id);
             Session* FindSessionByUserId(const std::string& user_id);
 
+            // α    ID  ( ID   )
+            void BindUserId(Session* session, const std::string& user_id);
+
+            //  
+            // α   EnableResume ū ޾ LOGIN_RES ´ (   ڿ).
+            //   RemoveSession  SuspendSession θ,  ð ȿ   RESUME_REQ 
+            // ResumeSession α //    ű   Ѵ.
+            std::string EnableResume(Session* session);
+            bool SuspendSession(uint64_t session_id); //   ƴϸ ٷ RemoveSessionϰ false
+            bool ResumeSession(Session* connection, const std::string& token, uint64_t last_sequence,
+                const std::function<void(size_t)>& on_accepted, int32_t& out_error); // EpochGuard ȿ ȣ
+
+            //   ð (   "session.resume_grace_sec"  , 0̸ )
+            void SetResumeGraceTime(uint32_t grace_ms) { resume_grace_ms_ = grace_ms; }
+
             //  
             size_t GetSessionCount() const;
+            size_t GetResidentBytes() const; // ü   ޸ ( ü +  , )
             std::vector<std::string> GetConnectedUserIds() const;
 
-            // ü εĳƮ
-            void BroadcastToAll(const char* data, size_t size);
-            void BroadcastToLoggedInUsers(const char* data, size_t size);
+            // ü εĳƮ ( ̺ Ŀ ŭ   , Ŷ    )
+            // ȣ  ۾ ְ ٷ ƿ, ڵ Ϸ   Ȯ
+            BroadcastHandle BroadcastToAll(const char* data, size_t size);
+            BroadcastHandle BroadcastToLoggedInUsers(const char* data, size_t size);
 
         private:
             SessionManager();
             ~SessionManager();
 
-            mutable SRWLOCK sessions_lock_;
-            std::unordered_map<uint64_t, std::unique_ptr<Session>> sessions_;
-            std::unordered_map<std::string, Session*> user_session_map_; // user_id -> Session  ˻
+            BroadcastHandle Broadcast(const char* data, size_t size, bool logged_in_only);
+            void RemoveSession(uint64_t session_id, ChatRoom* left_room); // left_room: ̹ ڸ ѱ  (  濡   濡 )
 
-            std::atomic<uint64_t> next_session_id_{ 1 };
+            static constexpr uint32_t MIN_BROADCAST_PARTITION = 1024; //  ϳ ּ  
+
+            SlotTable<Session> sessions_;
+            StripedMap<std::string, uint64_t> user_sessions_; // user_id ->  ID ( ˻縦  ã)
+            StripedMap<std::string, uint64_t> resume_tokens_; //  ū ->  ID
+            std::atomic<uint32_t> resume_grace_ms_{ Protocol::Config::SESSION_RESUME_GRACE_SEC * 1000 };
+
+            static constexpr size_t RESUME_TOKEN_SIZE = 16;
 
             static SessionManager* instance_;
             static std::once_flag init_flag_;
@@ -48,9 +119,9 @@ namespace NexusCore {
             static RoomManager* GetInstance();
 
             //  
-            ChatRoom* CreateRoom(const std::string& title, const std::string& password = "");
-            void RemoveRoom(uint32_t room_id);
-            ChatRoom* FindRoom(uint32_t room_id);
+            ChatRoom* CreateRoom(const std::string& title, const std::string& password = ""); //      
+            bool RemoveRoom(uint32_t room_id); // ڰ   false.   ݱ (  Ⱓ  )
+            ChatRoom* FindRoom(uint32_t room_id); //  ʹ EpochGuard ȿ  (  EpochReclaimer )
 
             //  
             std::vector<uint32_t> GetRoomIds() const;
@@ -89,28 +160,64 @@ namespace NexusCore {
                 size_t total_chunks;
                 std::string temp_file_path;
                 bool is_complete;
+
+                // ӽ   ũ  ΰ ûũ ڸ  (Ϸ/  )
+                Common::MappedFile temp_file;
+                std::mutex transfer_mutex; //   ûũ/Ϸ/ ȭ
+                std::chrono::steady_clock::time_point last_activity;
+
+                // ûũ Ű Բ Ǵ ؽ (Ϸ  ũ б  )
+                std::unique_ptr<Common::Utils::ChunkHashVerifier> hash_verifier;
+
+                // ̾ޱ  ( Ʈ + ؽ , /  )
+                std::unique_ptr<UploadJournal> journal;
+                uint32_t chunk_size;
+                bool is_detached; // ۽  , ̾ޱ  
+
+                //  ּ  (Ϸ   , ̹ ִ ̸ ûũ  Ϸ)
+                ContentStore::ContentKey content_key;
+                std::string stored_file_path;
+                bool is_deduplicated;
+
+                //  ¿   ûũ  ޸ (ûũ    Resize,   )
+                Common::MemoryCharge memory_charge{ Common::MemoryCategory::FILE_TRANSFER, sizeof(FileTransferInfo) };
             };
 
-            //   
+            //    ( ؽ+ũⰡ ҿ  is_deduplicated = true  Ϸ)
             uint64_t StartFileUpload(const std::string& file_name, uint64_t file_size,
                 const std::string& file_hash, const std::string& sender_id,
                 const std::string& receiver_id = "");
             bool ProcessFileChunk(uint64_t upload_id, uint32_t chunk_index,
-                const char* chunk_data, size_t chunk_size);
-            FileTransferInfo* GetTransferInfo(uint64_t upload_id);
-            void CompleteTransfer(uint64_t upload_id);
+                const char* chunk_data, size_t chunk_size); //   ̸ false
+            FileTransferInfo* GetTransferInfo(uint64_t upload_id); // CancelTransfer/  ȿ
+            bool CompleteTransfer(uint64_t upload_id); // ؽ ġ  false,   ӽ  ҷ ̵
             void CancelTransfer(uint64_t upload_id);
 
+            // ε ̾ޱ
+            // ûũ ӽ Ͽ    Ʈ ؽ ¸ ϰ, Ϸ/   .
+            //    ۽ڰ ResumeFileUpload  ûũ  ޾ ٽ .
+            bool ResumeFileUpload(uint64_t upload_id, const std::string& sender_id,
+                std::vector<UploadJournal::ChunkRange>& missing_chunks);
+            void DetachTransfersForUser(const std::string& sender_id); //      
+            size_t RecoverPersistedTransfers(const std::string& temp_directory); //      ( ӽ ϵ  ͸)
+
             //   
             size_t GetActiveTransferCount() const;
-            void CleanupExpiredTransfers();
+            void CleanupExpiredTransfers(); //     GC 
 
         private:
             FileTransferManager();
             ~FileTransferManager();
 
+            std::shared_ptr<FileTransferInfo> FindTransfer(uint64_t upload_id) const;
+            void EraseTransfer(uint64_t upload_id);
+            ContentStore* OpenContentStore(); //  ϸ nullptr (  ӽ   )
+
+            // ó  ûũ ־   ʵ  ͷ 
             mutable SRWLOCK transfers_lock_;
-            std::unordered_map<uint64_t, std::unique_ptr<FileTransferInfo>> active_transfers_;
+            std::unordered_map<uint64_t, std::shared_ptr<FileTransferInfo>> active_transfers_;
+            std::string temp_directory_;
+            std::mutex store_open_mutex_;
 
             std::atomic<uint64_t> next_upload_id_{ 1 };
 
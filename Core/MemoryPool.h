@@ -3,25 +3,33 @@
 #include <memory>
 #include <queue>
 #include <mutex>
+#include "../Common/MemoryAccountant.h"
 
 namespace NexusCore {
     namespace Core {
 
+        //  ü ŭ MemoryAccountant  (  ü ϹǷ ݵ Release )
         template<typename T>
         class MemoryPool {
         public:
-            explicit MemoryPool(size_t initial_size = 100, size_t max_size = 1000)
-                : max_size_(max_size) {
+            explicit MemoryPool(size_t initial_size = 100, size_t max_size = 1000,
+                Common::MemoryCategory category = Common::MemoryCategory::POOL)
+                : max_size_(max_size)
+                , category_(category) {
                 for (size_t i = 0; i < initial_size; ++i) {
                     pool_.push(std::make_unique<T>());
                 }
+                Common::MemoryAccountant::GetInstance()->Charge(category_, initial_size * sizeof(T));
             }
 
-            ~MemoryPool() = default;
+            ~MemoryPool() {
+                Common::MemoryAccountant::GetInstance()->Release(category_, pool_.size() * sizeof(T));
+            }
 
             std::unique_ptr<T> Acquire() {
                 std::lock_guard<std::mutex> lock(mutex_);
                 if (pool_.empty()) {
+                    Common::MemoryAccountant::GetInstance()->Charge(category_, sizeof(T));
                     return std::make_unique<T>();
                 }
 
@@ -36,8 +44,10 @@ namespace NexusCore {
                 std::lock_guard<std::mutex> lock(mutex_);
                 if (pool_.size() < max_size_) {
                     pool_.push(std::move(obj));
+                    return;
                 }
                 // max_size ʰϸ ü  (ڵ Ҹ)
+                Common::MemoryAccountant::GetInstance()->Release(category_, sizeof(T));
             }
 
             size_t GetPoolSize() const {
@@ -49,6 +59,7 @@ namespace NexusCore {
             mutable std::mutex mutex_;
             std::queue<std::unique_ptr<T>> pool_;
             size_t max_size_;
+            Common::MemoryCategory category_;
         };
 
         // Ưȭ ޸ Ǯ
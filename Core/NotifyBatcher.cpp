@@ -0,0 +1,215 @@
+#include "pch.h"
+#include "NotifyBatcher.h"
+#include "Statistics.h"
+
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        NotifyBatcher::NotifyBatcher(const Options& options, FlushCallback flush_callback)
+            : options_(options)
+            , flush_callback_(std::move(flush_callback))
+            , last_flush_() {
+            NotifyBatchScheduler::GetInstance()->Register(this);
+        }
+
+        NotifyBatcher::~NotifyBatcher() {
+            NotifyBatchScheduler::GetInstance()->Unregister(this);
+        }
+
+        NotifyBatcher::AddResult NotifyBatcher::Add(const char* notify_payload, size_t size, Session* exclude_session) {
+            const size_t encoded_size = Protocol::ChatBatchCodec::GetEncodedSize(size);
+            const auto window = std::chrono::milliseconds(options_.window_ms);
+            bool needs_flush = false;
+            bool starts_batch = false;
+
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(batch_mutex_);
+                    const auto now = Clock::now();
+
+                    //     ð     ->   ٷ 
+                    if (pending_.entries.empty() && now - last_flush_ >= window) {
+                        last_flush_ = now;
+                        return AddResult::SEND_NOW;
+                    }
+
+                    if (pending_.entries.empty() || pending_.payload.size() + encoded_size <= options_.max_bytes) {
+                        if (pending_.entries.empty()) {
+                            pending_.first_queued = now;
+                            starts_batch = true;
+                        }
+
+                        Entry entry;
+                        entry.offset = static_cast<uint32_t>(pending_.payload.size());
+                        entry.length = static_cast<uint32_t>(encoded_size);
+                        entry.exclude_session = exclude_session;
+                        pending_.entries.push_back(entry);
+                        Protocol::ChatBatchCodec::AppendEntry(pending_.payload, notify_payload, size);
+
+                        if (exclude_session && std::find(pending_.excluded_sessions.begin(),
+                            pending_.excluded_sessions.end(), exclude_session) == pending_.excluded_sessions.end()) {
+                            pending_.excluded_sessions.push_back(exclude_session);
+                        }
+
+                        needs_flush = pending_.entries.size() >= options_.max_messages ||
+                            pending_.payload.size() >= options_.max_bytes;
+                        break;
+                    }
+                }
+
+                // ũ ѵ ʰ -> ݱ  ġ  ٽ õ
+                Flush();
+            }
+
+            if (needs_flush) {
+                Flush();
+            }
+            else if (starts_batch) {
+                NotifyBatchScheduler::GetInstance()->Wake();
+            }
+            return AddResult::QUEUED;
+        }
+
+        void NotifyBatcher::Flush() {
+            std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+
+            Batch batch;
+            {
+                std::lock_guard<std::mutex> lock(batch_mutex_);
+                if (pending_.entries.empty()) {
+                    return;
+                }
+                batch = std::move(pending_);
+                pending_ = Batch();
+                last_flush_ = Clock::now();
+            }
+
+            auto delay = std::chrono::duration<double, std::milli>(Clock::now() - batch.first_queued);
+            STATS_INCREMENT("chat.batch_flushes");
+            Statistics::GetInstance()->IncrementCounter("chat.batched_messages", batch.entries.size());
+            STATS_RECORD("chat.batch_size", static_cast<double>(batch.entries.size()));
+            STATS_RECORD("chat.batch_delay_ms", delay.count());
+
+            flush_callback_(batch);
+        }
+
+        bool NotifyBatcher::FlushIfDue(Clock::time_point now) {
+            if (GetDueTime() > now) {
+                return false;
+            }
+            Flush();
+            return true;
+        }
+
+        bool NotifyBatcher::HasPending() const {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            return !pending_.entries.empty();
+        }
+
+        NotifyBatcher::Clock::time_point NotifyBatcher::GetDueTime() const {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            if (pending_.entries.empty()) {
+                return Clock::time_point::max();
+            }
+            return pending_.first_queued + std::chrono::milliseconds(options_.window_ms);
+        }
+
+        const std::string& NotifyBatcher::GetPayloadFor(const Batch& batch, Session* recipient, std::string& scratch) {
+            if (std::find(batch.excluded_sessions.begin(), batch.excluded_sessions.end(), recipient) ==
+                batch.excluded_sessions.end()) {
+                return batch.payload;
+            }
+
+            // ڱ ޽  ڸ   (    )
+            scratch.clear();
+            for (const auto& entry : batch.entries) {
+                if (entry.exclude_session != recipient) {
+                    scratch.append(batch.payload, entry.offset, entry.length);
+                }
+            }
+            return scratch;
+        }
+
+        // ===== NotifyBatchScheduler =====
+
+        NotifyBatchScheduler* NotifyBatchScheduler::instance_ = nullptr;
+        std::once_flag NotifyBatchScheduler::init_flag_;
+
+        NotifyBatchScheduler* NotifyBatchScheduler::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new NotifyBatchScheduler();
+            });
+            return instance_;
+        }
+
+        NotifyBatchScheduler::~NotifyBatchScheduler() {
+            Stop();
+        }
+
+        void NotifyBatchScheduler::Start() {
+            if (is_running_.exchange(true)) {
+                return;
+            }
+            timer_thread_ = std::thread(&NotifyBatchScheduler::TimerLoop, this);
+        }
+
+        void NotifyBatchScheduler::Stop() {
+            if (!is_running_.exchange(false)) {
+                return;
+            }
+            Wake();
+            if (timer_thread_.joinable()) {
+                timer_thread_.join();
+            }
+        }
+
+        void NotifyBatchScheduler::Register(NotifyBatcher* batcher) {
+            {
+                std::lock_guard<std::mutex> lock(batchers_mutex_);
+                batchers_.push_back(batcher);
+            }
+            Start(); // ù ó   Ÿ̸  (̹   )
+        }
+
+        void NotifyBatchScheduler::Unregister(NotifyBatcher* batcher) {
+            std::lock_guard<std::mutex> lock(batchers_mutex_);
+            batchers_.erase(std::remove(batchers_.begin(), batchers_.end(), batcher), batchers_.end());
+        }
+
+        void NotifyBatchScheduler::Wake() {
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                is_woken_ = true;
+            }
+            wake_cv_.notify_one();
+        }
+
+        void NotifyBatchScheduler::TimerLoop() {
+            while (is_running_) {
+                auto next_due = NotifyBatcher::Clock::time_point::max();
+                {
+                    std::lock_guard<std::mutex> lock(batchers_mutex_);
+                    const auto now = NotifyBatcher::Clock::now();
+                    for (auto* batcher : batchers_) {
+                        batcher->FlushIfDue(now);
+                        next_due = std::min(next_due, batcher->GetDueTime());
+                    }
+                }
+
+                //   ð  ( ġ ۵Ǹ Wake   ð ٽ )
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                auto wake_up = [this]() { return is_woken_ || !is_running_; };
+                if (next_due == NotifyBatcher::Clock::time_point::max()) {
+                    wake_cv_.wait(lock, wake_up);
+                }
+                else {
+                    wake_cv_.wait_until(lock, next_due, wake_up);
+                }
+                is_woken_ = false;
+            }
+        }
+
+    } // namespace Core
+} // namespace NexusCore
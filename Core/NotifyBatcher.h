@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        class Session; //  
+
+        //   ä ˸ 
+        //  濡 ù ޽ ٷ (SEND_NOW),  ð ȿ ̾ ޽ 
+        // ڸ ROOM_CHAT_BATCH_NTF ϳ . /ũ ѵ   Ѵ.
+        class NotifyBatcher {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            struct Options {
+                uint32_t window_ms = Protocol::Config::CHAT_BATCH_WINDOW_MS;
+                uint32_t max_messages = Protocol::Config::CHAT_BATCH_MAX_MESSAGES;
+                size_t max_bytes = Protocol::Config::CHAT_BATCH_MAX_BYTES;
+            };
+
+            struct Entry {
+                uint32_t offset;          // payload  ڵ ׸ ġ
+                uint32_t length;          // ± +  + RoomChatNotify
+                Session* exclude_session; //  ׸    (  )
+            };
+
+            struct Batch {
+                std::string payload;      // ROOM_CHAT_BATCH_NTF ̷ε ( ׸)
+                std::vector<Entry> entries;
+                std::vector<Session*> excluded_sessions; // ߺ ,   
+                Clock::time_point first_queued;
+            };
+
+            enum class AddResult {
+                SEND_NOW, //   -> ȣڰ ROOM_CHAT_NTF ٷ 
+                QUEUED    // ġ ߰ (ѵ  ̹ ۵)
+            };
+
+            using FlushCallback = std::function<void(const Batch&)>;
+
+            NotifyBatcher(const Options& options, FlushCallback flush_callback); // ٷ ڵ 
+            ~NotifyBatcher(); //   ġ 
+
+            AddResult Add(const char* notify_payload, size_t size, Session* exclude_session);
+
+            //  ð  ġ .  true
+            bool FlushIfDue(Clock::time_point now);
+            void Flush();
+
+            bool HasPending() const;
+            Clock::time_point GetDueTime() const; //   ġ  time_point::max()
+            const Options& GetOptions() const { return options_; }
+
+            // ڿ ̷ε.  ׸  batch.payload ״,  scratch ٽ 
+            static const std::string& GetPayloadFor(const Batch& batch, Session* recipient, std::string& scratch);
+
+        private:
+            Options options_;
+            FlushCallback flush_callback_;
+
+            std::mutex flush_mutex_; // ġ    (batch_mutex_  )
+            mutable std::mutex batch_mutex_;
+            Batch pending_;
+            Clock::time_point last_flush_;
+        };
+
+        // ġ    ð ϴ Ÿ̸ 
+        class NotifyBatchScheduler {
+        public:
+            static NotifyBatchScheduler* GetInstance();
+
+            void Start();
+            void Stop(); //   .  Register ٽ 
+
+            void Register(NotifyBatcher* batcher); // Ÿ̸Ӱ   
+            void Unregister(NotifyBatcher* batcher); // ȯ Ŀ  ó  Ͼ 
+            void Wake();                             //  ġ ۵
+
+        private:
+            NotifyBatchScheduler() = default;
+            ~NotifyBatchScheduler();
+
+            void TimerLoop();
+
+            std::mutex batchers_mutex_; //   +   ȣ (Unregister    ٸ)
+            std::vector<NotifyBatcher*> batchers_;
+
+            std::mutex wake_mutex_;
+            std::condition_variable wake_cv_;
+            bool is_woken_ = false;
+
+            std::thread timer_thread_;
+            std::atomic<bool> is_running_{ false };
+
+            static NotifyBatchScheduler* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,86 @@
+#include "pch.h"
+#include "PacketAssembler.h"
+#include "SessionBufferPool.h"
+#include "Statistics.h"
+#include "../Common/MemoryAccountant.h"
+
+#include <cstring>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            //  ۰ Ŀ ŭ  (ݳ  SessionBufferPool ü 뷮 )
+            void ChargeGrowth(size_t old_capacity, size_t new_capacity) {
+                if (new_capacity > old_capacity) {
+                    Common::MemoryAccountant::GetInstance()->Charge(Common::MemoryCategory::REASSEMBLY,
+                        new_capacity - old_capacity);
+                }
+            }
+        }
+
+        PacketAssembler::~PacketAssembler() {
+            Reset();
+        }
+
+        void PacketAssembler::Reset() {
+            if (pending_) {
+                SessionBufferPool::GetInstance()->ReleaseReassemblyBuffer(std::move(pending_));
+            }
+        }
+
+        bool PacketAssembler::ParseFrames(char* data, size_t size, size_t& consumed, const PacketCallback& on_packet) {
+            consumed = 0;
+            while (size - consumed >= sizeof(Protocol::PacketHeader)) {
+                auto* header = reinterpret_cast<Protocol::PacketHeader*>(data + consumed);
+                const size_t frame_size = sizeof(Protocol::PacketHeader) + header->payload_length;
+                if (frame_size > Protocol::Config::MAX_PACKET_SIZE) {
+                    STATS_INCREMENT("session.invalid_frames");
+                    return false;
+                }
+                if (size - consumed < frame_size) {
+                    break; // ߸ 
+                }
+
+                if (!on_packet(header, data + consumed + sizeof(Protocol::PacketHeader))) {
+                    return false;
+                }
+                consumed += frame_size;
+            }
+            return true;
+        }
+
+        bool PacketAssembler::Feed(char* data, size_t size, const PacketCallback& on_packet) {
+            size_t consumed = 0;
+
+            if (!pending_) {
+                // κ   迡 Ƿ   ó
+                if (!ParseFrames(data, size, consumed, on_packet)) {
+                    return false;
+                }
+                if (consumed < size) {
+                    pending_ = SessionBufferPool::GetInstance()->AcquireReassemblyBuffer();
+                    const size_t old_capacity = pending_->capacity();
+                    pending_->assign(data + consumed, data + size);
+                    ChargeGrowth(old_capacity, pending_->capacity());
+                }
+                return true;
+            }
+
+            const size_t old_capacity = pending_->capacity();
+            pending_->insert(pending_->end(), data, data + size);
+            ChargeGrowth(old_capacity, pending_->capacity());
+            if (!ParseFrames(pending_->data(), pending_->size(), consumed, on_packet)) {
+                return false;
+            }
+            if (consumed == pending_->size()) {
+                Reset();
+            }
+            else if (consumed > 0) {
+                pending_->erase(pending_->begin(), pending_->begin() + consumed);
+            }
+            return true;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
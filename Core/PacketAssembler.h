@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        //  Ʈ -> Ŷ 
+        // ϼ Ŷ    ٷ ѱ,  ߸ 쿡
+        // SessionBufferPool  ۸   Ʈ .    ٷ ݳ.
+        class PacketAssembler {
+        public:
+            // false ָ ó ߴ ( )
+            using PacketCallback = std::function<bool(Protocol::PacketHeader* header, char* payload)>;
+
+            PacketAssembler() = default;
+            ~PacketAssembler();
+
+            PacketAssembler(const PacketAssembler&) = delete;
+            PacketAssembler& operator=(const PacketAssembler&) = delete;
+
+            //  Ʈ ó.  ̰ MAX_PACKET_SIZE Ѱų ݹ false false
+            bool Feed(char* data, size_t size, const PacketCallback& on_packet);
+
+            bool HasPendingFrame() const { return pending_ != nullptr; }
+            size_t GetPendingBytes() const { return pending_ ? pending_->size() : 0; }
+            size_t GetResidentBytes() const { return pending_ ? pending_->capacity() : 0; }
+
+            void Reset(); //   Ʈ   ݳ
+
+        private:
+            static bool ParseFrames(char* data, size_t size, size_t& consumed, const PacketCallback& on_packet);
+
+            std::unique_ptr<std::vector<char>> pending_; // ߸    
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,587 @@
+#include "pch.h"
+#include "PacketHandler.h"
+#include "Managers.h"
+#include "EpochReclaimer.h"
+#include "TaskScheduler.h"
+#include "Statistics.h"
+#include "RateLimiter.h"
+#include "LoginAdmission.h"
+#include "FileDownload.h"
+#include "../Common/MemoryAccountant.h"
+#include "../Common/Utils.h"
+
+#include <shared_mutex>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr size_t MAX_PAYLOAD_SIZE = 0xFFFF; // PacketHeader::payload_length ѵ
+
+            //  CRC ٿ  ۷ 
+            std::vector<char> MakePacket(uint16_t packet_id, const std::string& payload) {
+                Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(payload.size()),
+                    Common::Utils::CryptoUtils::CalculateCRC32(payload.data(), payload.size()));
+
+                std::vector<char> packet(sizeof(header) + payload.size());
+                memcpy(packet.data(), &header, sizeof(header));
+                memcpy(packet.data() + sizeof(header), payload.data(), payload.size());
+                return packet;
+            }
+
+            void SendPayload(Session* session, uint16_t packet_id, const std::string& payload) {
+                const std::vector<char> packet = MakePacket(packet_id, payload);
+                session->PostSend(packet.data(), packet.size());
+            }
+
+            // ڵ鷯 ġ ʴ LOGIN_RES  
+            void SendLoginRejected(Session* session, int32_t error_code, const std::string& message,
+                uint32_t queue_position = 0) {
+                SendPayload(session, Protocol::PacketID::LOGIN_RES,
+                    Protocol::LoginResponseCodec::Encode(false, 0, message, error_code, queue_position));
+            }
+
+            // ä/ ˸ timestamp (н и)
+            int64_t NowUnixMs() {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+
+            //  濡   ڿ USER_LEFT_ROOM_NTF. 濡  nullptr
+            ChatRoom* LeaveCurrentRoom(Session* session) {
+                ChatRoom* room = session->LeaveRoom();
+                if (room) {
+                    const std::vector<char> packet = MakePacket(Protocol::PacketID::USER_LEFT_ROOM_NTF,
+                        Protocol::RoomCodec::EncodeUserLeftNotify(room->GetRoomId(), session->GetUserId(), NowUnixMs()));
+                    room->BroadcastMessage(packet.data(), packet.size(), session);
+                }
+                return room;
+            }
+
+            // ENTER_ROOM_RES (  ̸   ȿ ȣǹǷ   ۺ  )
+            void SendEnterResult(Session* session, ChatRoom* room, bool entered, uint32_t history_count) {
+                if (!entered) {
+                    if (session->GetCurrentRoom() == room) {
+                        session->LeaveRoom();
+                    }
+                    SendPayload(session, Protocol::PacketID::ENTER_ROOM_RES, Protocol::RoomCodec::EncodeEnterResponse(
+                        false, room->GetRoomId(), "", {}, room->IsFull() ? "room full" : "wrong password", {}, 0));
+                    return;
+                }
+
+                // ֱ  ֽ ͺ,    ڸŭ  ̷ε ѵ  ʰ 
+                ChatHistoryLog* history = room->GetHistory();
+                const uint64_t last_sequence = history ? history->GetLastSequence() : 0;
+                size_t budget = MAX_PAYLOAD_SIZE - Protocol::RoomCodec::EncodeEnterResponse(
+                    true, room->GetRoomId(), room->GetTitle(), {}, "", {}, last_sequence).size();
+
+                std::vector<std::string> recent;
+                if (history) {
+                    const size_t count = history_count != 0
+                        ? std::min(history_count, Protocol::Config::HISTORY_REPLAY_MAX)
+                        : Protocol::Config::HISTORY_REPLAY_DEFAULT;
+                    history->ForEachRecent(count, [&recent](const HistoryRecordView& record) {
+                        recent.push_back(Protocol::RoomCodec::EncodeChatNotify(std::string(record.sender_id),
+                            std::string(record.message), record.timestamp, record.message_type));
+                    });
+                }
+                size_t first_recent = recent.size();
+                while (first_recent > 0) {
+                    const size_t size = Protocol::RoomCodec::GetMessageFieldSize(6, recent[first_recent - 1].size());
+                    if (size > budget) {
+                        break;
+                    }
+                    budget -= size;
+                    --first_recent;
+                }
+                recent.erase(recent.begin(), recent.begin() + first_recent);
+
+                const int64_t now = NowUnixMs();
+                std::vector<std::string> users;
+                for (const std::string& user_id : room->GetParticipantIds()) {
+                    std::string user_info = Protocol::RoomCodec::EncodeUserInfo(user_id, 0);
+                    const size_t size = Protocol::RoomCodec::GetMessageFieldSize(4, user_info.size());
+                    if (size > budget) {
+                        break;
+                    }
+                    budget -= size;
+                    users.push_back(std::move(user_info));
+                }
+
+                SendPayload(session, Protocol::PacketID::ENTER_ROOM_RES, Protocol::RoomCodec::EncodeEnterResponse(
+                    true, room->GetRoomId(), room->GetTitle(), users, "", recent, last_sequence));
+
+                const std::vector<char> notify = MakePacket(Protocol::PacketID::NEW_USER_IN_ROOM_NTF,
+                    Protocol::RoomCodec::EncodeNewUserNotify(room->GetRoomId(), session->GetUserId(), now));
+                room->BroadcastMessage(notify.data(), notify.size(), session);
+            }
+        }
+
+        PacketDispatcher* PacketDispatcher::instance_ = nullptr;
+        std::once_flag PacketDispatcher::init_flag_;
+
+        PacketDispatcher* PacketDispatcher::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new PacketDispatcher();
+            });
+            return instance_;
+        }
+
+        PacketDispatcher::PacketDispatcher() = default;
+        PacketDispatcher::~PacketDispatcher() = default;
+
+        void PacketDispatcher::RegisterHandler(uint16_t packet_id, std::unique_ptr<IPacketHandler> handler) {
+            std::unique_lock<std::shared_mutex> lock(handlers_mutex_);
+            handlers_[packet_id] = std::move(handler);
+        }
+
+        void PacketDispatcher::RegisterAsyncHandler(uint16_t packet_id, std::unique_ptr<IAsyncPacketHandler> handler) {
+            std::unique_lock<std::shared_mutex> lock(handlers_mutex_);
+            async_handlers_[packet_id] = std::move(handler);
+        }
+
+        void PacketDispatcher::UnregisterHandler(uint16_t packet_id) {
+            std::unique_lock<std::shared_mutex> lock(handlers_mutex_);
+            handlers_.erase(packet_id);
+            async_handlers_.erase(packet_id);
+        }
+
+        PacketDispatcher::PacketBuffer PacketDispatcher::CopyPacket(const Protocol::PacketHeader* header, const char* payload) {
+            const size_t payload_size = header->payload_length;
+            auto packet = std::make_shared<std::vector<char>>(sizeof(Protocol::PacketHeader) + payload_size);
+            memcpy(packet->data(), header, sizeof(Protocol::PacketHeader));
+            memcpy(packet->data() + sizeof(Protocol::PacketHeader), payload, payload_size);
+            return packet;
+        }
+
+        bool PacketDispatcher::DispatchPacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            std::shared_ptr<IAsyncPacketHandler> async_handler;
+            {
+                std::shared_lock<std::shared_mutex> lock(handlers_mutex_);
+                auto async_it = async_handlers_.find(header->packet_id);
+                if (async_it == async_handlers_.end()) {
+                    auto it = handlers_.find(header->packet_id);
+                    if (it == handlers_.end()) {
+                        STATS_INCREMENT("packet.unhandled");
+                        return false;
+                    }
+                    return it->second->HandlePacket(session, header, payload);
+                }
+                async_handler = async_it->second;
+            }
+
+            // ȣ  ۴ ڷƾ ߴܵ    Ƿ 
+            return StartAsyncHandler(std::move(async_handler), session, CopyPacket(header, payload));
+        }
+
+        bool PacketDispatcher::DispatchCopied(Session* session, const PacketBuffer& packet, std::function<void(bool)> on_complete) {
+            auto* header = reinterpret_cast<Protocol::PacketHeader*>(packet->data());
+
+            std::shared_ptr<IAsyncPacketHandler> async_handler;
+            bool result = false;
+            {
+                std::shared_lock<std::shared_mutex> lock(handlers_mutex_);
+                auto async_it = async_handlers_.find(header->packet_id);
+                if (async_it != async_handlers_.end()) {
+                    async_handler = async_it->second;
+                }
+                else {
+                    auto it = handlers_.find(header->packet_id);
+                    if (it == handlers_.end()) {
+                        STATS_INCREMENT("packet.unhandled");
+                    }
+                    else {
+                        result = it->second->HandlePacket(session, header, packet->data() + sizeof(Protocol::PacketHeader));
+                    }
+                }
+            }
+
+            if (!async_handler) {
+                if (on_complete) {
+                    on_complete(result);
+                }
+                return result;
+            }
+
+            // ̹ 纻̹Ƿ ״ ڷƾ ѱ
+            return StartAsyncHandler(std::move(async_handler), session, packet, std::move(on_complete));
+        }
+
+        bool PacketDispatcher::StartAsyncHandler(std::shared_ptr<IAsyncPacketHandler> handler, Session* session, PacketBuffer packet,
+            std::function<void(bool)> on_complete) {
+            auto* header = reinterpret_cast<Protocol::PacketHeader*>(packet->data());
+            char* payload = packet->data() + sizeof(Protocol::PacketHeader);
+
+            STATS_INCREMENT("packet.async_started");
+            // ڵ鷯 Ŷ 纻 ڷƾ   Ϸ ݹ  
+            Task<bool> task = handler->HandleAsync(session, header, payload);
+            SpawnTask(std::move(task), [handler, packet, on_complete = std::move(on_complete)](bool success) {
+                if (!success) {
+                    STATS_INCREMENT("packet.handler_failures");
+                }
+                if (on_complete) {
+                    on_complete(success);
+                }
+            });
+            return true;
+        }
+
+        bool PacketDispatcher::DispatchAsync(Session* session, Protocol::PacketHeader* header, const char* payload) {
+            const RateLimitAction action = RateLimiter::GetInstance()->Check(session->GetRateState(), header->packet_id,
+                header->payload_length, RateLimiter::NowMs());
+            if (action == RateLimitAction::KICK) {
+                return false;
+            }
+            if (action == RateLimitAction::DROP) {
+                return true;
+            }
+
+            // ޸ ѵ   ακ   (̹ α   ó)
+            if (header->packet_id == Protocol::PacketID::LOGIN_REQ &&
+                Common::MemoryAccountant::GetInstance()->ShouldRejectLogins()) {
+                STATS_INCREMENT("memory.logins_rejected");
+                SendLoginRejected(session, Protocol::ErrorCode::SERVER_BUSY, "server busy");
+                return true;
+            }
+            if (header->packet_id == Protocol::PacketID::LOGIN_REQ) {
+                AdmitLogin(session, CopyPacket(header, payload));
+                return true;
+            }
+
+            Protocol::PacketClass lane;
+            if (!session->GetReceiveLane(header->packet_id, lane)) {
+                STATS_INCREMENT("packet.dropped_before_login");
+                return true;
+            }
+
+            //  ۴   ſ ٽ ̹Ƿ Ŷ  ѱ
+            PacketBuffer packet = CopyPacket(header, payload);
+
+            const uint64_t session_id = session->GetSessionId();
+            session->GetStrand(lane)->Post([this, session_id, packet]() {
+                EpochGuard guard;
+                Session* target = SessionManager::GetInstance()->FindSession(session_id);
+                if (!target) {
+                    return; // ó   
+                }
+
+                if (!DispatchCopied(target, packet)) {
+                    STATS_INCREMENT("packet.handler_failures");
+                }
+            });
+            return true;
+        }
+
+        void PacketDispatcher::AdmitLogin(Session* session, PacketBuffer packet) {
+            const uint64_t session_id = session->GetSessionId();
+            std::shared_ptr<TaskStrand> strand = session->GetStrand(Protocol::PacketClass::CONTROL);
+
+            // ʰ   Ʈ忡 óϰ, ڵ鷯 (  ٷ) ڸ ݳ
+            auto start = [this, session_id, strand, packet]() {
+                strand->Post([this, session_id, packet]() {
+                    EpochGuard guard;
+                    Session* target = SessionManager::GetInstance()->FindSession(session_id);
+                    if (!target) {
+                        LoginAdmission::GetInstance()->Complete();
+                        return;
+                    }
+
+                    if (!DispatchCopied(target, packet, [](bool) { LoginAdmission::GetInstance()->Complete(); })) {
+                        STATS_INCREMENT("packet.handler_failures");
+                    }
+                });
+            };
+
+            uint32_t position = 0;
+            switch (LoginAdmission::GetInstance()->Request(session_id, std::move(start), position)) {
+            case LoginAdmission::Result::QUEUED:
+                SendLoginRejected(session, Protocol::ErrorCode::LOGIN_QUEUED, "login queued", position);
+                break;
+            case LoginAdmission::Result::REJECTED:
+                SendLoginRejected(session, Protocol::ErrorCode::SERVER_BUSY, "login queue full");
+                break;
+            default:
+                break;
+            }
+        }
+
+        void PacketDispatcher::SetTrafficAnalyzer(std::shared_ptr<ServerTrafficAnalyzer> analyzer) {
+            std::unique_lock<std::shared_mutex> lock(handlers_mutex_);
+            traffic_analyzer_ = std::move(analyzer);
+        }
+
+        std::shared_ptr<ServerTrafficAnalyzer> PacketDispatcher::GetTrafficAnalyzer() {
+            std::shared_lock<std::shared_mutex> lock(handlers_mutex_);
+            return traffic_analyzer_;
+        }
+
+        std::vector<uint16_t> PacketDispatcher::GetRegisteredPacketIds() const {
+            std::shared_lock<std::shared_mutex> lock(handlers_mutex_);
+            std::vector<uint16_t> packet_ids;
+            packet_ids.reserve(handlers_.size() + async_handlers_.size());
+            for (const auto& entry : handlers_) {
+                packet_ids.push_back(entry.first);
+            }
+            for (const auto& entry : async_handlers_) {
+                if (handlers_.find(entry.first) == handlers_.end()) {
+                    packet_ids.push_back(entry.first);
+                }
+            }
+            return packet_ids;
+        }
+
+        bool LoginHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            std::string user_id;
+            std::string password;
+            if (!Protocol::LoginRequestCodec::Decode(payload, header->payload_length, user_id, password)) {
+                return false;
+            }
+
+            if (session->IsLoggedIn()) {
+                SendLoginRejected(session, Protocol::ErrorCode::USER_ALREADY_LOGGED_IN, "already logged in");
+                return true;
+            }
+            if (user_id.empty()) {
+                SendLoginRejected(session, Protocol::ErrorCode::INVALID_USER_ID, "empty user id");
+                return true;
+            }
+
+            //  Ұ Ƿ йȣ ˻ .  ID   
+            session->SetLoggedIn(user_id);
+            SessionManager::GetInstance()->BindUserId(session, user_id);
+            const std::string resume_token = SessionManager::GetInstance()->EnableResume(session);
+
+            SendPayload(session, Protocol::PacketID::LOGIN_RES, Protocol::LoginResponseCodec::Encode(
+                true, session->GetSessionId(), "", Protocol::ErrorCode::SUCCESS, 0, resume_token));
+            STATS_INCREMENT("session.logins");
+            return true;
+        }
+
+        bool ResumeHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            std::string token;
+            uint64_t last_sequence = 0;
+            if (!Protocol::SessionResumeCodec::DecodeRequest(payload, header->payload_length, token, last_sequence)) {
+                return false;
+            }
+
+            //    Ŷ   ϹǷ Ѱܹ޴ ߿ 
+            int32_t error_code = Protocol::ErrorCode::SUCCESS;
+            const bool resumed = SessionManager::GetInstance()->ResumeSession(session, token, last_sequence,
+                [session](size_t replay_count) {
+                    SendPayload(session, Protocol::PacketID::RESUME_RES, Protocol::SessionResumeCodec::EncodeResponse(
+                        true, session->GetSessionId(), "", Protocol::ErrorCode::SUCCESS, static_cast<uint32_t>(replay_count)));
+                }, error_code);
+
+            if (!resumed) {
+                SendPayload(session, Protocol::PacketID::RESUME_RES,
+                    Protocol::SessionResumeCodec::EncodeResponse(false, 0, "resume failed", error_code, 0));
+            }
+            return true;
+        }
+
+        bool LogoutHandler::HandlePacket(Session* session, Protocol::PacketHeader*, char*) {
+            if (!session->IsLoggedIn()) {
+                SendPayload(session, Protocol::PacketID::LOGOUT_RES, Protocol::LogoutCodec::EncodeResponse(false, "not logged in"));
+                return true;
+            }
+
+            // α׾ƿ   ܵ   ƴ (Detach α Ǹ )
+            LeaveCurrentRoom(session);
+            session->SetLoggedOut();
+            SendPayload(session, Protocol::PacketID::LOGOUT_RES, Protocol::LogoutCodec::EncodeResponse(true, ""));
+            STATS_INCREMENT("session.logouts");
+            return true;
+        }
+
+        bool EnterRoomHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            Protocol::RoomCodec::EnterRequest request;
+            if (!Protocol::RoomCodec::DecodeEnterRequest(payload, header->payload_length, request)) {
+                return false;
+            }
+
+            ChatRoom* room = RoomManager::GetInstance()->FindRoom(request.room_id);
+            if (!room) {
+                SendPayload(session, Protocol::PacketID::ENTER_ROOM_RES, Protocol::RoomCodec::EncodeEnterResponse(
+                    false, request.room_id, "", {}, "room not found", {}, 0));
+                return true;
+            }
+            if (session->GetCurrentRoom() == room) {
+                SendPayload(session, Protocol::PacketID::ENTER_ROOM_RES, Protocol::RoomCodec::EncodeEnterResponse(
+                    false, request.room_id, "", {}, "already in room", {}, 0));
+                return true;
+            }
+
+            //      ξ,    ŵǸ    ȸ  ڿ  
+            LeaveCurrentRoom(session);
+            session->EnterRoom(room);
+
+            const uint32_t history_count = request.history_count;
+            room->EnterAsync(session, request.password, [session, room, history_count](bool entered) {
+                SendEnterResult(session, room, entered, history_count);
+            });
+            return true;
+        }
+
+        bool LeaveRoomHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            uint32_t room_id = 0;
+            if (!Protocol::RoomCodec::DecodeLeaveRequest(payload, header->payload_length, room_id)) {
+                return false;
+            }
+
+            ChatRoom* room = session->GetCurrentRoom();
+            if (!room || (room_id != 0 && room->GetRoomId() != room_id)) {
+                STATS_INCREMENT("room.leave_not_in_room");
+                return true;
+            }
+            LeaveCurrentRoom(session);
+            return true;
+        }
+
+        bool ChatMessageHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            Protocol::RoomCodec::ChatRequest request;
+            if (!Protocol::RoomCodec::DecodeChatRequest(payload, header->payload_length, request)) {
+                return false;
+            }
+
+            ChatRoom* room = session->GetCurrentRoom();
+            if (!room) {
+                STATS_INCREMENT("chat.outside_room");
+                return true;
+            }
+
+            const int64_t timestamp = NowUnixMs();
+            const std::string notify = Protocol::RoomCodec::EncodeChatNotify(session->GetUserId(), request.message,
+                timestamp, request.message_type);
+
+            // ӼӸ 󿡰Ը  Ͽ  
+            if (request.message_type == Protocol::RoomCodec::MESSAGE_WHISPER && !request.target_user.empty()) {
+                const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, notify);
+                room->SendToUser(packet.data(), packet.size(), request.target_user);
+                return true;
+            }
+
+            room->BroadcastChatNotify(notify.data(), notify.size());
+            room->RecordMessage(session->GetUserId(), request.message, request.message_type, timestamp);
+            return true;
+        }
+
+        bool FileUploadHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            if (header->packet_id == Protocol::PacketID::FILE_CHUNK_SEND) {
+                return HandleChunk(session, header, payload);
+            }
+
+            Protocol::FileUploadCodec::Request request;
+            if (!Protocol::FileUploadCodec::DecodeRequest(payload, header->payload_length, request)) {
+                return false;
+            }
+
+            FileTransferManager* transfers = FileTransferManager::GetInstance();
+
+            //  ε ̾ޱ:   ûũ  ˷
+            if (request.resume_upload_id != 0) {
+                std::vector<UploadJournal::ChunkRange> missing;
+                if (!transfers->ResumeFileUpload(request.resume_upload_id, session->GetUserId(), missing)) {
+                    SendPayload(session, Protocol::PacketID::FILE_UPLOAD_RES, Protocol::FileUploadCodec::EncodeResponse(
+                        false, request.resume_upload_id, 0, "upload not resumable", 0, false, {}, false, ""));
+                    return true;
+                }
+
+                std::vector<std::string> ranges;
+                ranges.reserve(missing.size());
+                for (const UploadJournal::ChunkRange& range : missing) {
+                    ranges.push_back(Protocol::FileUploadCodec::EncodeChunkRange(range.first, range.count));
+                }
+                SendPayload(session, Protocol::PacketID::FILE_UPLOAD_RES, Protocol::FileUploadCodec::EncodeResponse(
+                    true, request.resume_upload_id, Protocol::Config::UPLOAD_CHUNK_SIZE, "",
+                    Common::Utils::ChunkHashVerifier::DEFAULT_REORDER_WINDOW, true, ranges, false, ""));
+                return true;
+            }
+
+            const uint64_t upload_id = transfers->StartFileUpload(request.file_name, request.file_size,
+                request.file_hash, session->GetUserId(), request.target_user);
+            FileTransferManager::FileTransferInfo* info = upload_id != 0 ? transfers->GetTransferInfo(upload_id) : nullptr;
+            if (!info) {
+                SendPayload(session, Protocol::PacketID::FILE_UPLOAD_RES, Protocol::FileUploadCodec::EncodeResponse(
+                    false, 0, 0, "upload rejected", 0, false, {}, false, ""));
+                return true;
+            }
+
+            //   ̹   ûũ  Ϸ
+            if (info->is_deduplicated) {
+                SendPayload(session, Protocol::PacketID::FILE_UPLOAD_RES, Protocol::FileUploadCodec::EncodeResponse(
+                    true, upload_id, info->chunk_size, "", 0, false, {}, true, info->stored_file_path));
+                return true;
+            }
+            SendPayload(session, Protocol::PacketID::FILE_UPLOAD_RES, Protocol::FileUploadCodec::EncodeResponse(
+                true, upload_id, info->chunk_size, "", info->hash_verifier->GetReorderWindow(), false, {}, false, ""));
+            return true;
+        }
+
+        bool FileUploadHandler::HandleChunk(Session* session, Protocol::PacketHeader* header, char* payload) {
+            Protocol::FileUploadCodec::Chunk chunk;
+            if (!Protocol::FileUploadCodec::DecodeChunk(payload, header->payload_length, chunk)) {
+                return false;
+            }
+
+            // ٸ  ε ID  ûũ 
+            FileTransferManager* transfers = FileTransferManager::GetInstance();
+            FileTransferManager::FileTransferInfo* info = transfers->GetTransferInfo(chunk.upload_id);
+            if (!info || info->sender_id != session->GetUserId()) {
+                STATS_INCREMENT("file.chunks_rejected");
+                return true;
+            }
+            if (!transfers->ProcessFileChunk(chunk.upload_id, chunk.chunk_index, chunk.chunk_data, chunk.chunk_size)) {
+                return true; //  ̳ ũⰡ  ʴ ûũ ڰ 迡 
+            }
+
+            //   ûũ  Ʈ忡 ʷ Ƿ  ûũ  ȣ Ϸ ó
+            bool all_received = false;
+            {
+                std::lock_guard<std::mutex> lock(info->transfer_mutex);
+                all_received = !info->is_complete && info->received_chunks == info->total_chunks;
+            }
+            if (!all_received) {
+                return true;
+            }
+
+            if (transfers->CompleteTransfer(chunk.upload_id)) {
+                SendPayload(session, Protocol::PacketID::FILE_UPLOAD_COMPLETE_NTF, Protocol::FileUploadCodec::EncodeCompleteNotify(
+                    chunk.upload_id, true, info->stored_file_path, ""));
+                return true;
+            }
+
+            SendPayload(session, Protocol::PacketID::FILE_UPLOAD_COMPLETE_NTF, Protocol::FileUploadCodec::EncodeCompleteNotify(
+                chunk.upload_id, false, "", "hash mismatch"));
+            transfers->CancelTransfer(chunk.upload_id);
+            return true;
+        }
+
+        bool FileDownloadHandler::HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) {
+            Protocol::FileDownloadCodec::Request request;
+            if (!Protocol::FileDownloadCodec::DecodeRequest(payload, header->payload_length, request)) {
+                return false;
+            }
+
+            FileDownloadManager* downloads = FileDownloadManager::GetInstance();
+            FileDownloadManager::DownloadInfo info;
+            const int32_t error_code = downloads->StartDownload(session, request.file_path,
+                request.offset, request.length, request.if_version, info);
+            if (error_code != Protocol::ErrorCode::SUCCESS) {
+                SendPayload(session, Protocol::PacketID::FILE_DOWNLOAD_RES, Protocol::FileDownloadCodec::EncodeResponse(
+                    false, 0, 0, request.offset, 0, 0, error_code, "download rejected"));
+                return true;
+            }
+
+            //  ù  Ӻ    ť ø   
+            SendPayload(session, Protocol::PacketID::FILE_DOWNLOAD_RES, Protocol::FileDownloadCodec::EncodeResponse(
+                true, info.download_id, info.file->GetSize(), info.range_begin, info.range_end - info.range_begin,
+                info.file->GetVersion(), Protocol::ErrorCode::SUCCESS, ""));
+            downloads->PumpDownload(session, info.download_id);
+            return true;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
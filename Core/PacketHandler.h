@@ -8,6 +8,7 @@
 #include <atomic>
 #include <functional>
 #include "../Common/Protocol.h"
+#include "Coroutine.h"
 
 namespace NexusCore {
     namespace Core {
@@ -287,6 +288,18 @@ namespace NexusCore {
             virtual uint16_t GetPacketId() const = 0;
         };
 
+        // ڷƾ Ŷ ó
+        // ũ/ٸ /Ÿ̸Ӹ ٸ  Ŀ  ʰ Ӹ . 簳  Ʈ忡 ϹǷ
+        // ڵ鷯    ٸ Ŷ ó ġ , co_await ̿  Ŷ ó  ִ.
+        // session ù co_await  ȿ.  ڿ  ID SessionManager ٽ ã,
+        // EpochGuard co_await ʸӷ   ʴ´ (簳  ̹ EpochGuard ȿ ).
+        class IAsyncPacketHandler {
+        public:
+            virtual ~IAsyncPacketHandler() = default;
+            virtual Task<bool> HandleAsync(Session* session, Protocol::PacketHeader* header, char* payload) = 0;
+            virtual uint16_t GetPacketId() const = 0;
+        };
+
         // Ŷ ó   ġ
         class PacketDispatcher {
         public:
@@ -294,11 +307,18 @@ namespace NexusCore {
 
             // ڵ鷯 
             void RegisterHandler(uint16_t packet_id, std::unique_ptr<IPacketHandler> handler);
-            void UnregisterHandler(uint16_t packet_id);
+            void RegisterAsyncHandler(uint16_t packet_id, std::unique_ptr<IAsyncPacketHandler> handler); //  ID  ڵ鷯 켱
+            void UnregisterHandler(uint16_t packet_id); // /ڷƾ  (  ڷƾ  )
 
-            // Ŷ ó
+            // Ŷ ó (ȣ 忡 ٷ ). ڷƾ ڵ鷯 Ŷ  ۸ ϰ true
             bool DispatchPacket(Session* session, Protocol::PacketHeader* header, char* payload);
 
+            // IO :  ѵ ˻  Ŷ    Ŭ Ʈ忡 ְ ٷ ȯ.
+            // ڵ鷯 TaskScheduler Ŀ /Ŭ   Ǹ,    ŵ ǳʶ.
+            // LOGIN_REQ LoginAdmission   ȿ ϰ, ⿭    LOGIN_RES  .
+            // ѵ ʰ  Ŷ /Ų αε true,   ϸ false
+            bool DispatchAsync(Session* session, Protocol::PacketHeader* header, const char* payload);
+
             // npcap м 
             void SetTrafficAnalyzer(std::shared_ptr<ServerTrafficAnalyzer> analyzer);
             std::shared_ptr<ServerTrafficAnalyzer> GetTrafficAnalyzer();
@@ -310,8 +330,18 @@ namespace NexusCore {
             PacketDispatcher();
             ~PacketDispatcher();
 
+            using PacketBuffer = std::shared_ptr<std::vector<char>>; //  + ̷ε 纻
+
+            static PacketBuffer CopyPacket(const Protocol::PacketHeader* header, const char* payload);
+            // on_complete: ڵ鷯   Բ ȣ (ڷƾ ڵ鷯 ڷƾ  )
+            bool DispatchCopied(Session* session, const PacketBuffer& packet, std::function<void(bool)> on_complete = nullptr);
+            bool StartAsyncHandler(std::shared_ptr<IAsyncPacketHandler> handler, Session* session, PacketBuffer packet,
+                std::function<void(bool)> on_complete = nullptr);
+            void AdmitLogin(Session* session, PacketBuffer packet);
+
             mutable std::shared_mutex handlers_mutex_;
             std::unordered_map<uint16_t, std::unique_ptr<IPacketHandler>> handlers_;
+            std::unordered_map<uint16_t, std::shared_ptr<IAsyncPacketHandler>> async_handlers_; //   ڷƾ Բ 
 
             // npcap 
             std::shared_ptr<ServerTrafficAnalyzer> traffic_analyzer_;
@@ -321,12 +351,20 @@ namespace NexusCore {
         };
 
         // ü Ŷ ڵ鷯 ( )
+        // α   SessionManager::EnableResume  ū LOGIN_RES resume_token 
         class LoginHandler : public IPacketHandler {
         public:
             bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override;
             uint16_t GetPacketId() const override { return Protocol::PacketID::LOGIN_REQ; }
         };
 
+        //  (RESUME_REQ). α ⿭ ġ ʰ   α /   Ѱܹ
+        class ResumeHandler : public IPacketHandler {
+        public:
+            bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override;
+            uint16_t GetPacketId() const override { return Protocol::PacketID::RESUME_REQ; }
+        };
+
         class LogoutHandler : public IPacketHandler {
         public:
             bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override;
@@ -351,10 +389,20 @@ namespace NexusCore {
             uint16_t GetPacketId() const override { return Protocol::PacketID::ROOM_CHAT_REQ; }
         };
 
+        // FILE_UPLOAD_REQ FILE_CHUNK_SEND Բ ó ( ID  )
         class FileUploadHandler : public IPacketHandler {
         public:
             bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override;
             uint16_t GetPacketId() const override { return Protocol::PacketID::FILE_UPLOAD_REQ; }
+
+        private:
+            bool HandleChunk(Session* session, Protocol::PacketHeader* header, char* payload); //  ûũ Ϸ   ˸
+        };
+
+        class FileDownloadHandler : public IPacketHandler {
+        public:
+            bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override;
+            uint16_t GetPacketId() const override { return Protocol::PacketID::FILE_DOWNLOAD_REQ; }
         };
 
     } // namespace Core
@@ -0,0 +1,241 @@
+#include "pch.h"
+#include "RateLimiter.h"
+#include "Statistics.h"
+#include "../Common/Config.h"
+#include "../Common/MemoryAccountant.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            // Ŭ  ڿ  ü
+            const char* const SCOPE_NAMES[] = { "control", "chat", "bulk", "admin", "session" };
+            const char* const ACTION_SUFFIXES[] = { "", ".throttled", ".dropped", ".kicked" };
+
+            const char* GetActionName(RateLimitAction action) {
+                switch (action) {
+                case RateLimitAction::THROTTLE: return "throttle";
+                case RateLimitAction::DROP: return "drop";
+                case RateLimitAction::KICK: return "kick";
+                default: return "allow";
+                }
+            }
+
+            bool ParseAction(const std::string& name, RateLimitAction& out_action) {
+                if (name == "throttle") {
+                    out_action = RateLimitAction::THROTTLE;
+                }
+                else if (name == "drop") {
+                    out_action = RateLimitAction::DROP;
+                }
+                else if (name == "kick") {
+                    out_action = RateLimitAction::KICK;
+                }
+                else {
+                    return false;
+                }
+                return true;
+            }
+
+            //  ġϼ ſ (ALLOW < THROTTLE < DROP < KICK)
+            RateLimitAction Heavier(RateLimitAction lhs, RateLimitAction rhs) {
+                return static_cast<uint8_t>(lhs) >= static_cast<uint8_t>(rhs) ? lhs : rhs;
+            }
+        }
+
+        void RateLimiter::PolicySlot::Store(const RatePolicy& policy) {
+            rate_per_sec.store(policy.rate_per_sec, std::memory_order_relaxed);
+            burst.store(policy.burst > 0 ? policy.burst : 1, std::memory_order_relaxed);
+            action.store(policy.action, std::memory_order_relaxed);
+        }
+
+        RatePolicy RateLimiter::PolicySlot::Load() const {
+            return { rate_per_sec.load(std::memory_order_relaxed),
+                burst.load(std::memory_order_relaxed),
+                action.load(std::memory_order_relaxed) };
+        }
+
+        RateLimiter* RateLimiter::instance_ = nullptr;
+        std::once_flag RateLimiter::init_flag_;
+
+        RateLimiter* RateLimiter::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new RateLimiter();
+            });
+            return instance_;
+        }
+
+        RateLimiter::RateLimiter() {
+            ResetPolicies();
+        }
+
+        void RateLimiter::SetSessionPolicy(const RatePolicy& policy) {
+            session_policy_.Store(policy);
+        }
+
+        RatePolicy RateLimiter::GetSessionPolicy() const {
+            return session_policy_.Load();
+        }
+
+        void RateLimiter::SetClassPolicy(Protocol::PacketClass packet_class, const RatePolicy& policy) {
+            class_policies_[static_cast<size_t>(packet_class)].Store(policy);
+        }
+
+        RatePolicy RateLimiter::GetClassPolicy(Protocol::PacketClass packet_class) const {
+            return class_policies_[static_cast<size_t>(packet_class)].Load();
+        }
+
+        void RateLimiter::SetUploadBandwidth(uint64_t bytes_per_sec) {
+            upload_bytes_per_sec_ = bytes_per_sec;
+        }
+
+        void RateLimiter::ResetPolicies() {
+            using namespace Protocol::Config;
+            using Protocol::PacketClass;
+
+            SetSessionPolicy({ RATE_LIMIT_SESSION_PPS, RATE_LIMIT_SESSION_BURST, RateLimitAction::KICK });
+            SetClassPolicy(PacketClass::CONTROL, { RATE_LIMIT_CONTROL_PPS, RATE_LIMIT_CONTROL_BURST, RateLimitAction::DROP });
+            SetClassPolicy(PacketClass::CHAT, { RATE_LIMIT_CHAT_PPS, RATE_LIMIT_CHAT_BURST, RateLimitAction::THROTTLE });
+            SetClassPolicy(PacketClass::BULK, { RATE_LIMIT_BULK_PPS, RATE_LIMIT_BULK_BURST, RateLimitAction::THROTTLE });
+            SetClassPolicy(PacketClass::ADMIN, { RATE_LIMIT_ADMIN_PPS, RATE_LIMIT_ADMIN_BURST, RateLimitAction::DROP });
+            SetUploadBandwidth(UPLOAD_DISK_BYTES_PER_SEC);
+            upload_clock_us_ = 0;
+        }
+
+        void RateLimiter::LoadPolicyFromConfig(PolicySlot& slot, const char* scope) {
+            auto* config = Common::Config::GetInstance();
+            const std::string prefix = std::string("ratelimit.") + scope + ".";
+            RatePolicy policy = slot.Load();
+
+            policy.rate_per_sec = static_cast<uint32_t>((std::max)(0, config->GetInt(prefix + "rate",
+                static_cast<int>(policy.rate_per_sec))));
+            policy.burst = static_cast<uint32_t>((std::max)(1, config->GetInt(prefix + "burst",
+                static_cast<int>(policy.burst))));
+            ParseAction(config->GetString(prefix + "action", GetActionName(policy.action)), policy.action);
+
+            slot.Store(policy);
+        }
+
+        void RateLimiter::LoadFromConfig() {
+            LoadPolicyFromConfig(session_policy_, "session");
+            for (size_t packet_class = 0; packet_class < Protocol::PACKET_CLASS_COUNT; ++packet_class) {
+                LoadPolicyFromConfig(class_policies_[packet_class], SCOPE_NAMES[packet_class]);
+            }
+
+            const double upload = Common::Config::GetInstance()->GetDouble("ratelimit.upload_bytes_per_sec",
+                static_cast<double>(upload_bytes_per_sec_.load()));
+            SetUploadBandwidth(upload > 0.0 ? static_cast<uint64_t>(upload) : 0);
+        }
+
+        RateLimitAction RateLimiter::Check(SessionRateState& state, uint16_t packet_id, uint32_t payload_bytes, int64_t now_ms) {
+            const Protocol::PacketClass packet_class = Protocol::GetPacketClass(packet_id);
+            const size_t class_index = static_cast<size_t>(packet_class);
+
+            RateLimitAction action = Take(state.session_bucket, session_policy_.Load(), state, now_ms, SESSION_SCOPE);
+            if (action == RateLimitAction::KICK) {
+                return action;
+            }
+            action = Heavier(action, Take(state.class_buckets[class_index], class_policies_[class_index].Load(),
+                state, now_ms, class_index));
+
+            if (action <= RateLimitAction::THROTTLE && packet_id == Protocol::PacketID::FILE_CHUNK_SEND) {
+                if (Common::MemoryAccountant::GetInstance()->ShouldPauseUploads()) {
+                    // ޸ ѵ:  ûũ óϵ δ  б⸦ ̷
+                    state.throttled_until_ms = (std::max)(state.throttled_until_ms,
+                        now_ms + static_cast<int64_t>(Protocol::Config::MEMORY_UPLOAD_PAUSE_MS));
+                    STATS_INCREMENT("memory.uploads_paused");
+                    return RateLimitAction::THROTTLE;
+                }
+                action = Heavier(action, ShapeUpload(state, payload_bytes, now_ms));
+            }
+            return action;
+        }
+
+        RateLimitAction RateLimiter::Take(TokenBucketState& bucket, const RatePolicy& policy,
+            SessionRateState& state, int64_t now_ms, size_t scope) {
+            if (policy.rate_per_sec == 0) {
+                return RateLimitAction::ALLOW;
+            }
+
+            const float burst = static_cast<float>(policy.burst);
+            const uint32_t now_low = static_cast<uint32_t>(now_ms) | 1; // 0 ̻ ǥö 
+            if (bucket.last_refill_ms == 0) {
+                bucket.tokens = burst;
+            }
+            else {
+                // 32Ʈ ̶ ð   Ƶ  ð 
+                const uint32_t elapsed_ms = now_low - bucket.last_refill_ms;
+                bucket.tokens = (std::min)(burst,
+                    bucket.tokens + static_cast<float>(elapsed_ms) * policy.rate_per_sec / 1000.0f);
+            }
+            bucket.last_refill_ms = now_low;
+
+            if (bucket.tokens >= 1.0f) {
+                bucket.tokens -= 1.0f;
+                return RateLimitAction::ALLOW;
+            }
+
+            if (policy.action == RateLimitAction::THROTTLE) {
+                //  burst ׾ ƹ   ߴ ð   ʰ 
+                bucket.tokens = (std::max)(bucket.tokens - 1.0f, -burst);
+                const int64_t wait_ms = static_cast<int64_t>((1.0f - bucket.tokens) * 1000.0f / policy.rate_per_sec) + 1;
+                state.throttled_until_ms = (std::max)(state.throttled_until_ms, now_ms + wait_ms);
+            }
+
+            limited_counts_[scope][static_cast<size_t>(policy.action)].fetch_add(1, std::memory_order_relaxed);
+            return policy.action;
+        }
+
+        void RateLimiter::PublishStats() const {
+            static_assert(sizeof(SCOPE_NAMES) / sizeof(SCOPE_NAMES[0]) == SCOPE_COUNT, "scope names");
+            static_assert(sizeof(ACTION_SUFFIXES) / sizeof(ACTION_SUFFIXES[0]) == ACTION_COUNT, "action suffixes");
+
+            Statistics* stats = Statistics::GetInstance();
+            for (size_t scope = 0; scope < SCOPE_COUNT; ++scope) {
+                for (size_t action = static_cast<size_t>(RateLimitAction::THROTTLE); action < ACTION_COUNT; ++action) {
+                    const uint64_t count = limited_counts_[scope][action].load(std::memory_order_relaxed);
+                    if (count != 0) {
+                        stats->SetCounter(std::string("ratelimit.") + SCOPE_NAMES[scope] + ACTION_SUFFIXES[action], count);
+                    }
+                }
+            }
+        }
+
+        RateLimitAction RateLimiter::ShapeUpload(SessionRateState& state, uint32_t bytes, int64_t now_ms) {
+            const uint64_t bytes_per_sec = upload_bytes_per_sec_.load(std::memory_order_relaxed);
+            if (bytes_per_sec == 0) {
+                return RateLimitAction::ALLOW;
+            }
+
+            const int64_t cost_us = static_cast<int64_t>(static_cast<uint64_t>(bytes) * 1000000 / bytes_per_sec);
+            const int64_t burst_us = static_cast<int64_t>(Protocol::Config::UPLOAD_SHAPING_BURST_MS) * 1000;
+            const int64_t now_us = now_ms * 1000;
+
+            //  뿪 burstŭ ̸   
+            int64_t reserved_end = 0;
+            int64_t previous_end = upload_clock_us_.load(std::memory_order_relaxed);
+            do {
+                reserved_end = (std::max)(previous_end, now_us - burst_us) + cost_us;
+            } while (!upload_clock_us_.compare_exchange_weak(previous_end, reserved_end, std::memory_order_relaxed));
+
+            if (reserved_end <= now_us + burst_us) {
+                return RateLimitAction::ALLOW;
+            }
+
+            //  ʹ ռ    ڱ ʰ     
+            state.throttled_until_ms = (std::max)(state.throttled_until_ms, (reserved_end - burst_us) / 1000);
+            STATS_INCREMENT("ratelimit.upload_shaped");
+            return RateLimitAction::THROTTLE;
+        }
+
+        int64_t RateLimiter::NowMs() {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+    } // namespace Core
+} // namespace NexusCore
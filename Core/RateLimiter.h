@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // ѵ  Ŷ ó 
+        enum class RateLimitAction : uint8_t {
+            ALLOW,    // 
+            THROTTLE, // Ű ū ٽ       (TCP 帧  ۽  )
+            DROP,     // ó ʰ 
+            KICK      //  
+        };
+
+        // ʴ ū rate_per_sec burst  Ŷ. rate 0̸  
+        struct RatePolicy {
+            uint32_t rate_per_sec;
+            uint32_t burst;
+            RateLimitAction action;
+        };
+
+        struct TokenBucketState {
+            float tokens = 0.0f;        // THROTTLE̸ () 
+            uint32_t last_refill_ms = 0; //  32Ʈ ð (0̸    Ŷ, ù    )
+        };
+
+        // Ǹ ϳ.  Ϸ ο ϹǷ  
+        struct SessionRateState {
+            TokenBucketState session_bucket;
+            TokenBucketState class_buckets[Protocol::PACKET_CLASS_COUNT];
+            int64_t throttled_until_ms = 0; //  ð  ٽ  
+        };
+
+        // Ǻ ū Ŷ ( ü +  Ŭ)  ε 뿪 й
+        // å    ߿ ٲ  ְ,    Ŷ ȴ.
+        // ε   ð ϳ ûũ  ð ϹǷ, ε  ǵ
+        // ũ  뿪    (  ϼ  ڷ з  ).
+        class RateLimiter {
+        public:
+            static RateLimiter* GetInstance();
+
+            //  ü ѵ (Ŭ ϰ  Ŷ Һ)
+            void SetSessionPolicy(const RatePolicy& policy);
+            RatePolicy GetSessionPolicy() const;
+
+            void SetClassPolicy(Protocol::PacketClass packet_class, const RatePolicy& policy);
+            RatePolicy GetClassPolicy(Protocol::PacketClass packet_class) const;
+
+            //  ε尡   ʴ Ʈ (0̸  )
+            void SetUploadBandwidth(uint64_t bytes_per_sec);
+            uint64_t GetUploadBandwidth() const { return upload_bytes_per_sec_; }
+
+            // Protocol::Config ⺻ ǵ (ε ൵ ʱȭ)
+            void ResetPolicies();
+
+            // "ratelimit.<session|control|chat|bulk|admin>.<rate|burst|action>",
+            // "ratelimit.upload_bytes_per_sec"  о å . action "throttle"/"drop"/"kick"
+            void LoadFromConfig();
+
+            //  Ŷ ϳ ˻ϰ ū Һ.  ſ ġ ȯϰ,
+            // THROTTLE̸ state.throttled_until_ms . ޸𸮰 Ʈ ѵ  ε ûũ ׻ THROTTLE
+            RateLimitAction Check(SessionRateState& state, uint16_t packet_id, uint32_t payload_bytes, int64_t now_ms);
+
+            // ѵ ɸ  "ratelimit.<scope>.<throttled|dropped|kicked>" īͷ ű ( ȭ  ֱ⿡ ȣ)
+            // ɸ  Statistics  ã Ŷ  ߿   Ƿ ҿ   
+            void PublishStats() const;
+
+            static int64_t NowMs();
+
+        private:
+            RateLimiter();
+            ~RateLimiter() = default;
+
+            struct PolicySlot {
+                std::atomic<uint32_t> rate_per_sec{ 0 };
+                std::atomic<uint32_t> burst{ 0 };
+                std::atomic<RateLimitAction> action{ RateLimitAction::DROP };
+
+                void Store(const RatePolicy& policy);
+                RatePolicy Load() const;
+            };
+
+            // Ŷ ū ϳ . ڶ å ġ ȯ
+            RateLimitAction Take(TokenBucketState& bucket, const RatePolicy& policy,
+                SessionRateState& state, int64_t now_ms, size_t scope);
+            RateLimitAction ShapeUpload(SessionRateState& state, uint32_t bytes, int64_t now_ms);
+            void LoadPolicyFromConfig(PolicySlot& slot, const char* scope);
+
+            static constexpr size_t SCOPE_COUNT = Protocol::PACKET_CLASS_COUNT + 1; // Ŭ +  ü()
+            static constexpr size_t SESSION_SCOPE = Protocol::PACKET_CLASS_COUNT;
+            static constexpr size_t ACTION_COUNT = 4;
+
+            PolicySlot session_policy_;
+            PolicySlot class_policies_[Protocol::PACKET_CLASS_COUNT];
+            std::atomic<uint64_t> upload_bytes_per_sec_{ 0 };
+            std::atomic<int64_t> upload_clock_us_{ 0 }; //  ε    ð
+            std::atomic<uint64_t> limited_counts_[SCOPE_COUNT][ACTION_COUNT] = {}; // [scope][ġ]
+
+            static RateLimiter* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "RoomFanout.h"
+#include "WorkerExecutor.h"
+#include "Statistics.h"
+#include "EpochReclaimer.h"
+
+#include <chrono>
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            //  ϳ  Ȳ ( ۾ )
+            struct FanoutProgress {
+                std::atomic<size_t> remaining_shards;
+                std::atomic<size_t> delivered{ 0 };
+                std::chrono::steady_clock::time_point started;
+                RoomFanout::CompletionCallback on_complete;
+
+                explicit FanoutProgress(size_t shards) : remaining_shards(shards) {}
+            };
+        }
+
+        RoomFanout::RoomFanout(uint32_t room_id, size_t shard_count, DeliveryCallback deliver)
+            : room_id_(room_id) {
+            const size_t worker_count = std::max<size_t>(1, WorkerExecutor::GetInstance()->GetWorkerCount());
+            if (shard_count == 0) {
+                shard_count = worker_count;
+            }
+
+            // 渶  Ŀ ޸     Ŀ  ʰ 
+            for (size_t i = 0; i < shard_count; ++i) {
+                auto shard = std::make_shared<Shard>();
+                shard->worker_index = (room_id + i) % worker_count;
+                shard->deliver = deliver;
+                shards_.push_back(std::move(shard));
+            }
+        }
+
+        RoomFanout::~RoomFanout() = default;
+
+        const std::shared_ptr<RoomFanout::Shard>& RoomFanout::GetShardFor(Session* session) const {
+            //   Ʈ   0̹Ƿ  
+            uint64_t key = reinterpret_cast<uintptr_t>(session);
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            return shards_[key % shards_.size()];
+        }
+
+        void RoomFanout::AddMember(Session* session) {
+            const auto& shard = GetShardFor(session);
+            ++member_count_;
+
+            WorkerExecutor::GetInstance()->Post(shard->worker_index, [shard, session]() {
+                EpochGuard guard;
+                if (shard->positions.emplace(session, shard->members.size()).second) {
+                    shard->members.push_back(session);
+                }
+            });
+        }
+
+        void RoomFanout::RemoveMember(Session* session) {
+            const auto& shard = GetShardFor(session);
+            --member_count_;
+
+            WorkerExecutor::GetInstance()->Post(shard->worker_index, [shard, session]() {
+                EpochGuard guard;
+                auto it = shard->positions.find(session);
+                if (it == shard->positions.end()) {
+                    return;
+                }
+
+                //   ڸ Ű O(1) 
+                const size_t index = it->second;
+                Session* last = shard->members.back();
+                shard->members[index] = last;
+                shard->positions[last] = index;
+                shard->members.pop_back();
+                shard->positions.erase(session);
+            });
+        }
+
+        void RoomFanout::RunAfterRemoval(Session* session, std::function<void()> func) {
+            //  Ŀ ۾   Ƿ RemoveMember       
+            WorkerExecutor::GetInstance()->Post(GetShardFor(session)->worker_index, std::move(func));
+        }
+
+        void RoomFanout::Broadcast(SharedPacket packet, Session* exclude_session, CompletionCallback on_complete) {
+            PostBroadcast(std::move(packet), exclude_session, nullptr, std::move(on_complete));
+        }
+
+        void RoomFanout::Broadcast(SharedPacket packet, std::shared_ptr<const PacketOverrides> overrides,
+            CompletionCallback on_complete) {
+            PostBroadcast(std::move(packet), nullptr, std::move(overrides), std::move(on_complete));
+        }
+
+        void RoomFanout::PostBroadcast(SharedPacket packet, Session* exclude_session,
+            std::shared_ptr<const PacketOverrides> overrides, CompletionCallback on_complete) {
+            auto progress = std::make_shared<FanoutProgress>(shards_.size());
+            progress->started = std::chrono::steady_clock::now();
+            progress->on_complete = std::move(on_complete);
+
+            for (const auto& shard : shards_) {
+                WorkerExecutor::GetInstance()->Post(shard->worker_index,
+                    [shard, packet, exclude_session, overrides, progress]() {
+                        size_t delivered = 0;
+                        EpochGuard guard; //  ͸   ٸ η ȸǴ  ȣ
+                        for (Session* session : shard->members) {
+                            if (session == exclude_session) {
+                                continue;
+                            }
+
+                            // ü Ŷ   ̶  Ž
+                            const SharedPacket* target = &packet;
+                            if (overrides) {
+                                auto it = std::find_if(overrides->begin(), overrides->end(),
+                                    [session](const auto& entry) { return entry.first == session; });
+                                if (it != overrides->end()) {
+                                    target = &it->second;
+                                }
+                            }
+                            if (*target) {
+                                shard->deliver(session, *target);
+                                ++delivered;
+                            }
+                        }
+                        progress->delivered += delivered;
+
+                        if (--progress->remaining_shards == 0) {
+                            auto elapsed = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - progress->started);
+                            STATS_RECORD("chat.fanout_complete_ms", elapsed.count());
+                            STATS_INCREMENT("chat.fanout_broadcasts");
+                            if (progress->on_complete) {
+                                progress->on_complete(progress->delivered);
+                            }
+                        }
+                    });
+            }
+        }
+
+    } // namespace Core
+} // namespace NexusCore
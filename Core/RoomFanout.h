@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        class Session; //  
+
+        //  ( ) Ҿƿ
+        // ڸ   帶  Ŀ ,      Ŀ óѴ.
+        //   ŭ ۾  ķ ,  Ŀ ۾ ֱ⸸ ϰ ٷ ƿ´.
+        class RoomFanout {
+        public:
+            using SharedPacket = std::shared_ptr<const std::vector<char>>;
+            using DeliveryCallback = std::function<void(Session* session, const SharedPacket& packet)>;
+            using CompletionCallback = std::function<void(size_t delivered)>;
+            using PacketOverrides = std::vector<std::pair<Session*, SharedPacket>>; // ں ü Ŷ (nullptr ǳʶ)
+
+            // shard_count 0̸ WorkerExecutor Ŀ 
+            RoomFanout(uint32_t room_id, size_t shard_count, DeliveryCallback deliver);
+            ~RoomFanout();
+
+            RoomFanout(const RoomFanout&) = delete;
+            RoomFanout& operator=(const RoomFanout&) = delete;
+
+            void AddMember(Session* session);
+            void RemoveMember(Session* session);
+
+            // ռ  session    忡 ó  func  (    session  )
+            void RunAfterRemoval(Session* session, std::function<void()> func);
+
+            //  忡  û.  尡  Ϸ  Statistics ϰ on_complete ȣ
+            void Broadcast(SharedPacket packet, Session* exclude_session = nullptr,
+                CompletionCallback on_complete = nullptr);
+
+            //  ڿԸ ٸ Ŷ   (ġ ˸ ڱ ޽  纻).  packet 
+            void Broadcast(SharedPacket packet, std::shared_ptr<const PacketOverrides> overrides,
+                CompletionCallback on_complete = nullptr);
+
+            size_t GetMemberCount() const { return member_count_; }
+            size_t GetShardCount() const { return shards_.size(); }
+
+        private:
+            //  Ŀ .     ۾ ϵ ۾ shared_ptr  
+            struct Shard {
+                size_t worker_index;
+                DeliveryCallback deliver;
+                std::vector<Session*> members;
+                std::unordered_map<Session*, size_t> positions; //  -> members ε (O(1) )
+            };
+
+            const std::shared_ptr<Shard>& GetShardFor(Session* session) const;
+            void PostBroadcast(SharedPacket packet, Session* exclude_session,
+                std::shared_ptr<const PacketOverrides> overrides, CompletionCallback on_complete);
+
+            uint32_t room_id_;
+            std::vector<std::shared_ptr<Shard>> shards_;
+            std::atomic<size_t> member_count_{ 0 };
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "Managers.h"
+#include "EpochReclaimer.h"
+#include "Statistics.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        RoomManager* RoomManager::instance_ = nullptr;
+        std::once_flag RoomManager::init_flag_;
+
+        RoomManager* RoomManager::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new RoomManager();
+            });
+            return instance_;
+        }
+
+        RoomManager::RoomManager() {
+            InitializeSRWLock(&rooms_lock_);
+        }
+
+        RoomManager::~RoomManager() = default;
+
+        ChatRoom* RoomManager::CreateRoom(const std::string& title, const std::string& password) {
+            AcquireSRWLockExclusive(&rooms_lock_);
+            if (rooms_.size() >= static_cast<size_t>(Protocol::Config::MAX_ROOMS)) {
+                ReleaseSRWLockExclusive(&rooms_lock_);
+                STATS_INCREMENT("room.create_rejected");
+                return nullptr;
+            }
+
+            const uint32_t room_id = next_room_id_.fetch_add(1);
+            auto room = std::make_unique<ChatRoom>(room_id, title);
+            if (!password.empty()) {
+                room->SetPassword(password);
+            }
+            ChatRoom* created = room.get();
+            rooms_.emplace(room_id, std::move(room));
+            ReleaseSRWLockExclusive(&rooms_lock_);
+
+            STATS_SET_GAUGE("room.count", static_cast<double>(GetRoomCount()));
+            return created;
+        }
+
+        bool RoomManager::RemoveRoom(uint32_t room_id) {
+            std::unique_ptr<ChatRoom> room;
+
+            AcquireSRWLockExclusive(&rooms_lock_);
+            auto it = rooms_.find(room_id);
+            if (it != rooms_.end() && it->second->IsEmpty()) {
+                room = std::move(it->second);
+                rooms_.erase(it);
+            }
+            ReleaseSRWLockExclusive(&rooms_lock_);
+
+            if (!room) {
+                return false;
+            }
+
+            ChatHistoryManager::GetInstance()->CloseRoomHistory(room_id);
+            STATS_SET_GAUGE("room.count", static_cast<double>(GetRoomCount()));
+
+            // FindRoom   ڵ鷯 EpochGuard   
+            EpochReclaimer::GetInstance()->Retire(room.release());
+            return true;
+        }
+
+        ChatRoom* RoomManager::FindRoom(uint32_t room_id) {
+            AcquireSRWLockShared(&rooms_lock_);
+            auto it = rooms_.find(room_id);
+            ChatRoom* room = (it != rooms_.end()) ? it->second.get() : nullptr;
+            ReleaseSRWLockShared(&rooms_lock_);
+            return room;
+        }
+
+        std::vector<uint32_t> RoomManager::GetRoomIds() const {
+            std::vector<uint32_t> room_ids;
+
+            AcquireSRWLockShared(&rooms_lock_);
+            room_ids.reserve(rooms_.size());
+            for (const auto& entry : rooms_) {
+                room_ids.push_back(entry.first);
+            }
+            ReleaseSRWLockShared(&rooms_lock_);
+            return room_ids;
+        }
+
+        std::vector<ChatRoom*> RoomManager::GetAllRooms() const {
+            std::vector<ChatRoom*> rooms;
+
+            AcquireSRWLockShared(&rooms_lock_);
+            rooms.reserve(rooms_.size());
+            for (const auto& entry : rooms_) {
+                rooms.push_back(entry.second.get());
+            }
+            ReleaseSRWLockShared(&rooms_lock_);
+            return rooms;
+        }
+
+        size_t RoomManager::GetRoomCount() const {
+            AcquireSRWLockShared(&rooms_lock_);
+            const size_t count = rooms_.size();
+            ReleaseSRWLockShared(&rooms_lock_);
+            return count;
+        }
+
+        size_t RoomManager::GetTotalActiveUsers() const {
+            size_t total = 0;
+
+            AcquireSRWLockShared(&rooms_lock_);
+            for (const auto& entry : rooms_) {
+                total += entry.second->GetParticipantCount();
+            }
+            ReleaseSRWLockShared(&rooms_lock_);
+            return total;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "SendLaneQueue.h"
+#include "Session.h"
+#include "../Common/MemoryAccountant.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        SendLaneQueue::SendLaneQueue() : selector_(Protocol::Config::SEND_LANE_QUANTUM) {
+        }
+
+        SendLaneQueue::~SendLaneQueue() {
+            //  ť  Ҹ Ǯ ʵ ϳ  
+            for (auto& lane : lanes_) {
+                while (lane.head) {
+                    lane.head = std::move(lane.head->next);
+                }
+            }
+            Common::MemoryAccountant::GetInstance()->Release(Common::MemoryCategory::SEND_QUEUE, charged_bytes_);
+        }
+
+        PendingSend& SendLaneQueue::GetPendingSend() {
+            if (!pending_send_) {
+                pending_send_ = std::make_unique<PendingSend>();
+            }
+            return *pending_send_;
+        }
+
+        void SendLaneQueue::SyncCharge() {
+            auto* accountant = Common::MemoryAccountant::GetInstance();
+            if (resident_bytes_ > charged_bytes_) {
+                accountant->Charge(Common::MemoryCategory::SEND_QUEUE, resident_bytes_ - charged_bytes_);
+            }
+            else {
+                accountant->Release(Common::MemoryCategory::SEND_QUEUE, charged_bytes_ - resident_bytes_);
+            }
+            charged_bytes_ = resident_bytes_;
+        }
+
+        uint16_t SendLaneQueue::GetPacketId(const SendData& send_data) {
+            if (send_data.size < sizeof(Protocol::PacketHeader)) {
+                return 0;
+            }
+            Protocol::PacketHeader header;
+            memcpy(&header, send_data.data, sizeof(header));
+            return header.packet_id;
+        }
+
+        Protocol::PacketClass SendLaneQueue::Classify(const SendData& send_data) {
+            const uint16_t packet_id = GetPacketId(send_data);
+            return packet_id != 0 ? Protocol::GetPacketClass(packet_id) : Protocol::PacketClass::CHAT;
+        }
+
+        size_t SendLaneQueue::GetWireBytes(const SendData& send_data) {
+            return send_data.size + (send_data.HasFileRegion() ? send_data.file_region.length : 0);
+        }
+
+        size_t SendLaneQueue::GetMemoryBytes(const SendData& send_data) {
+            return sizeof(SendData) + (send_data.shared_packet ? 0 : send_data.size);
+        }
+
+        void SendLaneQueue::Push(std::unique_ptr<SendData> send_data) {
+            Lane& lane = lanes_[static_cast<size_t>(Classify(*send_data))];
+            lane.bytes += GetWireBytes(*send_data);
+
+            resident_bytes_ += GetMemoryBytes(*send_data);
+            if (resident_bytes_ >= charged_bytes_ + CHARGE_BATCH_BYTES) {
+                SyncCharge();
+            }
+
+            SendData* tail = send_data.get();
+            if (lane.tail) {
+                lane.tail->next = std::move(send_data);
+            }
+            else {
+                lane.head = std::move(send_data);
+            }
+            lane.tail = tail;
+            ++queued_count_;
+        }
+
+        std::unique_ptr<SendData> SendLaneQueue::Pop() {
+            Protocol::PacketClass selected;
+            const bool found = selector_.Select(
+                [this](Protocol::PacketClass lane) { return lanes_[static_cast<size_t>(lane)].head != nullptr; },
+                [this](Protocol::PacketClass lane) { return GetWireBytes(*lanes_[static_cast<size_t>(lane)].head); },
+                selected);
+            if (!found) {
+                return nullptr;
+            }
+
+            Lane& lane = lanes_[static_cast<size_t>(selected)];
+            std::unique_ptr<SendData> send_data = std::move(lane.head);
+            lane.head = std::move(send_data->next);
+            if (!lane.head) {
+                lane.tail = nullptr;
+            }
+            lane.bytes -= GetWireBytes(*send_data);
+
+            resident_bytes_ -= GetMemoryBytes(*send_data);
+            if (resident_bytes_ == 0 || charged_bytes_ >= resident_bytes_ + CHARGE_BATCH_BYTES) {
+                SyncCharge();
+            }
+            --queued_count_;
+            return send_data;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
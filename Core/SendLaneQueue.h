@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "../Common/Protocol.h"
+#include "LaneSelector.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        struct SendData;
+        struct PendingSend;
+
+        //  ۽ ť ( Ŭ)
+        //  Ŷ ׻  ,  Ʈ  DRR  ū  ٿε ߿ ä и ʴ´.
+        //  Ŭ ȿ   Ų. ȭ ȣ (Session::send_lock_) 
+        class SendLaneQueue {
+        public:
+            SendLaneQueue();
+            ~SendLaneQueue();
+
+            SendLaneQueue(const SendLaneQueue&) = delete;
+            SendLaneQueue& operator=(const SendLaneQueue&) = delete;
+
+            void Push(std::unique_ptr<SendData> send_data); // Ŭ Ŷ  
+            std::unique_ptr<SendData> Pop();                //  nullptr
+
+            // Ͽ ɸ ۽ ڸ (ó    ť Բ )
+            PendingSend& GetPendingSend();
+
+            bool IsEmpty() const { return queued_count_ == 0; }
+            size_t GetQueuedCount() const { return queued_count_; }
+            size_t GetQueuedBytes(Protocol::PacketClass lane) const { return lanes_[static_cast<size_t>(lane)].bytes; }
+            size_t GetResidentBytes() const { return resident_bytes_; } // ť  ޸ (Ȯ )
+
+            //  SEND_QUEUE  Ŷ    ʰ ̰ ̸ŭ ̰ų ť   
+            // (Ǹ ִ ̸ŭ ʰ )
+            static constexpr size_t CHARGE_BATCH_BYTES = 4 * 1024;
+
+            static uint16_t GetPacketId(const SendData& send_data); //   0
+            static Protocol::PacketClass Classify(const SendData& send_data);
+            static size_t GetWireBytes(const SendData& send_data); //  +  
+            static size_t GetMemoryBytes(const SendData& send_data); //  +   ( Ŷ  )
+
+        private:
+            struct Lane {
+                std::unique_ptr<SendData> head; // SendData::next 
+                SendData* tail = nullptr;
+                size_t bytes = 0;
+            };
+
+            Lane lanes_[Protocol::PACKET_CLASS_COUNT];
+            LaneSelector selector_;
+            size_t queued_count_ = 0;
+            size_t resident_bytes_ = 0;
+            size_t charged_bytes_ = 0; // MemoryAccountant ˸ 
+            std::unique_ptr<PendingSend> pending_send_;
+
+            void SyncCharge();
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,507 @@
+#include "pch.h"
+#include "Session.h"
+#include "Statistics.h"
+#include "TaskScheduler.h"
+#include "PacketHandler.h"
+#include "Managers.h"
+#include "ChatRoom.h"
+#include "EpochReclaimer.h"
+#include "Coroutine.h"
+#include "SessionResume.h"
+#include "FileDownload.h"
+#include "../Common/Config.h"
+#include "../Common/MemoryAccountant.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            int64_t NowMs() {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+        }
+
+        std::atomic<uint32_t> Session::hibernate_idle_ms_{ Protocol::Config::SESSION_HIBERNATE_IDLE_SEC * 1000 };
+        std::atomic<SessionTransport*> Session::transport_{ nullptr };
+
+        Session::Session(SOCKET socket, uint64_t session_id)
+            : socket_(socket)
+            , session_id_(session_id)
+            , last_active_ms_(NowMs())
+            , is_sending_(false)
+            , is_logged_in_(false)
+            , is_hibernating_(false)
+            , is_waking_(false)
+            , recv_context_(IoOperationType::RECV)
+            , current_room_(nullptr) {
+            InitializeSRWLock(&data_lock_);
+            InitializeSRWLock(&send_lock_);
+        }
+
+        Session::~Session() {
+            SessionBufferPool::GetInstance()->ReleaseRecvBuffer(std::move(recv_buffer_));
+        }
+
+        void Session::LoadFromConfig() {
+            const int idle_sec = Common::Config::GetInstance()->GetInt("session.hibernate_idle_sec",
+                static_cast<int>(hibernate_idle_ms_.load() / 1000));
+            const uint32_t max_sec = UINT32_MAX / 1000;
+            SetHibernateIdleMs(idle_sec > 0 ? std::min(static_cast<uint32_t>(idle_sec), max_sec) * 1000 : 0);
+        }
+
+        bool Session::ShouldHibernate(int64_t now_ms) const {
+            const uint32_t idle_ms = hibernate_idle_ms_.load(std::memory_order_relaxed);
+            return idle_ms != 0 && !is_waking_ &&
+                now_ms - last_active_ms_ >= static_cast<int64_t>(idle_ms) &&
+                !assembler_.HasPendingFrame(); // ߸     ۸  Ƿ ޸ 
+        }
+
+        bool Session::PostZeroByteRecv() {
+            SessionBufferPool::GetInstance()->ReleaseRecvBuffer(std::move(recv_buffer_));
+
+            AcquireSRWLockExclusive(&send_lock_);
+            if (send_queue_ && send_queue_->IsEmpty() && !is_sending_) {
+                send_queue_.reset();
+            }
+            ReleaseSRWLockExclusive(&send_lock_);
+
+            ZeroMemory(&recv_context_.overlapped, sizeof(recv_context_.overlapped));
+            recv_context_.wsa_buffer.buf = nullptr;
+            recv_context_.wsa_buffer.len = 0;
+            is_hibernating_ = true;
+
+            if (SessionTransport* transport = transport_.load(std::memory_order_acquire)) {
+                if (!transport->PostRecv(this, nullptr, 0)) {
+                    is_hibernating_ = false;
+                    return false;
+                }
+                STATS_INCREMENT("session.hibernations");
+                return true;
+            }
+
+            DWORD flags = 0;
+            if (WSARecv(socket_, &recv_context_.wsa_buffer, 1, nullptr, &flags,
+                &recv_context_.overlapped, nullptr) == SOCKET_ERROR &&
+                WSAGetLastError() != WSA_IO_PENDING) {
+                is_hibernating_ = false;
+                return false;
+            }
+            STATS_INCREMENT("session.hibernations");
+            return true;
+        }
+
+        bool Session::PostRecv() {
+            const int64_t now_ms = NowMs();
+            if (rate_state_.throttled_until_ms > now_ms) {
+                // ѵ Ѱ б⸦  .  ۰  TCP 帧   ۽ŵ 
+                STATS_INCREMENT("ratelimit.recv_paused");
+                const uint64_t session_id = session_id_;
+                CoroutineTimer::GetInstance()->Schedule(
+                    CoroutineTimer::Clock::now() + std::chrono::milliseconds(rate_state_.throttled_until_ms - now_ms),
+                    [session_id]() {
+                        EpochGuard guard;
+                        Session* session = SessionManager::GetInstance()->FindSession(session_id);
+                        if (session && !session->PostRecv()) {
+                            session->Disconnect();
+                        }
+                    });
+                return true;
+            }
+
+            if (ShouldHibernate(now_ms)) {
+                return PostZeroByteRecv();
+            }
+            is_waking_ = false;
+
+            if (!recv_buffer_) {
+                recv_buffer_ = SessionBufferPool::GetInstance()->AcquireRecvBuffer();
+            }
+
+            ZeroMemory(&recv_context_.overlapped, sizeof(recv_context_.overlapped));
+            recv_context_.wsa_buffer.buf = recv_buffer_->data;
+            recv_context_.wsa_buffer.len = sizeof(recv_buffer_->data);
+
+            if (SessionTransport* transport = transport_.load(std::memory_order_acquire)) {
+                return transport->PostRecv(this, recv_buffer_->data, sizeof(recv_buffer_->data));
+            }
+
+            DWORD flags = 0;
+            if (WSARecv(socket_, &recv_context_.wsa_buffer, 1, nullptr, &flags,
+                &recv_context_.overlapped, nullptr) == SOCKET_ERROR) {
+                return WSAGetLastError() == WSA_IO_PENDING;
+            }
+            return true;
+        }
+
+        bool Session::OnRecvCompleted(DWORD bytes_transferred) {
+            if (is_hibernating_) {
+                // 0Ʈ  Ϸ:  Ͱ ԰ų  .      ˷ 
+                is_hibernating_ = false;
+                is_waking_ = true;
+                STATS_INCREMENT("session.wakeups");
+                return true;
+            }
+            if (bytes_transferred == 0 || !recv_buffer_) {
+                return false;
+            }
+
+            // ƮƮ   Ȱ ð  ʾ  PostRecv ٽ ޸
+            const int64_t now_ms = NowMs();
+            return assembler_.Feed(recv_buffer_->data, bytes_transferred,
+                [this, now_ms](Protocol::PacketHeader* header, char* payload) {
+                    if (header->packet_id != Protocol::PacketID::HEARTBEAT_REQ) {
+                        last_active_ms_ = now_ms;
+                    }
+                    return ProcessPacket(header, payload);
+                });
+        }
+
+        bool Session::ProcessPacket(Protocol::PacketHeader* header, char* payload) {
+            return PacketDispatcher::GetInstance()->DispatchAsync(this, header, payload);
+        }
+
+        const std::shared_ptr<TaskStrand>& Session::GetStrand(Protocol::PacketClass lane) {
+            if (!strands_) {
+                strands_ = std::make_unique<std::array<std::shared_ptr<TaskStrand>, Protocol::PACKET_CLASS_COUNT>>();
+            }
+            auto& strand = (*strands_)[static_cast<size_t>(lane)];
+            if (!strand) {
+                strand = TaskStrand::Create(lane);
+            }
+            return strand;
+        }
+
+        bool Session::IsLoggedIn() const {
+            return is_logged_in_.load(std::memory_order_acquire);
+        }
+
+        void Session::SetLoggedIn(const std::string& user_id) {
+            user_id_ = user_id; // α ڵ鷯(  Ʈ) ٲ
+            is_logged_in_.store(true, std::memory_order_release);
+        }
+
+        void Session::SetLoggedOut() {
+            is_logged_in_.store(false, std::memory_order_release);
+        }
+
+        void Session::EnterRoom(ChatRoom* room) {
+            current_room_.store(room, std::memory_order_release);
+        }
+
+        ChatRoom* Session::LeaveRoom() {
+            //  ڵ鷯  Ű ĵ ʸ  
+            ChatRoom* room = current_room_.exchange(nullptr, std::memory_order_acq_rel);
+            if (room) {
+                room->Leave(this);
+            }
+            return room;
+        }
+
+        ChatRoom* Session::GetCurrentRoom() const {
+            return current_room_.load(std::memory_order_acquire);
+        }
+
+        bool Session::GetReceiveLane(uint16_t packet_id, Protocol::PacketClass& out_lane) const {
+            if (is_logged_in_.load(std::memory_order_acquire)) {
+                out_lane = Protocol::GetPacketClass(packet_id);
+                return true;
+            }
+
+            switch (packet_id) {
+            case Protocol::PacketID::LOGIN_REQ:
+            case Protocol::PacketID::RESUME_REQ:
+            case Protocol::PacketID::HEARTBEAT_REQ:
+                out_lane = Protocol::PacketClass::CONTROL;
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        bool Session::PostSend(const char* data, size_t size) {
+            return EnqueueSend(std::make_unique<SendData>(data, size));
+        }
+
+        bool Session::PostSend(SharedPacket packet) {
+            return EnqueueSend(std::make_unique<SendData>(std::move(packet)));
+        }
+
+        bool Session::PostSendFile(const char* head, size_t head_size, FileRegion region, uint64_t download_id) {
+            return EnqueueSend(std::make_unique<SendData>(head, head_size, std::move(region), download_id));
+        }
+
+        bool Session::EnqueueSend(std::unique_ptr<SendData> send_data) {
+            bool should_start = false;
+
+            // ޸𸮰 ڶ  Ǵ ˸  (Ʈ ѵ ۽ и Ǹ)
+            const uint16_t packet_id = SendLaneQueue::GetPacketId(*send_data);
+            const bool is_sheddable = Protocol::IsSheddableNotify(packet_id);
+
+            AcquireSRWLockExclusive(&send_lock_);
+            if (is_sheddable && Common::MemoryAccountant::GetInstance()->ShouldShedNotification(
+                send_queue_ ? send_queue_->GetResidentBytes() : 0)) {
+                ReleaseSRWLockExclusive(&send_lock_);
+                STATS_INCREMENT("memory.notifications_shed");
+                return true;
+            }
+            if (resume_) {
+                if (resume_->forward_session_id != 0) {
+                    //   Ѿ :    ڴʰ  ۽   (ȣڴ EpochGuard )
+                    const uint64_t forward_session_id = resume_->forward_session_id;
+                    ReleaseSRWLockExclusive(&send_lock_);
+                    Session* target = SessionManager::GetInstance()->FindSession(forward_session_id);
+                    return target ? target->EnqueueSend(std::move(send_data)) : true;
+                }
+                if (Protocol::GetPacketClass(packet_id) == Protocol::PacketClass::CHAT) {
+                    if (!send_data->shared_packet) {
+                        //  ۽ ť  ϳ    Ŷ ٲ
+                        send_data = std::make_unique<SendData>(std::make_shared<const std::vector<char>>(
+                            send_data->data, send_data->data + send_data->size));
+                    }
+                    resume_->replay_ring.Push(send_data->shared_packet);
+                }
+                if (resume_->detached_ms != 0) {
+                    ReleaseSRWLockExclusive(&send_lock_);
+                    return true; //       
+                }
+            }
+            if (!send_queue_) {
+                send_queue_ = std::make_unique<SendLaneQueue>();
+            }
+            send_queue_->Push(std::move(send_data)); //   ProcessSendQueue   
+            if (!is_sending_) {
+                is_sending_ = true;
+                should_start = true;
+            }
+            ReleaseSRWLockExclusive(&send_lock_);
+
+            // ۽ ɷ     尡  ( Ϸ  ̾ )
+            if (should_start) {
+                ProcessSendQueue();
+            }
+            return true;
+        }
+
+        void Session::ProcessSendQueue() {
+            SessionTransport* transport = transport_.load(std::memory_order_acquire);
+            if (!transport) {
+                PostNextSend(); //  Ϸ (OnSendCompleted) ̾ 
+                return;
+            }
+
+            for (;;) {
+                AcquireSRWLockExclusive(&send_lock_);
+                std::unique_ptr<SendData> send_data = send_queue_ ? send_queue_->Pop() : nullptr;
+                if (!send_data) {
+                    is_sending_ = false; //  EnqueueSend ٽ 
+                    ReleaseSRWLockExclusive(&send_lock_);
+                    return;
+                }
+                ReleaseSRWLockExclusive(&send_lock_);
+
+                //  ۿ     Ŷ ٷ  û ־  ʰ 
+                const bool sent = transport->Send(this, *send_data);
+                FinishSend(std::move(send_data), sent);
+            }
+        }
+
+        void Session::PostNextSend() {
+            for (;;) {
+                AcquireSRWLockExclusive(&send_lock_);
+                std::unique_ptr<SendData> send_data = send_queue_ ? send_queue_->Pop() : nullptr;
+                if (!send_data) {
+                    is_sending_ = false;
+                    ReleaseSRWLockExclusive(&send_lock_);
+                    return;
+                }
+                // is_sending_  ť ݳ Ƿ  ۿ ڸ 
+                PendingSend& pending = send_queue_->GetPendingSend();
+                pending.data = std::move(send_data);
+                pending.offset = 0;
+                ReleaseSRWLockExclusive(&send_lock_);
+
+                if (PostPendingSend(pending)) {
+                    return;
+                }
+                FinishSend(std::move(pending.data), false);
+            }
+        }
+
+        bool Session::PostPendingSend(PendingSend& pending) {
+            const SendData& send_data = *pending.data;
+            ZeroMemory(&pending.context.overlapped, sizeof(pending.context.overlapped));
+
+            if (send_data.HasFileRegion()) {
+                pending.context.operation_type = IoOperationType::TRANSMIT_FILE;
+                return TransmitFileRegion(socket_, send_data.file_region, send_data.data,
+                    static_cast<uint32_t>(send_data.size), &pending.context.overlapped);
+            }
+
+            pending.context.operation_type = IoOperationType::SEND;
+            pending.context.wsa_buffer.buf = send_data.data + pending.offset;
+            pending.context.wsa_buffer.len = static_cast<ULONG>(send_data.size - pending.offset);
+            if (WSASend(socket_, &pending.context.wsa_buffer, 1, nullptr, 0,
+                &pending.context.overlapped, nullptr) == SOCKET_ERROR) {
+                return WSAGetLastError() == WSA_IO_PENDING;
+            }
+            return true;
+        }
+
+        bool Session::OnSendCompleted(DWORD bytes_transferred) {
+            AcquireSRWLockShared(&send_lock_);
+            PendingSend& pending = send_queue_->GetPendingSend();
+            ReleaseSRWLockShared(&send_lock_);
+
+            bool sent = bytes_transferred != 0;
+            if (sent && !pending.data->HasFileRegion()) {
+                pending.offset += bytes_transferred;
+                if (pending.offset < pending.data->size) {
+                    //   â  Ϻθ :  ٽ ɰ ϷḦ ٸ
+                    if (PostPendingSend(pending)) {
+                        return true;
+                    }
+                    sent = false;
+                }
+            }
+
+            FinishSend(std::move(pending.data), sent);
+            PostNextSend();
+            return sent;
+        }
+
+        void Session::FinishSend(std::unique_ptr<SendData> send_data, bool sent) {
+            if (!sent) {
+                STATS_INCREMENT(transport_.load(std::memory_order_acquire) ?
+                    "session.transport_send_failures" : "session.socket_send_failures");
+            }
+
+            //    ڿ   ø (⼭   ۽ ̶ ť   ̾ )
+            if (send_data->download_id != 0) {
+                if (sent) {
+                    FileDownloadManager::GetInstance()->OnFrameSent(this, send_data->download_id, send_data->file_region.length);
+                }
+                else {
+                    FileDownloadManager::GetInstance()->CancelDownload(send_data->download_id);
+                }
+            }
+        }
+
+        //   ʰ   ɷ ִ  0Ʈ Ϸǰ  ( ſ    ϷḦ   )
+        //      Ƿ ƹ͵  
+        void Session::Disconnect() {
+            if (socket_ != INVALID_SOCKET) {
+                shutdown(socket_, SD_BOTH);
+            }
+        }
+
+        void Session::EnableResume(const std::string& token) {
+            auto state = std::make_unique<ResumeState>();
+            state->token = token;
+
+            AcquireSRWLockExclusive(&send_lock_);
+            resume_ = std::move(state);
+            ReleaseSRWLockExclusive(&send_lock_);
+        }
+
+        std::string Session::GetResumeToken() const {
+            AcquireSRWLockShared(&send_lock_);
+            std::string token = resume_ ? resume_->token : std::string();
+            ReleaseSRWLockShared(&send_lock_);
+            return token;
+        }
+
+        bool Session::Detach() {
+            if (!is_logged_in_.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            AcquireSRWLockExclusive(&send_lock_);
+            const bool detached = resume_ && resume_->forward_session_id == 0;
+            if (detached) {
+                resume_->detached_ms = NowMs();
+            }
+            ReleaseSRWLockExclusive(&send_lock_);
+            return detached;
+        }
+
+        bool Session::CancelResume(std::string& out_token) {
+            std::unique_ptr<ResumeState> state;
+
+            AcquireSRWLockExclusive(&send_lock_);
+            if (resume_ && resume_->detached_ms != 0 && resume_->forward_session_id == 0) {
+                state = std::move(resume_);
+            }
+            ReleaseSRWLockExclusive(&send_lock_);
+
+            if (!state) {
+                return false;
+            }
+            out_token = std::move(state->token);
+            return true;
+        }
+
+        bool Session::HandOver(Session* connection, uint64_t last_sequence,
+            const std::function<void(size_t)>& on_accepted, int32_t& out_error) {
+            std::vector<SharedPacket> missed;
+
+            //  а ѱ     ۽  ۰  Ŷ  ڼ ʰ 
+            AcquireSRWLockExclusive(&send_lock_);
+            if (!resume_ || resume_->detached_ms == 0 || resume_->forward_session_id != 0) {
+                ReleaseSRWLockExclusive(&send_lock_);
+                out_error = Protocol::ErrorCode::RESUME_NOT_FOUND;
+                return false;
+            }
+            if (!resume_->replay_ring.CollectAfter(last_sequence, missed)) {
+                ReleaseSRWLockExclusive(&send_lock_);
+                out_error = Protocol::ErrorCode::RESUME_REPLAY_GAP;
+                return false;
+            }
+
+            // α ¿  亸  Ű   Ŭ̾Ʈ  û ٷ óǰ 
+            AcquireSRWLockExclusive(&connection->data_lock_);
+            connection->user_id_ = user_id_;
+            connection->current_room_.store(current_room_.exchange(nullptr)); //       ʰ 
+            ReleaseSRWLockExclusive(&connection->data_lock_);
+            connection->is_logged_in_.store(true, std::memory_order_release);
+
+            //  ῡ   Ƿ   Ŷ    
+            on_accepted(missed.size());
+            for (SharedPacket& packet : missed) {
+                connection->PostSend(std::move(packet));
+            }
+
+            auto state = std::make_unique<ResumeState>();
+            state->token = resume_->token;
+            state->replay_ring = std::move(resume_->replay_ring);
+
+            AcquireSRWLockExclusive(&connection->send_lock_);
+            connection->resume_ = std::move(state);
+            ReleaseSRWLockExclusive(&connection->send_lock_);
+
+            resume_->forward_session_id = connection->session_id_;
+            ReleaseSRWLockExclusive(&send_lock_);
+
+            STATS_RECORD("session.resume_replayed", static_cast<double>(missed.size()));
+            return true;
+        }
+
+        size_t Session::GetResidentBytes() const {
+            size_t bytes = sizeof(Session) + assembler_.GetResidentBytes();
+            if (recv_buffer_) {
+                bytes += sizeof(RecvBuffer);
+            }
+            if (send_queue_) {
+                bytes += sizeof(SendLaneQueue) + send_queue_->GetResidentBytes();
+            }
+            if (resume_) {
+                bytes += sizeof(ResumeState); //  Ŷ REPLAY_BUFFER  
+            }
+            return bytes;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
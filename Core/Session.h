@@ -2,53 +2,112 @@
 
 #include <winsock2.h>
 #include <memory>
+#include <array>
 #include <string>
-#include <queue>
+#include <vector>
 #include <mutex>
+#include <atomic>
+#include <functional>
 #include "../Common/Protocol.h"
+#include "SharedFile.h"
+#include "SessionBufferPool.h"
+#include "PacketAssembler.h"
+#include "SendLaneQueue.h"
+#include "RateLimiter.h"
 
 namespace NexusCore {
     namespace Core {
 
         class ChatRoom; //  
+        class TaskStrand;
+        struct ResumeState;
 
         // I/O ۾ Ÿ
         enum class IoOperationType {
             RECV,
             SEND,
-            ACCEPT
+            ACCEPT,
+            TRANSMIT_FILE
         };
 
-        // I/O ۾ ؽƮ
+        // I/O ۾ ؽƮ (۴  , wsa_buffer I/O    ۸ Ŵ)
         struct PerIoContext {
             OVERLAPPED overlapped;
             WSABUF wsa_buffer;
-            char buffer[Protocol::Config::RECV_BUFFER_SIZE];
             IoOperationType operation_type;
 
             PerIoContext(IoOperationType type) : operation_type(type) {
                 ZeroMemory(&overlapped, sizeof(overlapped));
-                ZeroMemory(buffer, sizeof(buffer));
-                wsa_buffer.len = sizeof(buffer);
-                wsa_buffer.buf = buffer;
+                wsa_buffer.len = 0;
+                wsa_buffer.buf = nullptr;
             }
         };
 
+        //  ǿ ״  Һ Ŷ (       )
+        using SharedPacket = std::shared_ptr<const std::vector<char>>;
+
         // ۽  ü
         struct SendData {
             char* data;
             size_t size;
+            SharedPacket shared_packet; //  data  Ŷ Ŵ ( )
+
+            //    data ̹ ̰,  TransmitFile/sendfile 
+            FileRegion file_region;
+            uint64_t download_id = 0; // ۽ Ϸ  FileDownloadManager  ID
 
             SendData(const char* src, size_t len) : size(len) {
                 data = new char[len];
                 memcpy(data, src, len);
             }
 
+            explicit SendData(SharedPacket packet)
+                : data(const_cast<char*>(packet->data()))
+                , size(packet->size())
+                , shared_packet(std::move(packet)) {
+            }
+
+            SendData(const char* head, size_t head_len, FileRegion region, uint64_t download)
+                : SendData(head, head_len) {
+                file_region = std::move(region);
+                download_id = download;
+            }
+
+            bool HasFileRegion() const { return file_region.file != nullptr; }
+
+            std::unique_ptr<SendData> next; //  ۽ ť 
+
             ~SendData() {
-                delete[] data;
+                if (!shared_packet) {
+                    delete[] data;
+                }
             }
         };
 
+        // Ͽ ɾ  ۽ ϳ. Ϸ   ۽ ť   ( ü ũ⸦ ø ʵ ť ʿ )
+        // Ϸ  IOCP Ŀ context.operation_type(SEND/TRANSMIT_FILE)  Session::OnSendCompleted ѱ
+        struct PendingSend {
+            PerIoContext context{ IoOperationType::SEND };
+            std::unique_ptr<SendData> data;
+            size_t offset = 0; // ̹  Ʈ (WSASend Ϻθ   ٽ )
+        };
+
+        class Session;
+
+        //    I/O ޴   (ġ  WSARecv/WSASend)
+        //   //ó ϴ ùķͿ ġũ Session::SetTransport ġѴ.
+        class SessionTransport {
+        public:
+            virtual ~SessionTransport() = default;
+
+            //  ɱ (buffer nullptr̸ 0Ʈ ). Ͱ    IO  ҷ
+            // buffer ä OnRecvCompleted -> PostRecv ȣѴ
+            virtual bool PostRecv(Session* session, char* buffer, size_t capacity) = 0;
+
+            // ۽ ť    Ŷ ϳ. ȣ 忡 ٷ   (false )
+            virtual bool Send(Session* session, const SendData& send_data) = 0;
+        };
+
         // Ŭ̾Ʈ  Ŭ
         class Session {
         public:
@@ -56,9 +115,15 @@ namespace NexusCore {
             ~Session();
 
             // Ʈũ I/O 
+            // ƮƮ  Ȱ hibernate ð     0Ʈ Ÿ ɾ д (޸).
+            // Ͱ ϸ OnRecvCompleted ,  PostRecv ۸    Ǵ.
             bool PostRecv();
             bool PostSend(const char* data, size_t size);
-            void ProcessPacket(Protocol::PacketHeader* header, char* payload);
+            bool PostSend(SharedPacket packet); //   ť ø
+            bool PostSendFile(const char* head, size_t head_size, FileRegion region, uint64_t download_id);
+            bool ProcessPacket(Protocol::PacketHeader* header, char* payload); // IO : ѵ ˻   Ʈ忡 ְ ȯ (false  )
+            bool OnRecvCompleted(DWORD bytes_transferred); // 0Ʈ( ), ߸ , ѵ ʰ  false,  PostRecv ȣ
+            bool OnSendCompleted(DWORD bytes_transferred); // ۽ Ϸ (0Ʈ з  false).  ۽ ̾ 
             void Disconnect();
 
             //  
@@ -67,43 +132,98 @@ namespace NexusCore {
             void SetLoggedOut();
 
             // äù 
+            //  ڵ鷯 ChatRoom::Enter   . LeaveRoom 濡    ȯ ( nullptr)
             void EnterRoom(ChatRoom* room);
-            void LeaveRoom();
+            ChatRoom* LeaveRoom();
             ChatRoom* GetCurrentRoom() const;
 
+            //   ڵ鷯 ۾   ϴ Ʈ.  Ŭ ϳ̶
+            //  Ŭ ȿ  ȴ (ù Ŷ ,  Ϸ ο ȣ)
+            const std::shared_ptr<TaskStrand>& GetStrand(Protocol::PacketClass lane);
+
+            //  Ŷ ó . α  α//ƮƮ   ް
+            //  false (): α   ä/ Ŷ    ϰ 
+            bool GetReceiveLane(uint16_t packet_id, Protocol::PacketClass& out_lane) const;
+
+            //   (α   EnableResume,   Detach,   ū  HandOver)
+            //    ä 뿪 Ŷ  ٿ ֱ    .
+            void EnableResume(const std::string& token);
+            std::string GetResumeToken() const; //   ʾ  ڿ
+            bool Detach();                      //   α Ǹ true.  ۽   
+            bool CancelResume(std::string& out_token); //  ѱ   ̸  ¸  true
+
+            //    α //    ѱ. last_sequence  Ŷ   
+            // on_accepted(ٽ  Ŷ )     ģ Ŷ ̾ ,    
+            // ۽   ѱ.    ȣ  ٲ
+            bool HandOver(Session* connection, uint64_t last_sequence,
+                const std::function<void(size_t)>& on_accepted, int32_t& out_error);
+
             // Getter/Setter
             SOCKET GetSocket() const { return socket_; }
             uint64_t GetSessionId() const { return session_id_; }
             const std::string& GetUserId() const { return user_id_; }
 
+            //  ѵ  ( Ϸ ο )
+            SessionRateState& GetRateState() { return rate_state_; }
+
+            //     ޸ ( ü +    )
+            size_t GetResidentBytes() const;
+            bool IsHibernating() const { return is_hibernating_; }
+
+            // ޸  ð (и, 0̸ ޸ )
+            static void SetHibernateIdleMs(uint32_t idle_ms) { hibernate_idle_ms_ = idle_ms; }
+            // "session.hibernate_idle_sec" () о ޸  ð  (  )
+            static void LoadFromConfig();
+
+            //     ü (   ġ, nullptr̸ )
+            static void SetTransport(SessionTransport* transport) { transport_ = transport; }
+
             //   ȣ  
             mutable SRWLOCK data_lock_;
 
         private:
-            // Ʈũ 
-            SOCKET socket_;
-            uint64_t session_id_;
-            PerIoContext recv_context_;
+            //  ѵ Ŷ    ڸ  (Ŷ  IO  ϳ )
+            SessionRateState rate_state_;
+
 
-            // ۽ ť 
-            std::queue<std::unique_ptr<SendData>> send_queue_;
-            std::mutex send_queue_mutex_;
+            // =====  ʵ: ۼ ϷḶ  ( ĳ ) =====
+            alignas(64) SOCKET socket_;
+            uint64_t session_id_;
+            mutable SRWLOCK send_lock_;
+            std::unique_ptr<SendLaneQueue> send_queue_; // Ŭ ۽ ť (ù ۽  , ޸    ݳ)
+            std::unique_ptr<RecvBuffer> recv_buffer_; //    Ǯ  (޸ ߿ )
+            int64_t last_active_ms_;                  //  ƮƮ ƴ Ŷ  ð
             bool is_sending_;
+            std::atomic<bool> is_logged_in_;          //   ÿ IO 尡 
+            std::atomic<bool> is_hibernating_;        // 0Ʈ  ɷ  (/ 尡 IsHibernating )
+            bool is_waking_;                          // ޸鿡   (  ݵ ۷)
+
+            // ===== Ŀ  OVERLAPPED  ĳ  =====
+            alignas(64) PerIoContext recv_context_;
 
-            //  
+            // ===== ݵ ʵ =====
+            PacketAssembler assembler_; // ߸     ۸ 
             std::string user_id_;
-            bool is_logged_in_;
-            ChatRoom* current_room_;
+            std::atomic<ChatRoom*> current_room_;     // ڵ鷯 Ʈ  Ű Բ 
+            std::unique_ptr<std::array<std::shared_ptr<TaskStrand>, Protocol::PACKET_CLASS_COUNT>> strands_;
+            std::unique_ptr<ResumeState> resume_; //   α Ǹ (send_lock_ ȿ )
 
-            //   
-            char packet_buffer_[Protocol::Config::MAX_PACKET_SIZE];
-            size_t packet_buffer_pos_;
+            static std::atomic<uint32_t> hibernate_idle_ms_;
+            static std::atomic<SessionTransport*> transport_;
 
             //   Լ
-            void ProcessSendQueue();
-            bool ParsePackets(char* data, size_t size);
+            bool ShouldHibernate(int64_t now_ms) const;
+            bool PostZeroByteRecv();
+            bool EnqueueSend(std::unique_ptr<SendData> send_data);
+            void ProcessSendQueue(); //   .  ̸ ť  , ̸ ϳ ɰ ٷ ȯ
+            void PostNextSend();     // ť   Ͽ  ( ۽ ).   Ŷ з óϰ 
+            bool PostPendingSend(PendingSend& pending);
+            void FinishSend(std::unique_ptr<SendData> send_data, bool sent); //    ٿε 
             uint32_t CalculateCRC32(const char* data, size_t size);
         };
 
+        //   ʸ   ۸   ü ũ 
+        static_assert(sizeof(Session) <= 256, "Session must stay small; borrow buffers from SessionBufferPool");
+
     } // namespace Core
 } // namespace NexusCore
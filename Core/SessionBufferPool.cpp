@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "SessionBufferPool.h"
+#include "ThreadPlacement.h"
+
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        SessionBufferPool* SessionBufferPool::instance_ = nullptr;
+        std::once_flag SessionBufferPool::init_flag_;
+
+        SessionBufferPool* SessionBufferPool::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new SessionBufferPool();
+            });
+            return instance_;
+        }
+
+        SessionBufferPool::SessionBufferPool()
+            : reassembly_buffers_(0, 256) {
+            // 尡 ̸ ̸  :  Ŀ ó      ޸𸮿 
+            const size_t node_count = (std::max)(ThreadPlacement::GetInstance()->GetNodeCount(), static_cast<size_t>(1));
+            const size_t initial_size = node_count == 1 ? 256 : 0;
+            for (size_t i = 0; i < node_count; ++i) {
+                recv_buffers_.push_back(std::make_unique<MemoryPool<RecvBuffer>>(
+                    initial_size, 4096 / node_count, Common::MemoryCategory::RECV_BUFFER));
+            }
+        }
+
+        SessionBufferPool::~SessionBufferPool() = default;
+
+        std::unique_ptr<RecvBuffer> SessionBufferPool::AcquireRecvBuffer() {
+            ++borrowed_recv_;
+            const size_t node = GetCurrentRecvPoolIndex();
+            std::unique_ptr<RecvBuffer> buffer = recv_buffers_[node]->Acquire();
+            buffer->home_node = static_cast<uint32_t>(node);
+            return buffer;
+        }
+
+        void SessionBufferPool::ReleaseRecvBuffer(std::unique_ptr<RecvBuffer> buffer) {
+            if (!buffer) return;
+            --borrowed_recv_;
+            // ޸/ ٸ  IO 忡 Ͼ  Ƿ ȣ 尡 ƴ϶    
+            const uint32_t node = buffer->home_node;
+            recv_buffers_[node]->Release(std::move(buffer));
+        }
+
+        size_t SessionBufferPool::GetCurrentRecvPoolIndex() const {
+            return ThreadPlacement::GetCurrentNode() % recv_buffers_.size();
+        }
+
+        std::unique_ptr<std::vector<char>> SessionBufferPool::AcquireReassemblyBuffer() {
+            ++borrowed_reassembly_;
+            auto buffer = reassembly_buffers_.Acquire();
+            Common::MemoryAccountant::GetInstance()->Charge(Common::MemoryCategory::REASSEMBLY, buffer->capacity());
+            return buffer;
+        }
+
+        void SessionBufferPool::ReleaseReassemblyBuffer(std::unique_ptr<std::vector<char>> buffer) {
+            if (!buffer) return;
+            --borrowed_reassembly_;
+            Common::MemoryAccountant::GetInstance()->Release(Common::MemoryCategory::REASSEMBLY, buffer->capacity());
+
+            buffer->clear();
+            if (buffer->capacity() > KEEP_REASSEMBLY_CAPACITY) {
+                buffer->shrink_to_fit(); // ִ Ŷ ũ⸸ŭ Ŀ ۰ Ǯ  ʵ
+            }
+            reassembly_buffers_.Release(std::move(buffer));
+        }
+
+    } // namespace Core
+} // namespace NexusCore
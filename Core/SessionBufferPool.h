@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "MemoryPool.h"
+#include "../Common/Protocol.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        //   (ɾ  WSARecv ä)
+        struct RecvBuffer {
+            char data[Protocol::Config::RECV_BUFFER_SIZE];
+            uint32_t home_node = 0; //   Ǯ NUMA  (ݳ   Ǯ)
+        };
+
+        //  ʿ     Ǯ
+        // Ǹ ۸ ھ θ   10   GB Ƿ,
+        //  ۴   ,  ۴  ߷  Ʈ   .
+        //  ۴ NUMA 帶 Ǯ  ΰ ȣ   Ǯ , ݳ ٸ 
+        // 尡 ϴ    Ǯ  (Ǯ ٸ  ޸𸮷  ʰ).
+        class SessionBufferPool {
+        public:
+            static SessionBufferPool* GetInstance();
+
+            std::unique_ptr<RecvBuffer> AcquireRecvBuffer();
+            void ReleaseRecvBuffer(std::unique_ptr<RecvBuffer> buffer);
+
+            //     뷮 REASSEMBLY .   뷮 ø  ̸  Charge
+            std::unique_ptr<std::vector<char>> AcquireReassemblyBuffer();
+            void ReleaseReassemblyBuffer(std::unique_ptr<std::vector<char>> buffer); // 뷮 , ʹ ũ 
+
+            //  ǵ    
+            size_t GetBorrowedRecvCount() const { return borrowed_recv_; }
+            size_t GetBorrowedReassemblyCount() const { return borrowed_reassembly_; }
+
+        private:
+            SessionBufferPool();
+            ~SessionBufferPool();
+
+            static constexpr size_t KEEP_REASSEMBLY_CAPACITY = 16 * 1024; // ̺ ū  ۴ ݳ  
+
+            size_t GetCurrentRecvPoolIndex() const;
+
+            std::vector<std::unique_ptr<MemoryPool<RecvBuffer>>> recv_buffers_; // NUMA 庰
+            PacketBufferPool reassembly_buffers_;
+            std::atomic<size_t> borrowed_recv_{ 0 };
+            std::atomic<size_t> borrowed_reassembly_{ 0 };
+
+            static SessionBufferPool* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "Managers.h"
+#include "EpochReclaimer.h"
+#include "Statistics.h"
+#include "WorkerExecutor.h"
+#include "Coroutine.h"
+#include "FileDownload.h"
+#include "../Common/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NexusCore {
+    namespace Core {
+
+        SessionManager* SessionManager::instance_ = nullptr;
+        std::once_flag SessionManager::init_flag_;
+
+        SessionManager* SessionManager::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new SessionManager();
+            });
+            return instance_;
+        }
+
+        SessionManager::SessionManager()
+            : sessions_(Protocol::Config::SESSION_TABLE_CAPACITY)
+            , user_sessions_(Protocol::Config::SESSION_USER_MAP_STRIPES)
+            , resume_tokens_(Protocol::Config::SESSION_USER_MAP_STRIPES) {
+        }
+
+        SessionManager::~SessionManager() = default;
+
+        Session* SessionManager::CreateSession(SOCKET socket) {
+            const uint64_t session_id = sessions_.Allocate();
+            if (session_id == SlotTable<Session>::INVALID_ID) {
+                STATS_INCREMENT("session.table_full");
+                return nullptr;
+            }
+
+            Session* session = new Session(socket, session_id);
+            sessions_.Publish(session_id, session);
+            STATS_SET_GAUGE("session.count", static_cast<double>(sessions_.GetCount()));
+            return session;
+        }
+
+        void SessionManager::RemoveSession(uint64_t session_id) {
+            RemoveSession(session_id, nullptr);
+        }
+
+        void SessionManager::RemoveSession(uint64_t session_id, ChatRoom* left_room) {
+            // 븦  ÷  ȸ   ã ϰ 
+            Session* session = sessions_.Remove(session_id);
+            if (!session) {
+                return;
+            }
+
+            if (!session->GetUserId().empty()) {
+                user_sessions_.EraseIfEqual(session->GetUserId(), session_id);
+            }
+            const std::string resume_token = session->GetResumeToken();
+            if (!resume_token.empty()) {
+                resume_tokens_.EraseIfEqual(resume_token, session_id);
+            }
+            ChatRoom* room = session->LeaveRoom();
+            if (!room) {
+                room = left_room;
+            }
+            FileDownloadManager::GetInstance()->CancelDownloadsForSession(session_id);
+            STATS_SET_GAUGE("session.count", static_cast<double>(sessions_.GetCount()));
+
+            //  /忡 ߿ ó  Ƿ  ڿ ȸ ѱ
+            // (̹ ͸   EpochGuard   )
+            if (!room) {
+                EpochReclaimer::GetInstance()->Retire(session);
+                return;
+            }
+            room->RunAfterLeave(session, [session]() {
+                EpochReclaimer::GetInstance()->Retire(session);
+            });
+        }
+
+        Session* SessionManager::FindSession(uint64_t session_id) {
+            return sessions_.Find(session_id);
+        }
+
+        Session* SessionManager::FindSessionByUserId(const std::string& user_id) {
+            uint64_t session_id;
+            if (!user_sessions_.Find(user_id, session_id)) {
+                return nullptr;
+            }
+            return sessions_.Find(session_id);
+        }
+
+        void SessionManager::BindUserId(Session* session, const std::string& user_id) {
+            user_sessions_.Assign(user_id, session->GetSessionId());
+        }
+
+        std::string SessionManager::EnableResume(Session* session) {
+            if (resume_grace_ms_.load(std::memory_order_relaxed) == 0) {
+                return std::string();
+            }
+
+            const std::vector<char> random = Common::Utils::CryptoUtils::GenerateRandomBytes(RESUME_TOKEN_SIZE);
+            std::string token(random.begin(), random.end());
+            session->EnableResume(token);
+            resume_tokens_.Assign(token, session->GetSessionId());
+            return token;
+        }
+
+        bool SessionManager::SuspendSession(uint64_t session_id) {
+            const uint32_t grace_ms = resume_grace_ms_.load(std::memory_order_relaxed);
+            bool suspended = false;
+            if (grace_ms != 0) {
+                EpochGuard guard;
+                Session* session = sessions_.Find(session_id);
+                suspended = session && session->Detach();
+            }
+            if (!suspended) {
+                RemoveSession(session_id);
+                return false;
+            }
+
+            //  ð ȿ Ѱܹ  ׶  ( 嵵 ׶ ϾǷ ª  ٸ ڿ  )
+            CoroutineTimer::GetInstance()->Schedule(
+                CoroutineTimer::Clock::now() + std::chrono::milliseconds(grace_ms),
+                [this, session_id]() {
+                    std::string token;
+                    bool expired = false;
+                    {
+                        EpochGuard guard;
+                        Session* session = sessions_.Find(session_id);
+                        expired = session && session->CancelResume(token);
+                    }
+                    if (expired) {
+                        resume_tokens_.EraseIfEqual(token, session_id);
+                        RemoveSession(session_id);
+                        STATS_INCREMENT("session.resume_expired");
+                    }
+                });
+            STATS_INCREMENT("session.suspended");
+            return true;
+        }
+
+        bool SessionManager::ResumeSession(Session* connection, const std::string& token, uint64_t last_sequence,
+            const std::function<void(size_t)>& on_accepted, int32_t& out_error) {
+            if (connection->IsLoggedIn()) {
+                out_error = Protocol::ErrorCode::USER_ALREADY_LOGGED_IN;
+                return false;
+            }
+
+            uint64_t session_id = 0;
+            Session* session = resume_tokens_.Find(token, session_id) ? sessions_.Find(session_id) : nullptr;
+            if (!session || session == connection) {
+                out_error = Protocol::ErrorCode::RESUME_NOT_FOUND;
+                STATS_INCREMENT("session.resume_failed");
+                return false;
+            }
+            if (!session->HandOver(connection, last_sequence, on_accepted, out_error)) {
+                STATS_INCREMENT("session.resume_failed");
+                return false;
+            }
+
+            // /ū ΰ  ڸ   ٲ     (̹ ŰǷ   )
+            BindUserId(connection, connection->GetUserId());
+            resume_tokens_.Assign(token, connection->GetSessionId());
+            ChatRoom* room = connection->GetCurrentRoom();
+            if (room) {
+                room->ReplaceParticipant(session, connection);
+            }
+            RemoveSession(session_id, room);
+
+            STATS_INCREMENT("session.resumed");
+            return true;
+        }
+
+        size_t SessionManager::GetSessionCount() const {
+            return sessions_.GetCount();
+        }
+
+        size_t SessionManager::GetResidentBytes() const {
+            size_t bytes = 0;
+
+            EpochGuard guard;
+            sessions_.ForEach([&bytes](Session* session) {
+                bytes += session->GetResidentBytes();
+            });
+            return bytes;
+        }
+
+        std::vector<std::string> SessionManager::GetConnectedUserIds() const {
+            std::vector<std::string> user_ids;
+            user_sessions_.ForEach([&user_ids](const std::string& user_id, uint64_t) {
+                user_ids.push_back(user_id);
+            });
+            return user_ids;
+        }
+
+        BroadcastHandle SessionManager::BroadcastToAll(const char* data, size_t size) {
+            return Broadcast(data, size, false);
+        }
+
+        BroadcastHandle SessionManager::BroadcastToLoggedInUsers(const char* data, size_t size) {
+            return Broadcast(data, size, true);
+        }
+
+        BroadcastHandle SessionManager::Broadcast(const char* data, size_t size, bool logged_in_only) {
+            WorkerExecutor* executor = WorkerExecutor::GetInstance();
+            const uint32_t slot_count = sessions_.GetHighWater();
+
+            //    ٿ ۾   ۺ Ŀ ʰ 
+            const size_t worker_count = std::max<size_t>(1, executor->GetWorkerCount());
+            const size_t partition_count = std::max<size_t>(1, std::min<size_t>(worker_count,
+                (slot_count + MIN_BROADCAST_PARTITION - 1) / MIN_BROADCAST_PARTITION));
+            const uint32_t partition_size = static_cast<uint32_t>((slot_count + partition_count - 1) / partition_count);
+
+            auto packet = std::make_shared<const std::vector<char>>(data, data + size);
+            auto completion = std::make_shared<BroadcastCompletion>(partition_count);
+            const auto started = std::chrono::steady_clock::now();
+
+            for (size_t i = 0; i < partition_count; ++i) {
+                const uint32_t begin = static_cast<uint32_t>(i * partition_size);
+                const uint32_t end = std::min(slot_count, begin + partition_size);
+
+                executor->Post(i, [this, packet, completion, begin, end, logged_in_only, started]() {
+                    size_t delivered = 0;
+                    {
+                        //  ȸ ߿ ŵ ǵ      
+                        EpochGuard guard;
+                        sessions_.ForEachInRange(begin, end, [&](Session* session) {
+                            if (!logged_in_only || session->IsLoggedIn()) {
+                                session->PostSend(packet);
+                                ++delivered;
+                            }
+                        });
+                    }
+
+                    if (completion->CompletePartition(delivered)) {
+                        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - started);
+                        STATS_RECORD("session.broadcast_ms", elapsed.count() / 1000.0);
+                    }
+                });
+            }
+
+            STATS_INCREMENT("session.broadcasts");
+            return completion;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,44 @@
+#include "pch.h"
+#include "SessionResume.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        ReplayRing::ReplayRing(size_t max_packets, size_t max_bytes)
+            : max_packets_(max_packets > 0 ? max_packets : 1)
+            , max_bytes_(max_bytes)
+            , memory_charge_(Common::MemoryCategory::REPLAY_BUFFER, 0) {
+        }
+
+        uint64_t ReplayRing::Push(Packet packet) {
+            size_t bytes = memory_charge_.GetBytes() + packet->size();
+            packets_.push_back(std::move(packet));
+
+            //    ϳ ѵ Ѵ  (  ʰ)
+            while (packets_.size() > 1 && (packets_.size() > max_packets_ || bytes > max_bytes_)) {
+                bytes -= packets_.front()->size();
+                packets_.pop_front();
+            }
+            memory_charge_.Resize(bytes);
+            return ++last_sequence_;
+        }
+
+        bool ReplayRing::CollectAfter(uint64_t last_sequence, std::vector<Packet>& out) const {
+            if (last_sequence > last_sequence_) {
+                return false;
+            }
+
+            const uint64_t missed = last_sequence_ - last_sequence;
+            if (missed > packets_.size()) {
+                return false;
+            }
+
+            out.reserve(out.size() + static_cast<size_t>(missed));
+            for (size_t i = packets_.size() - static_cast<size_t>(missed); i < packets_.size(); ++i) {
+                out.push_back(packets_[i]);
+            }
+            return true;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Common/Protocol.h"
+#include "../Common/MemoryAccountant.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        //  ֱٿ  ä 뿪 Ŷ  Բ ϴ 
+        //  1   ٰ,  Ʈ ѵ   ͺ з.
+        //  Ŭ̾Ʈ    ˷ ָ   Ŷ ٽ .
+        //  Ŷ  ũ ü REPLAY_BUFFER  ( 뷮 )
+        class ReplayRing {
+        public:
+            using Packet = std::shared_ptr<const std::vector<char>>;
+
+            ReplayRing(size_t max_packets = Protocol::Config::SESSION_REPLAY_MAX_PACKETS,
+                size_t max_bytes = Protocol::Config::SESSION_REPLAY_MAX_BYTES);
+
+            ReplayRing(ReplayRing&&) noexcept = default;
+            ReplayRing& operator=(ReplayRing&&) noexcept = default;
+
+            //   ٿ ϰ   ȯ
+            uint64_t Push(Packet packet);
+
+            // last_sequence  ݱ Ŷ  out .
+            //   Ŷ ̹ зų last_sequence    ̸ false
+            bool CollectAfter(uint64_t last_sequence, std::vector<Packet>& out) const;
+
+            uint64_t GetLastSequence() const { return last_sequence_; }
+            size_t GetCount() const { return packets_.size(); }
+            size_t GetBytes() const { return memory_charge_.GetBytes(); }
+
+        private:
+            std::deque<Packet> packets_;
+            uint64_t last_sequence_ = 0; //    (packets_.back() )
+            size_t max_packets_;
+            size_t max_bytes_;
+            Common::MemoryCharge memory_charge_;
+        };
+
+        //     (α   ,  ۽  ȿ )
+        struct ResumeState {
+            std::string token;
+            ReplayRing replay_ring;
+            int64_t detached_ms = 0;          // 0 ƴϸ    ٸ  ( ð)
+            uint64_t forward_session_id = 0;  //   Ѿ     ۽ ѱ 
+        };
+
+    } // namespace Core
+} // namespace NexusCore
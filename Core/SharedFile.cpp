@@ -0,0 +1,182 @@
+#include "pch.h"
+#include "SharedFile.h"
+
+#ifdef _WIN32
+#include <mswsock.h>
+#pragma comment(lib, "mswsock.lib")
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <poll.h>
+#include <cerrno>
+#endif
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            // ũ  ð  ƾ ̾ޱ⸦ 
+            uint64_t MakeVersion(uint64_t file_size, uint64_t modified) {
+                return modified ^ (file_size * 0x9E3779B97F4A7C15ULL);
+            }
+
+#ifndef _WIN32
+            constexpr int SEND_WAIT_TIMEOUT_MS = 5000; // ۽ ۰ ̸ŭ    ڷ  
+
+            // EAGAIN:  ۽ ۰   
+            bool WaitWritable(int fd) {
+                pollfd entry{ fd, POLLOUT, 0 };
+                for (;;) {
+                    const int ready = poll(&entry, 1, SEND_WAIT_TIMEOUT_MS);
+                    if (ready > 0) {
+                        return (entry.revents & (POLLERR | POLLHUP)) == 0;
+                    }
+                    if (ready == 0 || errno != EINTR) {
+                        return false;
+                    }
+                }
+            }
+#endif
+        }
+
+        SharedFile::SharedFile(const std::string& file_path, NativeFileHandle handle,
+            uint64_t file_size, uint64_t version)
+            : file_path_(file_path)
+            , handle_(handle)
+            , file_size_(file_size)
+            , version_(version) {
+        }
+
+        SharedFile::~SharedFile() {
+#ifdef _WIN32
+            CloseHandle(handle_);
+#else
+            close(handle_);
+#endif
+        }
+
+        std::shared_ptr<SharedFile> SharedFile::Open(const std::string& file_path) {
+#ifdef _WIN32
+            HANDLE handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (handle == INVALID_HANDLE_VALUE) {
+                return nullptr;
+            }
+
+            BY_HANDLE_FILE_INFORMATION info;
+            if (!GetFileInformationByHandle(handle, &info)) {
+                CloseHandle(handle);
+                return nullptr;
+            }
+
+            uint64_t file_size = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+            uint64_t modified = (static_cast<uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32)
+                | info.ftLastWriteTime.dwLowDateTime;
+#else
+            int handle = open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (handle < 0) {
+                return nullptr;
+            }
+
+            struct stat info;
+            if (fstat(handle, &info) != 0 || !S_ISREG(info.st_mode)) {
+                close(handle);
+                return nullptr;
+            }
+
+            uint64_t file_size = static_cast<uint64_t>(info.st_size);
+            uint64_t modified = static_cast<uint64_t>(info.st_mtim.tv_sec) * 1000000000ULL
+                + static_cast<uint64_t>(info.st_mtim.tv_nsec);
+#endif
+            return std::shared_ptr<SharedFile>(new SharedFile(file_path, handle, file_size, MakeVersion(file_size, modified)));
+        }
+
+        bool SharedFile::IsCurrent() const {
+#ifdef _WIN32
+            WIN32_FILE_ATTRIBUTE_DATA info;
+            if (!GetFileAttributesExA(file_path_.c_str(), GetFileExInfoStandard, &info)) {
+                return false;
+            }
+
+            uint64_t file_size = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+            uint64_t modified = (static_cast<uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32)
+                | info.ftLastWriteTime.dwLowDateTime;
+#else
+            struct stat info;
+            if (stat(file_path_.c_str(), &info) != 0) {
+                return false;
+            }
+
+            // ̸ ٲ ü   ũ/ð̾ ٸ inode
+            struct stat opened;
+            if (fstat(handle_, &opened) != 0 || opened.st_ino != info.st_ino || opened.st_dev != info.st_dev) {
+                return false;
+            }
+
+            uint64_t file_size = static_cast<uint64_t>(info.st_size);
+            uint64_t modified = static_cast<uint64_t>(info.st_mtim.tv_sec) * 1000000000ULL
+                + static_cast<uint64_t>(info.st_mtim.tv_nsec);
+#endif
+            return MakeVersion(file_size, modified) == version_;
+        }
+
+        bool TransmitFileRegion(SOCKET socket, const FileRegion& region,
+            const char* head, uint32_t head_size, OVERLAPPED* overlapped) {
+            if (!region.file || region.offset + region.length > region.file->GetSize()) {
+                return false;
+            }
+
+#ifdef _WIN32
+            //  OVERLAPPED  ( ڵ  ʹ  )
+            overlapped->Offset = static_cast<DWORD>(region.offset & 0xFFFFFFFF);
+            overlapped->OffsetHigh = static_cast<DWORD>(region.offset >> 32);
+
+            TRANSMIT_FILE_BUFFERS buffers;
+            ZeroMemory(&buffers, sizeof(buffers));
+            buffers.Head = const_cast<char*>(head);
+            buffers.HeadLength = head_size;
+
+            if (!TransmitFile(socket, region.file->GetNativeHandle(), region.length, 0,
+                overlapped, &buffers, TF_USE_KERNEL_APC)) {
+                return WSAGetLastError() == WSA_IO_PENDING;
+            }
+            return true;
+#else
+            (void)overlapped;
+            const int fd = static_cast<int>(socket);
+
+            //  MSG_MORE     ׸Ʈ ̰ Ѵ
+            size_t head_sent = 0;
+            while (head_sent < head_size) {
+                ssize_t sent = send(fd, head + head_sent, head_size - head_sent, MSG_MORE | MSG_NOSIGNAL);
+                if (sent < 0) {
+                    if (errno == EINTR) continue;
+                    if ((errno == EAGAIN || errno == EWOULDBLOCK) && WaitWritable(fd)) continue;
+                    return false;
+                }
+                head_sent += static_cast<size_t>(sent);
+            }
+
+            off_t offset = static_cast<off_t>(region.offset);
+            size_t remaining = region.length;
+            while (remaining > 0) {
+                ssize_t sent = sendfile(fd, region.file->GetNativeHandle(), &offset, remaining);
+                if (sent < 0) {
+                    if (errno == EINTR) continue;
+                    if ((errno == EAGAIN || errno == EWOULDBLOCK) && WaitWritable(fd)) continue;
+                    return false;
+                }
+                if (sent == 0) {
+                    return false; //  ߸
+                }
+                remaining -= static_cast<size_t>(sent);
+            }
+            return true;
+#endif
+        }
+
+    } // namespace Core
+} // namespace NexusCore
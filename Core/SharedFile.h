@@ -0,0 +1,58 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NexusCore {
+    namespace Core {
+
+#ifdef _WIN32
+        using NativeFileHandle = HANDLE;
+#else
+        using NativeFileHandle = int;
+#endif
+
+        //   ÿ ϴ б  
+        //   ۸ ϹǷ ϳ ڵ  ٿε尡 Բ ᵵ ϴ.
+        class SharedFile {
+        public:
+            static std::shared_ptr<SharedFile> Open(const std::string& file_path);
+            ~SharedFile();
+
+            SharedFile(const SharedFile&) = delete;
+            SharedFile& operator=(const SharedFile&) = delete;
+
+            NativeFileHandle GetNativeHandle() const { return handle_; }
+            const std::string& GetPath() const { return file_path_; }
+            uint64_t GetSize() const { return file_size_; }
+            uint64_t GetVersion() const { return version_; } // ũ +  ð 
+
+            //     ڵ     (ü/Ǿų  false)
+            bool IsCurrent() const;
+
+        private:
+            SharedFile(const std::string& file_path, NativeFileHandle handle, uint64_t file_size, uint64_t version);
+
+            std::string file_path_;
+            NativeFileHandle handle_;
+            uint64_t file_size_;
+            uint64_t version_;
+        };
+
+        //   
+        struct FileRegion {
+            std::shared_ptr<SharedFile> file;
+            uint64_t offset = 0;
+            uint32_t length = 0;
+        };
+
+        //  Ʈ ڿ   Ŀο   (   )
+        // Windows: TransmitFile (overlapped, Ϸ IOCP )
+        // Linux: MSG_MORE  + sendfile (ȣ ȯ  Ϸ, ŷ ̸     ٸ)
+        bool TransmitFileRegion(SOCKET socket, const FileRegion& region,
+            const char* head, uint32_t head_size, OVERLAPPED* overlapped);
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        // ̸ Ҵ  迭 +  ȣ  ID ̺
+        // ID = ( << 32) |  ε.    밡 ö󰡹Ƿ
+        //  ü  IDδ    ü ã Ѵ.
+        // ȸ   ε  +  , /    ؽ ´.
+        // ã ʹ EpochGuard ȿ ϰ,  Remove  EpochReclaimer ̷.
+        template<typename T>
+        class SlotTable {
+        public:
+            static constexpr uint64_t INVALID_ID = 0;
+
+            explicit SlotTable(uint32_t capacity)
+                : slots_(new Slot[capacity])
+                , capacity_(capacity) {
+                free_slots_.reserve(capacity);
+                for (uint32_t i = capacity; i > 0; --i) {
+                    free_slots_.push_back(i - 1);
+                }
+            }
+
+            SlotTable(const SlotTable&) = delete;
+            SlotTable& operator=(const SlotTable&) = delete;
+
+            //   ϰ ID ȯ (ü Publish Խ).   INVALID_ID
+            uint64_t Allocate() {
+                uint32_t index;
+                {
+                    std::lock_guard<std::mutex> lock(free_mutex_);
+                    if (free_slots_.empty()) {
+                        return INVALID_ID;
+                    }
+                    index = free_slots_.back();
+                    free_slots_.pop_back();
+                }
+
+                uint32_t high_water = high_water_.load(std::memory_order_relaxed);
+                while (index + 1 > high_water &&
+                    !high_water_.compare_exchange_weak(high_water, index + 1, std::memory_order_relaxed)) {
+                }
+                return MakeId(index, slots_[index].generation.load(std::memory_order_relaxed));
+            }
+
+            void Publish(uint64_t id, T* object) {
+                slots_[GetIndex(id)].object.store(object, std::memory_order_release);
+                count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // 븦 ÷  ID ȿȭϰ ü  (̹ ų ٸ  nullptr)
+            T* Remove(uint64_t id) {
+                const uint32_t index = GetIndex(id);
+                if (index >= capacity_) {
+                    return nullptr;
+                }
+
+                Slot& slot = slots_[index];
+                uint32_t generation = GetGeneration(id);
+                const uint32_t next_generation = (generation == UINT32_MAX) ? 1 : generation + 1;
+                if (!slot.generation.compare_exchange_strong(generation, next_generation, std::memory_order_acq_rel)) {
+                    return nullptr;
+                }
+
+                T* object = slot.object.exchange(nullptr, std::memory_order_acq_rel);
+                if (object) {
+                    count_.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                std::lock_guard<std::mutex> lock(free_mutex_);
+                free_slots_.push_back(index);
+                return object;
+            }
+
+            //   ȸ. ID 밡    ٸ nullptr
+            T* Find(uint64_t id) const {
+                const uint32_t index = GetIndex(id);
+                if (index >= capacity_) {
+                    return nullptr;
+                }
+
+                const Slot& slot = slots_[index];
+                const uint32_t generation = GetGeneration(id);
+                if (slot.generation.load(std::memory_order_acquire) != generation) {
+                    return nullptr;
+                }
+                T* object = slot.object.load(std::memory_order_acquire);
+                if (slot.generation.load(std::memory_order_acquire) != generation) {
+                    return nullptr; // д ̿ ŵ
+                }
+                return object;
+            }
+
+            // Խõ  ü ȸ (  ִ  )
+            template<typename Func>
+            void ForEach(Func func) const {
+                ForEachInRange(0, GetHighWater(), func);
+            }
+
+            // [begin, end)   ȸ (   尡 ķ ȸ )
+            template<typename Func>
+            void ForEachInRange(uint32_t begin, uint32_t end, Func func) const {
+                end = (end < capacity_) ? end : capacity_;
+                for (uint32_t i = begin; i < end; ++i) {
+                    if (T* object = slots_[i].object.load(std::memory_order_acquire)) {
+                        func(object);
+                    }
+                }
+            }
+
+            uint32_t GetHighWater() const { return high_water_.load(std::memory_order_acquire); } //   ִ  
+
+            size_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+            uint32_t GetCapacity() const { return capacity_; }
+
+            static uint32_t GetIndex(uint64_t id) { return static_cast<uint32_t>(id & 0xFFFFFFFF); }
+            static uint32_t GetGeneration(uint64_t id) { return static_cast<uint32_t>(id >> 32); }
+
+        private:
+            struct Slot {
+                std::atomic<T*> object{ nullptr };
+                std::atomic<uint32_t> generation{ 1 }; // 0   (ID 0  ʵ)
+            };
+
+            static uint64_t MakeId(uint32_t index, uint32_t generation) {
+                return (static_cast<uint64_t>(generation) << 32) | index;
+            }
+
+            std::unique_ptr<Slot[]> slots_;
+            const uint32_t capacity_;
+            std::atomic<uint32_t> high_water_{ 0 };
+            std::atomic<size_t> count_{ 0 };
+
+            std::mutex free_mutex_;
+            std::vector<uint32_t> free_slots_; // ֱٿ  Ժ  (ĳÿ   ɼ)
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -1,2 +1,143 @@
 #include "pch.h"
 #include "Statistics.h"
+#include "../Common/MemoryAccountant.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace NexusCore {
+    namespace Core {
+
+        Statistics* Statistics::instance_ = nullptr;
+        std::once_flag Statistics::init_flag_;
+
+        Statistics* Statistics::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new Statistics();
+            });
+            return instance_;
+        }
+
+        Statistics::Statistics()
+            : server_start_time_(std::chrono::system_clock::now()) {
+        }
+
+        Statistics::~Statistics() {
+        }
+
+        void Statistics::IncrementCounter(const std::string& name, uint64_t value) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            counters_[name].fetch_add(value, std::memory_order_relaxed);
+        }
+
+        void Statistics::DecrementCounter(const std::string& name, uint64_t value) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            counters_[name].fetch_sub(value, std::memory_order_relaxed);
+        }
+
+        void Statistics::SetCounter(const std::string& name, uint64_t value) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            counters_[name].store(value, std::memory_order_relaxed);
+        }
+
+        uint64_t Statistics::GetCounter(const std::string& name) const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            auto it = counters_.find(name);
+            return it != counters_.end() ? it->second.load(std::memory_order_relaxed) : 0;
+        }
+
+        void Statistics::SetGauge(const std::string& name, double value) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            gauges_[name].store(value, std::memory_order_relaxed);
+        }
+
+        double Statistics::GetGauge(const std::string& name) const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            auto it = gauges_.find(name);
+            return it != gauges_.end() ? it->second.load(std::memory_order_relaxed) : 0.0;
+        }
+
+        void Statistics::RecordValue(const std::string& name, double value) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            HistogramData& histogram = histograms_[name];
+            histogram.sum += value;
+            histogram.min_value = (std::min)(histogram.min_value, value);
+            histogram.max_value = (std::max)(histogram.max_value, value);
+            ++histogram.count;
+        }
+
+        double Statistics::GetAverage(const std::string& name) const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            auto it = histograms_.find(name);
+            return it != histograms_.end() && it->second.count != 0 ?
+                it->second.sum / static_cast<double>(it->second.count) : 0.0;
+        }
+
+        double Statistics::GetMin(const std::string& name) const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            auto it = histograms_.find(name);
+            return it != histograms_.end() && it->second.count != 0 ? it->second.min_value : 0.0;
+        }
+
+        double Statistics::GetMax(const std::string& name) const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            auto it = histograms_.find(name);
+            return it != histograms_.end() && it->second.count != 0 ? it->second.max_value : 0.0;
+        }
+
+        std::string Statistics::GenerateReport() const {
+            std::ostringstream report;
+            const auto uptime = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now() - GetServerStartTime()).count();
+
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            report << "uptime_sec " << uptime << "\n";
+            for (const auto& [name, counter] : counters_) {
+                report << "counter " << name << " " << counter.load(std::memory_order_relaxed) << "\n";
+            }
+            for (const auto& [name, gauge] : gauges_) {
+                report << "gauge " << name << " " << gauge.load(std::memory_order_relaxed) << "\n";
+            }
+            for (const auto& [name, histogram] : histograms_) {
+                if (histogram.count == 0) {
+                    continue;
+                }
+                report << "histogram " << name << " count=" << histogram.count
+                    << " avg=" << histogram.sum / static_cast<double>(histogram.count)
+                    << " min=" << histogram.min_value << " max=" << histogram.max_value << "\n";
+            }
+            return report.str();
+        }
+
+        void Statistics::ResetAllStats() {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            counters_.clear();
+            gauges_.clear();
+            histograms_.clear();
+        }
+
+        void Statistics::MarkServerStart() {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            server_start_time_ = std::chrono::system_clock::now();
+        }
+
+        std::chrono::system_clock::time_point Statistics::GetServerStartTime() const {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            return server_start_time_;
+        }
+
+        void Statistics::PublishMemoryUsage() {
+            auto* accountant = Common::MemoryAccountant::GetInstance();
+            for (size_t category = 0; category < Common::MEMORY_CATEGORY_COUNT; ++category) {
+                const auto memory_category = static_cast<Common::MemoryCategory>(category);
+                SetGauge(std::string("memory.") + Common::MemoryAccountant::GetCategoryName(memory_category) + "_bytes",
+                    static_cast<double>(accountant->GetUsage(memory_category)));
+            }
+            SetGauge("memory.total_bytes", static_cast<double>(accountant->GetUsage()));
+            SetGauge("memory.soft_limit_bytes", static_cast<double>(accountant->GetSoftLimit()));
+            SetGauge("memory.hard_limit_bytes", static_cast<double>(accountant->GetHardLimit()));
+            SetGauge("memory.pressure", static_cast<double>(accountant->GetPressure()));
+        }
+
+    } // namespace Core
+} // namespace NexusCore
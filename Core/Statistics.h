@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <limits>
 #include <map>
 #include <string>
 #include <mutex>
@@ -37,6 +38,9 @@ namespace NexusCore {
             void MarkServerStart();
             std::chrono::system_clock::time_point GetServerStartTime() const;
 
+            // MemoryAccountant 뵵 뷮, ѵ, з ܰ踦 "memory.*"  ű ( ȭ  ֱ⿡ ȣ)
+            void PublishMemoryUsage();
+
         private:
             Statistics();
             ~Statistics();
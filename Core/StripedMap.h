@@ -0,0 +1,114 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace NexusCore {
+    namespace Core {
+
+        // Ű ؽ÷   (stripe)    ؽ 
+        //  ٸ  ȸ/  ٸ Ƿ ھ ŭ þ.
+        template<typename Key, typename Value, typename Hash = std::hash<Key>>
+        class StripedMap {
+        public:
+            explicit StripedMap(size_t stripe_count = 64)
+                : stripes_(new Stripe[stripe_count])
+                , stripe_count_(stripe_count) {
+                for (size_t i = 0; i < stripe_count_; ++i) {
+                    InitializeSRWLock(&stripes_[i].lock);
+                }
+            }
+
+            StripedMap(const StripedMap&) = delete;
+            StripedMap& operator=(const StripedMap&) = delete;
+
+            //  Ǵ 
+            void Assign(const Key& key, const Value& value) {
+                Stripe& stripe = GetStripe(key);
+                AcquireSRWLockExclusive(&stripe.lock);
+                stripe.map[key] = value;
+                ReleaseSRWLockExclusive(&stripe.lock);
+            }
+
+            //   . ̹  false
+            bool Insert(const Key& key, const Value& value) {
+                Stripe& stripe = GetStripe(key);
+                AcquireSRWLockExclusive(&stripe.lock);
+                bool inserted = stripe.map.emplace(key, value).second;
+                ReleaseSRWLockExclusive(&stripe.lock);
+                return inserted;
+            }
+
+            bool Find(const Key& key, Value& out_value) const {
+                const Stripe& stripe = GetStripe(key);
+                AcquireSRWLockShared(&stripe.lock);
+                auto it = stripe.map.find(key);
+                bool found = it != stripe.map.end();
+                if (found) {
+                    out_value = it->second;
+                }
+                ReleaseSRWLockShared(&stripe.lock);
+                return found;
+            }
+
+            bool Erase(const Key& key) {
+                Stripe& stripe = GetStripe(key);
+                AcquireSRWLockExclusive(&stripe.lock);
+                bool erased = stripe.map.erase(key) > 0;
+                ReleaseSRWLockExclusive(&stripe.lock);
+                return erased;
+            }
+
+            //  expected   (  ٸ  ٲ )
+            bool EraseIfEqual(const Key& key, const Value& expected) {
+                Stripe& stripe = GetStripe(key);
+                AcquireSRWLockExclusive(&stripe.lock);
+                auto it = stripe.map.find(key);
+                bool erased = it != stripe.map.end() && it->second == expected;
+                if (erased) {
+                    stripe.map.erase(it);
+                }
+                ReleaseSRWLockExclusive(&stripe.lock);
+                return erased;
+            }
+
+            //  ׸ ȸ (ü  ƴ)
+            template<typename Func>
+            void ForEach(Func func) const {
+                for (size_t i = 0; i < stripe_count_; ++i) {
+                    AcquireSRWLockShared(&stripes_[i].lock);
+                    for (const auto& entry : stripes_[i].map) {
+                        func(entry.first, entry.second);
+                    }
+                    ReleaseSRWLockShared(&stripes_[i].lock);
+                }
+            }
+
+            size_t GetSize() const {
+                size_t size = 0;
+                for (size_t i = 0; i < stripe_count_; ++i) {
+                    AcquireSRWLockShared(&stripes_[i].lock);
+                    size += stripes_[i].map.size();
+                    ReleaseSRWLockShared(&stripes_[i].lock);
+                }
+                return size;
+            }
+
+        private:
+            struct alignas(64) Stripe {
+                mutable SRWLOCK lock;
+                std::unordered_map<Key, Value, Hash> map;
+            };
+
+            Stripe& GetStripe(const Key& key) { return stripes_[Hash()(key) % stripe_count_]; }
+            const Stripe& GetStripe(const Key& key) const { return stripes_[Hash()(key) % stripe_count_]; }
+
+            std::unique_ptr<Stripe[]> stripes_;
+            const size_t stripe_count_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,392 @@
+#include "pch.h"
+#include "TaskScheduler.h"
+#include "ThreadPlacement.h"
+#include "Statistics.h"
+
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr size_t STRAND_DRAIN_BUDGET = 32; // Ʈ ϳ    ִ ۾ 
+
+            thread_local int current_worker_index = -1;
+            thread_local TaskStrand* current_strand = nullptr;
+        }
+
+        TaskScheduler* TaskScheduler::instance_ = nullptr;
+        std::once_flag TaskScheduler::init_flag_;
+
+        TaskScheduler* TaskScheduler::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new TaskScheduler();
+            });
+            return instance_;
+        }
+
+        TaskScheduler::~TaskScheduler() {
+            Stop();
+        }
+
+        bool TaskScheduler::Start(size_t worker_count) {
+            WorkerPoolOptions options;
+            options.min_workers = worker_count;
+            options.max_workers = worker_count;
+            return Start(options);
+        }
+
+        bool TaskScheduler::Start(const WorkerPoolOptions& options) {
+            if (options.min_workers == 0 || is_running_.exchange(true)) {
+                return false;
+            }
+
+            controller_ = WorkerPoolController(options);
+            const size_t worker_count = controller_.GetOptions().max_workers;
+            active_count_ = controller_.GetOptions().min_workers;
+            last_sample_time_ = Clock::now();
+            last_busy_ns_ = 0;
+
+            workers_.clear();
+            for (size_t i = 0; i < worker_count; ++i) {
+                workers_.push_back(std::make_unique<Worker>());
+            }
+            for (size_t i = 0; i < worker_count; ++i) {
+                workers_[i]->thread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+            }
+            if (worker_count > active_count_) {
+                scaling_thread_ = std::thread(&TaskScheduler::ScalingLoop, this);
+            }
+            STATS_SET_GAUGE("scheduler.active_workers", static_cast<double>(active_count_.load()));
+            return true;
+        }
+
+        void TaskScheduler::Stop() {
+            if (!is_running_.exchange(false)) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(scaling_mutex_);
+                scaling_cv_.notify_all();
+            }
+            if (scaling_thread_.joinable()) {
+                scaling_thread_.join();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                inject_cv_.notify_all();
+                park_cv_.notify_all(); //  Ŀ   ۾  
+            }
+            for (auto& worker : workers_) {
+                if (worker->thread.joinable()) {
+                    worker->thread.join();
+                }
+            }
+            workers_.clear();
+        }
+
+        void TaskScheduler::Submit(Task task) {
+            if (!is_running_ || workers_.empty()) {
+                task();
+                return;
+            }
+
+            auto* item = new Task(std::move(task));
+            ++pending_count_; // ֱ  ÷     ʰ 
+            const int worker_index = current_worker_index;
+            if (worker_index >= 0 && static_cast<size_t>(worker_index) < workers_.size()) {
+                workers_[worker_index]->deque.Push(item);
+            }
+            else {
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                injected_.push_back(item);
+            }
+            WakeWorker();
+        }
+
+        void TaskScheduler::Submit(Task task, Protocol::PacketClass lane) {
+            if (!is_running_ || workers_.empty()) {
+                task();
+                return;
+            }
+
+            auto* item = new Task(std::move(task));
+            ++pending_count_;
+            {
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                lanes_[static_cast<size_t>(lane)].push_back(item);
+            }
+            WakeWorker();
+        }
+
+        void TaskScheduler::WakeWorker() {
+            // ڴ Ŀ    (pending_count_  øǷ   Ŀ ġ )
+            if (sleeping_count_.load() > 0) {
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                inject_cv_.notify_one();
+            }
+        }
+
+        void TaskScheduler::SetActiveWorkerCount(size_t count) {
+            count = (std::min)((std::max)(count, static_cast<size_t>(1)), (std::max)(workers_.size(), static_cast<size_t>(1)));
+
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            active_count_ = count;
+            park_cv_.notify_all();
+        }
+
+        ScalingDecision TaskScheduler::AdjustWorkerCount() {
+            std::lock_guard<std::mutex> lock(scaling_mutex_);
+            if (!is_running_) {
+                return ScalingDecision();
+            }
+
+            const Clock::time_point now = Clock::now();
+            uint64_t busy_ns = 0;
+            for (const auto& worker : workers_) {
+                busy_ns += worker->busy_ns;
+            }
+
+            WorkerPoolSample sample;
+            sample.active_workers = active_count_;
+            sample.queue_depth = pending_count_;
+            const double capacity_ns = std::chrono::duration<double, std::nano>(now - last_sample_time_).count() * sample.active_workers;
+            if (capacity_ns > 0.0) {
+                //   Ŀ   ۾   ־ 1 ڸ
+                sample.utilization = (std::min)(static_cast<double>(busy_ns - last_busy_ns_) / capacity_ns, 1.0);
+            }
+            last_sample_time_ = now;
+            last_busy_ns_ = busy_ns;
+            STATS_SET_GAUGE("scheduler.utilization", sample.utilization);
+
+            const ScalingDecision decision = controller_.Evaluate(sample);
+            if (decision.action == ScalingAction::HOLD) {
+                return decision;
+            }
+
+            SetActiveWorkerCount(decision.to_workers);
+            if (decision.action == ScalingAction::GROW) {
+                STATS_INCREMENT("scheduler.scale_ups");
+            }
+            else {
+                STATS_INCREMENT("scheduler.scale_downs");
+            }
+            STATS_SET_GAUGE("scheduler.active_workers", static_cast<double>(active_count_.load()));
+            if (scaling_listener_) {
+                scaling_listener_(decision);
+            }
+            return decision;
+        }
+
+        void TaskScheduler::SetScalingListener(ScalingListener listener) {
+            std::lock_guard<std::mutex> lock(scaling_mutex_);
+            scaling_listener_ = std::move(listener);
+        }
+
+        void TaskScheduler::ScalingLoop() {
+            const auto interval = std::chrono::milliseconds(controller_.GetOptions().sample_interval_ms);
+
+            std::unique_lock<std::mutex> lock(scaling_mutex_);
+            while (!scaling_cv_.wait_for(lock, interval, [this]() { return !is_running_; })) {
+                lock.unlock();
+                AdjustWorkerCount();
+                lock.lock();
+            }
+        }
+
+        void TaskScheduler::SetLaneWeight(Protocol::PacketClass lane, uint32_t weight) {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            lane_selector_.SetWeight(lane, weight);
+        }
+
+        size_t TaskScheduler::GetLaneDepth(Protocol::PacketClass lane) const {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            return lanes_[static_cast<size_t>(lane)].size();
+        }
+
+        bool TaskScheduler::PopLaneTask(Task*& out_task) {
+            Protocol::PacketClass lane;
+            const bool found = lane_selector_.Select(
+                [this](Protocol::PacketClass candidate) { return !lanes_[static_cast<size_t>(candidate)].empty(); },
+                [](Protocol::PacketClass) { return 1; }, // ۾  
+                lane);
+            if (!found) {
+                return false;
+            }
+
+            auto& queue = lanes_[static_cast<size_t>(lane)];
+            out_task = queue.front();
+            queue.pop_front();
+            return true;
+        }
+
+        bool TaskScheduler::FindTask(size_t worker_index, Task*& out_task) {
+            Worker& self = *workers_[worker_index];
+            if (self.deque.Pop(out_task)) {
+                return true;
+            }
+
+            {
+                //   ->    ۾ ->  (ġ) 
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                auto& control = lanes_[static_cast<size_t>(Protocol::PacketClass::CONTROL)];
+                if (!control.empty()) {
+                    out_task = control.front();
+                    control.pop_front();
+                    return true;
+                }
+                if (!injected_.empty()) {
+                    out_task = injected_.front();
+                    injected_.pop_front();
+                    return true;
+                }
+                if (PopLaneTask(out_task)) {
+                    return true;
+                }
+            }
+
+            //  Ŀ ʷ ħ
+            const size_t worker_count = workers_.size();
+            for (size_t offset = 1; offset < worker_count; ++offset) {
+                if (workers_[(worker_index + offset) % worker_count]->deque.Steal(out_task)) {
+                    ++self.steal_count;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void TaskScheduler::WorkerLoop(size_t worker_index) {
+            current_worker_index = static_cast<int>(worker_index);
+            ThreadPlacement::GetInstance()->PinCurrentThread(ThreadRole::WORKER, worker_index);
+            Worker& self = *workers_[worker_index];
+            bool is_busy = false;
+            Clock::time_point busy_since;
+
+            for (;;) {
+                if (worker_index >= active_count_.load(std::memory_order_relaxed) && self.deque.GetSize() == 0 && is_running_) {
+                    //  پ: ٽ Ȱ ǰų   
+                    std::unique_lock<std::mutex> lock(inject_mutex_);
+                    if (pending_count_.load() > 0) {
+                        inject_cv_.notify_one(); //  Ŀ  ⸦ ٸ Ŀ ѱ
+                    }
+                    park_cv_.wait(lock, [this, worker_index]() { return worker_index < active_count_.load() || !is_running_; });
+                    is_busy = false;
+                    continue;
+                }
+
+                Task* task = nullptr;
+                if (FindTask(worker_index, task)) {
+                    if (!is_busy) {
+                        busy_since = Clock::now();
+                        is_busy = true;
+                    }
+                    --pending_count_;
+                    (*task)();
+                    delete task;
+                    ++self.executed_count;
+
+                    const Clock::time_point now = Clock::now();
+                    self.busy_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - busy_since).count());
+                    busy_since = now;
+                    continue;
+                }
+                is_busy = false;
+
+                if (pending_count_.load() > 0) {
+                    std::this_thread::yield(); // ٸ Ŀ ִ ̰ų ġ ￡ 
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(inject_mutex_);
+                if (!is_running_ && pending_count_.load() == 0) {
+                    break; //  û +  ۾ 
+                }
+                ++sleeping_count_;
+                inject_cv_.wait(lock, [this]() { return pending_count_.load() > 0 || !is_running_; });
+                --sleeping_count_;
+            }
+
+            current_worker_index = -1;
+        }
+
+        int TaskScheduler::GetCurrentWorkerIndex() {
+            return current_worker_index;
+        }
+
+        uint64_t TaskScheduler::GetExecutedCount() const {
+            uint64_t count = 0;
+            for (const auto& worker : workers_) {
+                count += worker->executed_count;
+            }
+            return count;
+        }
+
+        uint64_t TaskScheduler::GetStealCount() const {
+            uint64_t count = 0;
+            for (const auto& worker : workers_) {
+                count += worker->steal_count;
+            }
+            return count;
+        }
+
+        void TaskScheduler::PublishStatistics() const {
+            STATS_SET_GAUGE("scheduler.queue_depth", static_cast<double>(GetQueueDepth()));
+            STATS_SET_GAUGE("scheduler.active_workers", static_cast<double>(GetActiveWorkerCount()));
+            STATS_SET_GAUGE("scheduler.executed", static_cast<double>(GetExecutedCount()));
+            STATS_SET_GAUGE("scheduler.steals", static_cast<double>(GetStealCount()));
+            STATS_SET_GAUGE("scheduler.lane_depth.control", static_cast<double>(GetLaneDepth(Protocol::PacketClass::CONTROL)));
+            STATS_SET_GAUGE("scheduler.lane_depth.chat", static_cast<double>(GetLaneDepth(Protocol::PacketClass::CHAT)));
+            STATS_SET_GAUGE("scheduler.lane_depth.bulk", static_cast<double>(GetLaneDepth(Protocol::PacketClass::BULK)));
+            STATS_SET_GAUGE("scheduler.lane_depth.admin", static_cast<double>(GetLaneDepth(Protocol::PacketClass::ADMIN)));
+        }
+
+        // ===== TaskStrand =====
+
+        void TaskStrand::Post(Task task) {
+            ++pending_count_;
+            mailbox_.Push(std::move(task));
+            Schedule();
+        }
+
+        void TaskStrand::Schedule() {
+            if (!is_scheduled_.exchange(true)) {
+                //   ۾ Ʈ带  Ƿ    
+                auto drain = [self = shared_from_this()]() { self->Drain(); };
+                if (has_lane_) {
+                    TaskScheduler::GetInstance()->Submit(std::move(drain), lane_);
+                }
+                else {
+                    TaskScheduler::GetInstance()->Submit(std::move(drain));
+                }
+            }
+        }
+
+        TaskStrand* TaskStrand::GetCurrent() {
+            return current_strand;
+        }
+
+        void TaskStrand::Drain() {
+            Task task;
+            size_t processed = 0;
+            TaskStrand* previous_strand = current_strand; // ٷ   ٸ Ʈ ȿ ٷ   
+            current_strand = this;
+            while (processed < STRAND_DRAIN_BUDGET && mailbox_.Pop(task)) {
+                --pending_count_;
+                task();
+                task = nullptr;
+                ++processed;
+            }
+            current_strand = previous_strand;
+
+            //  ۾ ٽ  ٸ Ʈ忡Ե ʸ  (Post pending_count_  øǷ ġ )
+            is_scheduled_.store(false);
+            if (pending_count_.load() > 0) {
+                Schedule();
+            }
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include "../Common/Protocol.h"
+#include "WorkStealingDeque.h"
+#include "Actor.h"
+#include "LaneSelector.h"
+#include "WorkerPoolController.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // ڵ鷯  ۾ ġ ٷ
+        // Ŀ Chase-Lev  ΰ, Ŀ ȿ  ۾ ڱ , (IO )  ۾
+        //   ť ִ´.    Ŀ  ť -> ٸ Ŀ   Ƿ
+        //  ڵ鷯 ϳ  Ŀ Ƶ  ڿ  ۾ ٸ Ŀ óѴ.
+        // ۾   ʿϸ TaskStrand ´.
+        // Ŀ   ְ ϸ ִ ŭ  ΰ, Ŀ ۾  ð  ۾ 
+        // ֱ⸶ WorkerPoolController Ѱ Ȱ Ŀ  Ѵ.  پ Ŀ ڱ    .
+        // Ŷ ó ۾  Ŭ  ִ´.   忡 ֵ ̰,
+        //    ,  ġ(DRR)  Ƿ ε尡  ä ó и ʴ´.
+        class TaskScheduler {
+        public:
+            using Task = std::function<void()>;
+            using Clock = std::chrono::steady_clock;
+            using ScalingListener = std::function<void(const ScalingDecision&)>;
+
+            static TaskScheduler* GetInstance();
+
+            bool Start(size_t worker_count); //  ũ
+            bool Start(const WorkerPoolOptions& options); // min_workers  max_workers ڵ 
+            void Stop(); //  ۾    
+            bool IsRunning() const { return is_running_; }
+
+            // ۾ .   ƴϸ ȣ 忡 ٷ 
+            void Submit(Task task);
+            void Submit(Task task, Protocol::PacketClass lane); //  Ŭ 
+
+            void SetLaneWeight(Protocol::PacketClass lane, uint32_t weight); //    켱̶ 
+
+            size_t GetWorkerCount() const { return workers_.size(); }
+            size_t GetActiveWorkerCount() const { return active_count_; }
+            void SetActiveWorkerCount(size_t count); // 1 ~ GetWorkerCount 
+
+            //       ϰ  (ڵ  ̸ sample_interval_ms Ҹ)
+            ScalingDecision AdjustWorkerCount();
+            void SetScalingListener(ScalingListener listener); // HOLD ƴ   忡 ȣ (α׿)
+            static int GetCurrentWorkerIndex(); // Ŀ 尡 ƴϸ -1
+
+            // 
+            uint64_t GetExecutedCount() const;
+            uint64_t GetStealCount() const;
+            size_t GetQueueDepth() const { return pending_count_; } //    ۾ 
+            size_t GetLaneDepth(Protocol::PacketClass lane) const;
+            void PublishStatistics() const; // Statistics   ( ȭ  ֱ⿡ ȣ)
+
+        private:
+            TaskScheduler() = default;
+            ~TaskScheduler();
+
+            struct Worker {
+                WorkStealingDeque<Task*> deque;
+                std::thread thread;
+                std::atomic<uint64_t> executed_count{ 0 };
+                std::atomic<uint64_t> steal_count{ 0 };
+                std::atomic<uint64_t> busy_ns{ 0 }; // ۾   ð (۾   )
+            };
+
+            void WorkerLoop(size_t worker_index);
+            bool FindTask(size_t worker_index, Task*& out_task);
+            bool PopLaneTask(Task*& out_task); // inject_mutex_ ȿ ȣ
+            void WakeWorker();
+            void ScalingLoop();
+
+            std::vector<std::unique_ptr<Worker>> workers_;
+            std::atomic<bool> is_running_{ false };
+            std::atomic<size_t> pending_count_{ 0 };
+            std::atomic<size_t> sleeping_count_{ 0 };
+            std::atomic<size_t> active_count_{ 0 }; // ȣ ̺  Ŀ ۾ 
+
+            mutable std::mutex inject_mutex_;
+            std::condition_variable inject_cv_;
+            std::deque<Task*> injected_; // Ŀ ƴ 尡  ۾
+            std::deque<Task*> lanes_[Protocol::PACKET_CLASS_COUNT];
+            LaneSelector lane_selector_;
+            std::condition_variable park_cv_; //  پ  Ŀ (inject_mutex_)
+
+            std::mutex scaling_mutex_;
+            std::condition_variable scaling_cv_;
+            std::thread scaling_thread_;
+            WorkerPoolController controller_;
+            ScalingListener scaling_listener_;
+            Clock::time_point last_sample_time_;
+            uint64_t last_busy_ns_ = 0;
+
+            static TaskScheduler* instance_;
+            static std::once_flag init_flag_;
+        };
+
+        //  ʿ ۾  (Ǹ ϳ)
+        //     ϳ ,  Ŀ  ٷ Ѵ.
+        class TaskStrand : public std::enable_shared_from_this<TaskStrand> {
+        public:
+            using Task = TaskScheduler::Task;
+
+            static std::shared_ptr<TaskStrand> Create() { return std::shared_ptr<TaskStrand>(new TaskStrand()); }
+            static std::shared_ptr<TaskStrand> Create(Protocol::PacketClass lane) { // ٷ  
+                auto strand = Create();
+                strand->lane_ = lane;
+                strand->has_lane_ = true;
+                return strand;
+            }
+
+            void Post(Task task);
+            size_t GetPendingCount() const { return pending_count_; }
+
+            static TaskStrand* GetCurrent(); //  尡    Ʈ ( nullptr)
+
+        private:
+            TaskStrand() = default;
+
+            void Schedule();
+            void Drain();
+
+            ActorMailbox mailbox_;
+            std::atomic<size_t> pending_count_{ 0 };
+            std::atomic<bool> is_scheduled_{ false };
+            Protocol::PacketClass lane_ = Protocol::PacketClass::CHAT;
+            bool has_lane_ = false;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
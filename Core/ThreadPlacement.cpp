@@ -0,0 +1,330 @@
+#include "pch.h"
+#include "ThreadPlacement.h"
+#include "Statistics.h"
+#include "../Common/Config.h"
+
+#include <windows.h>
+#include <algorithm>
+#include <thread>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            thread_local int64_t pinned_node = -1;
+
+            std::vector<uint32_t> FilterValid(const std::vector<uint32_t>& cpus, size_t cpu_count) {
+                std::vector<uint32_t> valid;
+                for (uint32_t cpu : cpus) {
+                    if (cpu < cpu_count) {
+                        valid.push_back(cpu);
+                    }
+                }
+                return valid;
+            }
+        }
+
+        // ===== CpuTopology =====
+
+        CpuTopology::CpuTopology(std::vector<LogicalCpu> cpus) : cpus_(std::move(cpus)) {
+            std::vector<uint32_t> cores;
+            for (const LogicalCpu& cpu : cpus_) {
+                node_count_ = (std::max)(node_count_, static_cast<size_t>(cpu.node) + 1);
+                cores.push_back(cpu.core);
+            }
+            std::sort(cores.begin(), cores.end());
+            core_count_ = static_cast<size_t>(std::unique(cores.begin(), cores.end()) - cores.begin());
+        }
+
+        CpuTopology CpuTopology::Detect() {
+            std::vector<LogicalCpu> cpus;
+
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+            std::vector<char> buffer(length);
+            if (length != 0 && GetLogicalProcessorInformationEx(RelationAll,
+                reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length)) {
+                //  ھ  CPU   NUMA  ũ 带 ä
+                uint32_t core_id = 0;
+                for (DWORD offset = 0; offset < length;) {
+                    auto* info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+                    if (info->Relationship == RelationProcessorCore) {
+                        const GROUP_AFFINITY& mask = info->Processor.GroupMask[0];
+                        for (uint8_t number = 0; number < 64; ++number) {
+                            if (mask.Mask & (static_cast<KAFFINITY>(1) << number)) {
+                                cpus.push_back({ mask.Group, number, 0, core_id });
+                            }
+                        }
+                        ++core_id;
+                    }
+                    offset += info->Size;
+                }
+
+                for (DWORD offset = 0; offset < length;) {
+                    auto* info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+                    if (info->Relationship == RelationNumaNode) {
+                        const GROUP_AFFINITY& mask = info->NumaNode.GroupMask;
+                        for (LogicalCpu& cpu : cpus) {
+                            if (cpu.group == mask.Group && (mask.Mask & (static_cast<KAFFINITY>(1) << cpu.number))) {
+                                cpu.node = info->NumaNode.NodeNumber;
+                            }
+                        }
+                    }
+                    offset += info->Size;
+                }
+
+                //  CPU ȣ ۾    ׷/ȣ 
+                std::sort(cpus.begin(), cpus.end(), [](const LogicalCpu& a, const LogicalCpu& b) {
+                    return a.group != b.group ? a.group < b.group : a.number < b.number;
+                });
+            }
+
+            if (cpus.empty()) {
+                const uint32_t count = (std::max)(std::thread::hardware_concurrency(), 1u);
+                for (uint32_t i = 0; i < count; ++i) {
+                    cpus.push_back({ 0, static_cast<uint8_t>(i % 64), 0, i });
+                }
+            }
+            return CpuTopology(std::move(cpus));
+        }
+
+        // ===== AffinityOptions =====
+
+        bool AffinityOptions::ParseCpuList(const std::string& text, std::vector<uint32_t>& out_cpus) {
+            out_cpus.clear();
+
+            size_t pos = 0;
+            auto skip_spaces = [&]() {
+                while (pos < text.size() && text[pos] == ' ') {
+                    ++pos;
+                }
+            };
+            auto read_number = [&](uint32_t& out_value) {
+                skip_spaces();
+                if (pos >= text.size() || text[pos] < '0' || text[pos] > '9') {
+                    return false;
+                }
+                out_value = 0;
+                while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+                    out_value = out_value * 10 + static_cast<uint32_t>(text[pos++] - '0');
+                    if (out_value > 4096) {
+                        return false;
+                    }
+                }
+                skip_spaces();
+                return true;
+            };
+
+            skip_spaces();
+            while (pos < text.size()) {
+                uint32_t first = 0;
+                uint32_t last = 0;
+                if (!read_number(first)) {
+                    return false;
+                }
+                last = first;
+                if (pos < text.size() && text[pos] == '-') {
+                    ++pos;
+                    if (!read_number(last) || last < first) {
+                        return false;
+                    }
+                }
+                for (uint32_t cpu = first; cpu <= last; ++cpu) {
+                    out_cpus.push_back(cpu);
+                }
+
+                if (pos < text.size()) {
+                    if (text[pos] != ',') {
+                        return false;
+                    }
+                    ++pos;
+                    skip_spaces();
+                    if (pos >= text.size()) {
+                        return false; //  ǥ
+                    }
+                }
+            }
+            return true;
+        }
+
+        // ===== ThreadPlacement =====
+
+        ThreadPlacement* ThreadPlacement::instance_ = nullptr;
+        std::once_flag ThreadPlacement::init_flag_;
+
+        ThreadPlacement* ThreadPlacement::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new ThreadPlacement();
+            });
+            return instance_;
+        }
+
+        AffinityPlan ThreadPlacement::BuildPlan(const CpuTopology& topology, const AffinityOptions& options, size_t worker_count) {
+            AffinityPlan plan;
+            const std::vector<LogicalCpu>& cpus = topology.GetCpus();
+            if (!options.enabled || cpus.empty()) {
+                return plan;
+            }
+
+            // ͷƮ CPU ⺻:  0 ù  ھ (ھ  Ŀ   )
+            std::vector<uint32_t> irq_cpus = FilterValid(options.irq_cpus, cpus.size());
+            if (options.irq_cpus.empty() && topology.GetCoreCount() >= 4) {
+                const LogicalCpu* first = nullptr;
+                for (const LogicalCpu& cpu : cpus) {
+                    if (cpu.node == 0) {
+                        first = &cpu;
+                        break;
+                    }
+                }
+                for (uint32_t i = 0; first && i < cpus.size(); ++i) {
+                    if (cpus[i].core == first->core) {
+                        irq_cpus.push_back(i);
+                    }
+                }
+            }
+
+            plan.accept_cpus = options.accept_cpus.empty() ? irq_cpus : FilterValid(options.accept_cpus, cpus.size());
+            plan.admin_cpus = options.admin_cpus.empty() ? plan.accept_cpus : FilterValid(options.admin_cpus, cpus.size());
+            if (!options.worker_cpus.empty()) {
+                plan.worker_cpus = FilterValid(options.worker_cpus, cpus.size());
+                return plan;
+            }
+
+            // 庰 ͷƮ CPU  CPU  ھ ù  -> SMT   
+            auto collect = [&](bool skip_irq) {
+                std::vector<std::vector<uint32_t>> node_cpus(topology.GetNodeCount());
+                std::vector<std::vector<uint32_t>> siblings(topology.GetNodeCount());
+                std::vector<uint32_t> seen_cores;
+                for (uint32_t i = 0; i < cpus.size(); ++i) {
+                    if (skip_irq && std::find(irq_cpus.begin(), irq_cpus.end(), i) != irq_cpus.end()) {
+                        continue;
+                    }
+                    if (std::find(seen_cores.begin(), seen_cores.end(), cpus[i].core) == seen_cores.end()) {
+                        seen_cores.push_back(cpus[i].core);
+                        node_cpus[cpus[i].node].push_back(i);
+                    }
+                    else {
+                        siblings[cpus[i].node].push_back(i);
+                    }
+                }
+                std::vector<std::vector<uint32_t>> result;
+                for (size_t node = 0; node < node_cpus.size(); ++node) {
+                    node_cpus[node].insert(node_cpus[node].end(), siblings[node].begin(), siblings[node].end());
+                    if (!node_cpus[node].empty()) {
+                        result.push_back(std::move(node_cpus[node]));
+                    }
+                }
+                return result;
+            };
+
+            std::vector<std::vector<uint32_t>> nodes = collect(true);
+            if (nodes.empty()) {
+                nodes = collect(false); //  ͷƮ CPU 
+            }
+            if (worker_count == 0) {
+                for (const auto& node : nodes) {
+                    plan.worker_cpus.insert(plan.worker_cpus.end(), node.begin(), node.end());
+                }
+                return plan; // Ŀ    CPU ϳ
+            }
+
+            // Ŀ ȣ  ŭ      忡 
+            plan.worker_cpus.reserve(worker_count);
+            for (size_t i = 0; i < worker_count; ++i) {
+                const size_t node = i * nodes.size() / worker_count;
+                const size_t block_begin = (node * worker_count + nodes.size() - 1) / nodes.size();
+                const auto& node_cpus = nodes[node];
+                plan.worker_cpus.push_back(node_cpus[(i - block_begin) % node_cpus.size()]);
+            }
+            return plan;
+        }
+
+        void ThreadPlacement::Configure(const CpuTopology& topology, const AffinityOptions& options, size_t worker_count) {
+            AffinityPlan plan = BuildPlan(topology, options, worker_count);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            topology_ = topology;
+            plan_ = std::move(plan);
+            STATS_SET_GAUGE("affinity.numa_nodes", static_cast<double>(topology_.GetNodeCount()));
+            STATS_SET_GAUGE("affinity.pinned_worker_cpus", static_cast<double>(plan_.worker_cpus.size()));
+        }
+
+        void ThreadPlacement::LoadFromConfig(size_t worker_count) {
+            auto* config = Common::Config::GetInstance();
+
+            AffinityOptions options;
+            options.enabled = config->GetBool("affinity.enabled", true);
+            auto load_list = [config](const char* key, std::vector<uint32_t>& out_cpus) {
+                if (!AffinityOptions::ParseCpuList(config->GetString(key, ""), out_cpus)) {
+                    out_cpus.clear();
+                    STATS_INCREMENT("affinity.invalid_cpu_lists");
+                }
+            };
+            load_list("affinity.worker_cpus", options.worker_cpus);
+            load_list("affinity.accept_cpus", options.accept_cpus);
+            load_list("affinity.admin_cpus", options.admin_cpus);
+            load_list("affinity.irq_cpus", options.irq_cpus);
+
+            Configure(CpuTopology::Detect(), options, worker_count);
+        }
+
+        const std::vector<uint32_t>& ThreadPlacement::GetRoleCpus(ThreadRole role) const {
+            switch (role) {
+            case ThreadRole::ACCEPT: return plan_.accept_cpus;
+            case ThreadRole::ADMIN: return plan_.admin_cpus;
+            default: return plan_.worker_cpus;
+            }
+        }
+
+        bool ThreadPlacement::PinCurrentThread(ThreadRole role, size_t index) {
+            LogicalCpu cpu;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                const std::vector<uint32_t>& role_cpus = GetRoleCpus(role);
+                if (role_cpus.empty()) {
+                    return false;
+                }
+                cpu = topology_.GetCpus()[role_cpus[index % role_cpus.size()]];
+            }
+
+            GROUP_AFFINITY affinity;
+            ZeroMemory(&affinity, sizeof(affinity));
+            affinity.Group = cpu.group;
+            affinity.Mask = static_cast<KAFFINITY>(1) << cpu.number;
+            if (!SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr)) {
+                STATS_INCREMENT("affinity.pin_failures");
+                return false;
+            }
+            pinned_node = cpu.node;
+            return true;
+        }
+
+        size_t ThreadPlacement::GetNodeCount() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return topology_.GetNodeCount();
+        }
+
+        uint32_t ThreadPlacement::GetWorkerNode(size_t index) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (plan_.worker_cpus.empty()) {
+                return 0;
+            }
+            return topology_.GetCpus()[plan_.worker_cpus[index % plan_.worker_cpus.size()]].node;
+        }
+
+        uint32_t ThreadPlacement::GetCurrentNode() {
+            if (pinned_node >= 0) {
+                return static_cast<uint32_t>(pinned_node);
+            }
+
+            PROCESSOR_NUMBER number;
+            USHORT node = 0;
+            GetCurrentProcessorNumberEx(&number);
+            if (!GetNumaProcessorNodeEx(&number, &node)) {
+                return 0;
+            }
+            return node;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
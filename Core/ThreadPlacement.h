@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace NexusCore {
+    namespace Core {
+
+        //  CPU ϳ (Windows μ ׷ )
+        struct LogicalCpu {
+            uint16_t group = 0;  // μ ׷
+            uint8_t number = 0;  // ׷  ȣ (0~63)
+            uint32_t node = 0;   // NUMA 
+            uint32_t core = 0;   //  ھ ( ̸ SMT )
+        };
+
+        // ý  CPU ġ. Detect    CPU ȣ ( CPU  Ű ȣ)
+        class CpuTopology {
+        public:
+            CpuTopology() = default;
+            explicit CpuTopology(std::vector<LogicalCpu> cpus);
+
+            static CpuTopology Detect(); // ˾Ƴ ϸ  ϳ hardware_concurrency
+
+            const std::vector<LogicalCpu>& GetCpus() const { return cpus_; }
+            size_t GetNodeCount() const { return node_count_; }
+            size_t GetCoreCount() const { return core_count_; }
+
+        private:
+            std::vector<LogicalCpu> cpus_;
+            size_t node_count_ = 1;
+            size_t core_count_ = 0;
+        };
+
+        enum class ThreadRole : uint8_t {
+            WORKER, // IOCP Ŀ, TaskScheduler, WorkerExecutor (Ǯ 0 ȣ)
+            ACCEPT,
+            ADMIN
+        };
+
+        //   (CPU  "0-3,8,10-11"   CPU ȣ,  ڵ)
+        struct AffinityOptions {
+            bool enabled = true;
+            std::vector<uint32_t> worker_cpus;
+            std::vector<uint32_t> accept_cpus;
+            std::vector<uint32_t> admin_cpus;
+            std::vector<uint32_t> irq_cpus; // NIC ͷƮ(RSS)  CPU. Ŀ  
+
+            static bool ParseCpuList(const std::string& text, std::vector<uint32_t>& out_cpus); //  Ʋ false
+        };
+
+        // Һ   CPU ȣ.  ִ   
+        struct AffinityPlan {
+            std::vector<uint32_t> worker_cpus; // Ŀ i worker_cpus[i % size]
+            std::vector<uint32_t> accept_cpus;
+            std::vector<uint32_t> admin_cpus;
+        };
+
+        //  CPU  NUMA ġ
+        // Ŀ 帶 ӵ ȣ   ξ   Ŀ ۾ ġ ĳø  ϰ,
+        //   ȿ  ھ ϳ  ä  SMT  . ͷƮ CPU   
+        // ھ  ̻   0 ù  ھ(RSS ⺻ μ) ͷƮ/accept/    д.
+        // Ǯ ۴  尡 ó  Ƿ    ޸𸮿 .
+        class ThreadPlacement {
+        public:
+            static ThreadPlacement* GetInstance();
+
+            static AffinityPlan BuildPlan(const CpuTopology& topology, const AffinityOptions& options, size_t worker_count);
+
+            //  Ǯ ϱ  ȣ
+            void Configure(const CpuTopology& topology, const AffinityOptions& options, size_t worker_count);
+
+            // "affinity.enabled", "affinity.worker_cpus", "affinity.accept_cpus", "affinity.admin_cpus",
+            // "affinity.irq_cpus"  Detect  Configure.   Ʋ  ׸ ڵ
+            void LoadFromConfig(size_t worker_count);
+
+            //    ȣ. ȹ ų  ϸ false ( ״ )
+            bool PinCurrentThread(ThreadRole role, size_t index);
+
+            size_t GetNodeCount() const;
+            uint32_t GetWorkerNode(size_t index) const;
+            static uint32_t GetCurrentNode(); //    CPU , ƴϸ OS ˷   
+
+        private:
+            ThreadPlacement() = default;
+            ~ThreadPlacement() = default;
+
+            const std::vector<uint32_t>& GetRoleCpus(ThreadRole role) const;
+
+            mutable std::mutex mutex_;
+            CpuTopology topology_;
+            AffinityPlan plan_;
+
+            static ThreadPlacement* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,287 @@
+#include "pch.h"
+#include "UploadJournal.h"
+#include "Statistics.h"
+
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <chrono>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            constexpr uint32_t JOURNAL_MAGIC = 0x4A55584E; // "NXUJ"
+            constexpr uint32_t JOURNAL_VERSION = 1;
+
+            void CopyField(char* dest, size_t capacity, const std::string& src) {
+                size_t length = std::min(src.size(), capacity - 1);
+                memcpy(dest, src.data(), length);
+                dest[length] = '\0';
+            }
+
+            std::string ReadField(const char* src, size_t capacity) {
+                return std::string(src, strnlen(src, capacity));
+            }
+        }
+
+#pragma pack(push, 1)
+        struct UploadJournal::JournalHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t upload_id;
+            uint64_t file_size;
+            uint32_t chunk_size;
+            uint32_t total_chunks;
+            uint32_t hashed_chunks;
+            uint32_t hash_state_size;
+            uint8_t hash_state[Common::Utils::IncrementalHash::MAX_STATE_SIZE];
+            char file_hash[72];
+            char file_name[256];
+            char sender_id[64];
+            char receiver_id[64];
+            int64_t updated_at;
+            uint8_t reserved[72]; // Ʈ 64Ʈ 迡 
+        };
+#pragma pack(pop)
+
+        UploadJournal::~UploadJournal() {
+            if (mapped_file_.IsOpen()) {
+                mapped_file_.Flush();
+            }
+        }
+
+        UploadJournal::JournalHeader* UploadJournal::GetHeader() const {
+            return reinterpret_cast<JournalHeader*>(mapped_file_.GetData());
+        }
+
+        uint8_t* UploadJournal::GetBitmap() const {
+            return reinterpret_cast<uint8_t*>(mapped_file_.GetData()) + sizeof(JournalHeader);
+        }
+
+        uint64_t UploadJournal::CalculateFileSize(uint32_t total_chunks) {
+            static_assert(sizeof(JournalHeader) % 64 == 0, "journal header must be 64-byte aligned");
+            return sizeof(JournalHeader) + (static_cast<uint64_t>(total_chunks) + 7) / 8;
+        }
+
+        std::unique_ptr<UploadJournal> UploadJournal::Create(const std::string& journal_path, const TransferMeta& meta) {
+            std::unique_ptr<UploadJournal> journal(new UploadJournal());
+
+            //      
+            std::error_code ignored;
+            std::filesystem::remove(journal_path, ignored);
+
+            if (!journal->mapped_file_.Open(journal_path, CalculateFileSize(meta.total_chunks))) {
+                return nullptr;
+            }
+
+            JournalHeader* header = journal->GetHeader();
+            memset(header, 0, sizeof(JournalHeader));
+            memset(journal->GetBitmap(), 0, (meta.total_chunks + 7) / 8);
+
+            header->version = JOURNAL_VERSION;
+            header->upload_id = meta.upload_id;
+            header->file_size = meta.file_size;
+            header->chunk_size = meta.chunk_size;
+            header->total_chunks = meta.total_chunks;
+            CopyField(header->file_hash, sizeof(header->file_hash), meta.file_hash);
+            CopyField(header->file_name, sizeof(header->file_name), meta.file_name);
+            CopyField(header->sender_id, sizeof(header->sender_id), meta.sender_id);
+            CopyField(header->receiver_id, sizeof(header->receiver_id), meta.receiver_id);
+
+            // magic   (߰  ȿ  η )
+            header->magic = JOURNAL_MAGIC;
+
+            journal->meta_ = meta;
+            return journal;
+        }
+
+        std::unique_ptr<UploadJournal> UploadJournal::Open(const std::string& journal_path) {
+            std::unique_ptr<UploadJournal> journal(new UploadJournal());
+            if (!journal->mapped_file_.Open(journal_path)) {
+                return nullptr;
+            }
+            if (journal->mapped_file_.GetSize() < sizeof(JournalHeader)) {
+                return nullptr;
+            }
+
+            const JournalHeader* header = journal->GetHeader();
+            if (header->magic != JOURNAL_MAGIC || header->version != JOURNAL_VERSION ||
+                journal->mapped_file_.GetSize() < CalculateFileSize(header->total_chunks)) {
+                return nullptr;
+            }
+
+            TransferMeta& meta = journal->meta_;
+            meta.upload_id = header->upload_id;
+            meta.file_size = header->file_size;
+            meta.chunk_size = header->chunk_size;
+            meta.total_chunks = header->total_chunks;
+            meta.file_hash = ReadField(header->file_hash, sizeof(header->file_hash));
+            meta.file_name = ReadField(header->file_name, sizeof(header->file_name));
+            meta.sender_id = ReadField(header->sender_id, sizeof(header->sender_id));
+            meta.receiver_id = ReadField(header->receiver_id, sizeof(header->receiver_id));
+
+            const uint8_t* bitmap = journal->GetBitmap();
+            for (uint32_t i = 0; i < meta.total_chunks; ++i) {
+                if (bitmap[i / 8] & (1u << (i % 8))) {
+                    ++journal->received_count_;
+                }
+            }
+            return journal;
+        }
+
+        std::vector<std::string> UploadJournal::FindJournals(const std::string& directory) {
+            std::vector<std::string> paths;
+            std::error_code error;
+            for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+                if (entry.is_regular_file(error) && entry.path().extension() == ".journal") {
+                    paths.push_back(entry.path().string());
+                }
+            }
+            return paths;
+        }
+
+        void UploadJournal::MarkChunkReceived(uint32_t chunk_index) {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            if (chunk_index >= meta_.total_chunks) return;
+
+            uint8_t& byte = GetBitmap()[chunk_index / 8];
+            const uint8_t mask = static_cast<uint8_t>(1u << (chunk_index % 8));
+            if ((byte & mask) == 0) {
+                byte |= mask;
+                ++received_count_;
+            }
+        }
+
+        void UploadJournal::ClearChunk(uint32_t chunk_index) {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            if (chunk_index >= meta_.total_chunks) return;
+
+            uint8_t& byte = GetBitmap()[chunk_index / 8];
+            const uint8_t mask = static_cast<uint8_t>(1u << (chunk_index % 8));
+            if (byte & mask) {
+                byte &= static_cast<uint8_t>(~mask);
+                --received_count_;
+            }
+        }
+
+        bool UploadJournal::IsChunkReceived(uint32_t chunk_index) const {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            if (chunk_index >= meta_.total_chunks) return false;
+            return (GetBitmap()[chunk_index / 8] & (1u << (chunk_index % 8))) != 0;
+        }
+
+        uint32_t UploadJournal::GetReceivedCount() const {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            return received_count_;
+        }
+
+        std::vector<UploadJournal::ChunkRange> UploadJournal::GetMissingRanges() const {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+
+            std::vector<ChunkRange> ranges;
+            const uint8_t* bitmap = GetBitmap();
+            uint32_t index = 0;
+            while (index < meta_.total_chunks) {
+                //   Ʈ ǳʶ
+                if ((index % 8) == 0 && bitmap[index / 8] == 0xFF) {
+                    index += 8;
+                    continue;
+                }
+                if (bitmap[index / 8] & (1u << (index % 8))) {
+                    ++index;
+                    continue;
+                }
+
+                ChunkRange range{ index, 0 };
+                while (index < meta_.total_chunks && (bitmap[index / 8] & (1u << (index % 8))) == 0) {
+                    ++range.count;
+                    ++index;
+                }
+                ranges.push_back(range);
+            }
+            return ranges;
+        }
+
+        void UploadJournal::SaveHashProgress(const Common::Utils::ChunkHashVerifier& verifier) {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+
+            JournalHeader* header = GetHeader();
+            uint8_t state[Common::Utils::IncrementalHash::MAX_STATE_SIZE];
+            size_t state_size = verifier.ExportProgress(state);
+
+            // ¸   ûũ  ߿  (ũ/ûũ  ߳   źε)
+            header->hash_state_size = 0;
+            memcpy(header->hash_state, state, state_size);
+            header->hash_state_size = static_cast<uint32_t>(state_size);
+            header->hashed_chunks = verifier.GetNextExpectedChunk();
+            header->updated_at = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        std::unique_ptr<Common::Utils::ChunkHashVerifier> UploadJournal::RestoreVerifier(
+            const std::string& temp_file_path, uint32_t reorder_window) {
+            Common::Utils::HashAlgorithm algorithm;
+            if (!Common::Utils::IncrementalHash::DetectAlgorithm(meta_.file_hash, algorithm)) {
+                return nullptr;
+            }
+
+            auto verifier = std::make_unique<Common::Utils::ChunkHashVerifier>(
+                algorithm, meta_.file_hash, meta_.total_chunks, reorder_window);
+
+            uint32_t hashed_chunks = 0;
+            {
+                std::lock_guard<std::mutex> lock(journal_mutex_);
+                const JournalHeader* header = GetHeader();
+                hashed_chunks = header->hashed_chunks;
+                const uint64_t hashed_bytes = std::min<uint64_t>(
+                    static_cast<uint64_t>(hashed_chunks) * meta_.chunk_size, meta_.file_size);
+                if (hashed_chunks > meta_.total_chunks || header->hash_state_size > sizeof(header->hash_state) ||
+                    !verifier->RestoreProgress(hashed_chunks, hashed_bytes, header->hash_state, header->hash_state_size)) {
+                    // ° ջǾų ûũ  ߳ (  )  ûũ ó ٽ ؽ
+                    STATS_INCREMENT("file.journal_hash_reset");
+                    hashed_chunks = 0;
+                }
+            }
+
+            // ؽ  Ŀ ̹ ϵ ûũ ٽ о ⿡ ä
+            std::ifstream temp_file(temp_file_path, std::ios::binary);
+            std::vector<char> chunk(meta_.chunk_size);
+            for (uint32_t index = hashed_chunks; index < meta_.total_chunks; ++index) {
+                if (!IsChunkReceived(index)) {
+                    continue;
+                }
+
+                const uint64_t offset = static_cast<uint64_t>(index) * meta_.chunk_size;
+                const size_t length = static_cast<size_t>(std::min<uint64_t>(meta_.chunk_size, meta_.file_size - offset));
+
+                temp_file.clear();
+                temp_file.seekg(static_cast<std::streamoff>(offset));
+                if (!temp_file.read(chunk.data(), static_cast<std::streamsize>(length)) ||
+                    verifier->SubmitChunk(index, chunk.data(), length) !=
+                    Common::Utils::ChunkHashVerifier::SubmitResult::ACCEPTED) {
+                    ClearChunk(index); // ٽ ޾ƾ 
+                }
+            }
+
+            SaveHashProgress(*verifier);
+            return verifier;
+        }
+
+        void UploadJournal::Flush(bool wait) {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            mapped_file_.Flush(wait);
+        }
+
+        void UploadJournal::Remove() {
+            std::lock_guard<std::mutex> lock(journal_mutex_);
+            const std::string path = mapped_file_.GetPath();
+            mapped_file_.Close();
+
+            std::error_code ignored;
+            std::filesystem::remove(path, ignored);
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "../Common/MappedFile.h"
+#include "../Common/HashContext.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        // ε ̾ޱ  (ӽ   "<temp>.journal")
+        //  + ûũ  Ʈ ޸  ΰ, ûũ   Ʈ ϳ ؽ ¸ Ѵ.
+        //   Ǿ ε  OS  ĳÿ Ƿ   ״ ȴ.
+        class UploadJournal {
+        public:
+            struct TransferMeta {
+                uint64_t upload_id = 0;
+                std::string file_name;
+                uint64_t file_size = 0;
+                std::string file_hash;
+                std::string sender_id;
+                std::string receiver_id;
+                uint32_t chunk_size = 0;
+                uint32_t total_chunks = 0;
+            };
+
+            //     ûũ 
+            struct ChunkRange {
+                uint32_t first;
+                uint32_t count;
+            };
+
+            ~UploadJournal();
+
+            static std::unique_ptr<UploadJournal> Create(const std::string& journal_path, const TransferMeta& meta);
+            static std::unique_ptr<UploadJournal> Open(const std::string& journal_path);
+
+            static std::string GetJournalPath(const std::string& temp_file_path) { return temp_file_path + ".journal"; }
+            static std::vector<std::string> FindJournals(const std::string& directory);
+
+            // ûũ Ʈ (ûũ ͸ ӽ Ͽ   ȣ)
+            void MarkChunkReceived(uint32_t chunk_index);
+            void ClearChunk(uint32_t chunk_index);
+            bool IsChunkReceived(uint32_t chunk_index) const;
+            uint32_t GetReceivedCount() const;
+            bool IsAllReceived() const { return GetReceivedCount() == meta_.total_chunks; }
+            std::vector<ChunkRange> GetMissingRanges() const;
+
+            //  ؽÿ ݿ  ؽ  
+            void SaveHashProgress(const Common::Utils::ChunkHashVerifier& verifier);
+
+            //  ؽ ¿  . ؽ  Ŀ ̹  ûũ ӽ Ͽ ٽ о
+            //  쿡 ä, 츦 Ѵ ûũ ̼ ǵ.
+            std::unique_ptr<Common::Utils::ChunkHashVerifier> RestoreVerifier(const std::string& temp_file_path,
+                uint32_t reorder_window = Common::Utils::ChunkHashVerifier::DEFAULT_REORDER_WINDOW);
+
+            const TransferMeta& GetMeta() const { return meta_; }
+            const std::string& GetPath() const { return mapped_file_.GetPath(); }
+
+            void Flush(bool wait = false);
+            void Remove(); // ε Ϸ/   
+
+        private:
+            UploadJournal() = default;
+
+            struct JournalHeader;
+            JournalHeader* GetHeader() const;
+            uint8_t* GetBitmap() const;
+            static uint64_t CalculateFileSize(uint32_t total_chunks);
+
+            mutable std::mutex journal_mutex_;
+            Common::MappedFile mapped_file_;
+            TransferMeta meta_;
+            uint32_t received_count_ = 0;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,65 @@
+#include "pch.h"
+#include "UserIdInterner.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        UserIdInterner* UserIdInterner::instance_ = nullptr;
+        std::once_flag UserIdInterner::init_flag_;
+
+        UserIdInterner* UserIdInterner::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new UserIdInterner();
+            });
+            return instance_;
+        }
+
+        UserIdInterner::UserIdInterner() {
+            InitializeSRWLock(&lock_);
+        }
+
+        UserIdInterner::~UserIdInterner() = default;
+
+        UserHandle UserIdInterner::Intern(const std::string& user_id) {
+            UserHandle handle = Find(user_id);
+            if (handle != INVALID_USER_HANDLE) {
+                return handle;
+            }
+
+            AcquireSRWLockExclusive(&lock_);
+            auto result = handles_.emplace(user_id, static_cast<UserHandle>(user_ids_.size() + 1));
+            if (result.second) {
+                user_ids_.push_back(user_id);
+            }
+            handle = result.first->second;
+            ReleaseSRWLockExclusive(&lock_);
+            return handle;
+        }
+
+        UserHandle UserIdInterner::Find(const std::string& user_id) const {
+            AcquireSRWLockShared(&lock_);
+            auto it = handles_.find(user_id);
+            UserHandle handle = (it != handles_.end()) ? it->second : INVALID_USER_HANDLE;
+            ReleaseSRWLockShared(&lock_);
+            return handle;
+        }
+
+        std::string UserIdInterner::GetUserId(UserHandle handle) const {
+            std::string user_id;
+            AcquireSRWLockShared(&lock_);
+            if (handle != INVALID_USER_HANDLE && handle <= user_ids_.size()) {
+                user_id = user_ids_[handle - 1];
+            }
+            ReleaseSRWLockShared(&lock_);
+            return user_id;
+        }
+
+        size_t UserIdInterner::GetCount() const {
+            AcquireSRWLockShared(&lock_);
+            size_t count = user_ids_.size();
+            ReleaseSRWLockShared(&lock_);
+            return count;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <winsock2.h>
+#include <cstdint>
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <mutex>
+
+namespace NexusCore {
+    namespace Core {
+
+        // ϵ  ID.  ڿ   ִ  ׻  
+        using UserHandle = uint32_t;
+        constexpr UserHandle INVALID_USER_HANDLE = 0;
+
+        //  ID ڿ ->  ڵ
+        //   ӼӸ/  ȸ ڿ    Ű ã Ѵ.
+        // ڵ   (α  ִ ID ŭ þ)
+        class UserIdInterner {
+        public:
+            static UserIdInterner* GetInstance();
+
+            //   ߱
+            UserHandle Intern(const std::string& user_id);
+
+            // ߱޵   INVALID_USER_HANDLE (  )
+            UserHandle Find(const std::string& user_id) const;
+
+            std::string GetUserId(UserHandle handle) const;
+            size_t GetCount() const;
+
+        private:
+            UserIdInterner();
+            ~UserIdInterner();
+
+            mutable SRWLOCK lock_;
+            std::unordered_map<std::string, UserHandle> handles_;
+            std::deque<std::string> user_ids_; // handle - 1 ġ
+
+            static UserIdInterner* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        // Chase-Lev ۾ ġ  (Le et al. 2013 C11 ޸ )
+        //  常 Ʒ(bottom) Push/Popϰ, ٸ  (top) StealѴ.
+        // T  а   ִ ( )̾ Ѵ.
+        template<typename T>
+        class WorkStealingDeque {
+        public:
+            explicit WorkStealingDeque(int64_t initial_capacity = 256)
+                : array_(new Array(initial_capacity)) {
+                arrays_.emplace_back(array_.load(std::memory_order_relaxed));
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            //   
+            void Push(T item) {
+                const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+                const int64_t top = top_.load(std::memory_order_acquire);
+                Array* array = array_.load(std::memory_order_relaxed);
+                if (bottom - top > array->capacity - 1) {
+                    array = Grow(array, top, bottom);
+                }
+                array->Put(bottom, item);
+                std::atomic_thread_fence(std::memory_order_release);
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            //    ( ֱٿ  ͺ, ĳÿ   ɼ ŭ)
+            bool Pop(T& out) {
+                const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+                Array* array = array_.load(std::memory_order_relaxed);
+                bottom_.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t top = top_.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    bottom_.store(bottom + 1, std::memory_order_relaxed); //  
+                    return false;
+                }
+
+                out = array->Get(bottom);
+                if (top == bottom) {
+                    //  ϳ: ġ ʰ 
+                    const bool won = top_.compare_exchange_strong(top, top + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed);
+                    bottom_.store(bottom + 1, std::memory_order_relaxed);
+                    return won;
+                }
+                return true;
+            }
+
+            // ƹ  (  ͺ)
+            bool Steal(T& out) {
+                int64_t top = top_.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+                if (top >= bottom) {
+                    return false;
+                }
+
+                Array* array = array_.load(std::memory_order_acquire);
+                T item = array->Get(top);
+                if (!top_.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return false; // ٸ ̳   
+                }
+                out = item;
+                return true;
+            }
+
+            size_t GetSize() const {
+                const int64_t size = bottom_.load(std::memory_order_relaxed) - top_.load(std::memory_order_relaxed);
+                return size > 0 ? static_cast<size_t>(size) : 0;
+            }
+
+        private:
+            struct Array {
+                explicit Array(int64_t size)
+                    : capacity(size)
+                    , items(new std::atomic<T>[static_cast<size_t>(size)]) {
+                }
+
+                T Get(int64_t index) const {
+                    return items[static_cast<size_t>(index & (capacity - 1))].load(std::memory_order_relaxed);
+                }
+                void Put(int64_t index, T item) {
+                    items[static_cast<size_t>(index & (capacity - 1))].store(item, std::memory_order_relaxed);
+                }
+
+                const int64_t capacity; // 2 ŵ
+                std::unique_ptr<std::atomic<T>[]> items;
+            };
+
+            Array* Grow(Array* old_array, int64_t top, int64_t bottom) {
+                auto* array = new Array(old_array->capacity * 2);
+                for (int64_t i = top; i < bottom; ++i) {
+                    array->Put(i, old_array->Get(i));
+                }
+                //  迭 ġ  尡   Ƿ    Բ  (ũⰡ  辿̶   2 )
+                arrays_.emplace_back(array);
+                array_.store(array, std::memory_order_release);
+                return array;
+            }
+
+            alignas(64) std::atomic<int64_t> top_{ 0 };
+            alignas(64) std::atomic<int64_t> bottom_{ 0 };
+            std::atomic<Array*> array_;
+            std::vector<std::unique_ptr<Array>> arrays_; //  常 
+        };
+
+    } // namespace Core
+} // namespace NexusCore
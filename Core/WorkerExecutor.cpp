@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "WorkerExecutor.h"
+#include "ThreadPlacement.h"
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            thread_local int current_worker_index = -1;
+        }
+
+        WorkerExecutor* WorkerExecutor::instance_ = nullptr;
+        std::once_flag WorkerExecutor::init_flag_;
+
+        WorkerExecutor* WorkerExecutor::GetInstance() {
+            std::call_once(init_flag_, []() {
+                instance_ = new WorkerExecutor();
+            });
+            return instance_;
+        }
+
+        WorkerExecutor::~WorkerExecutor() {
+            Stop();
+        }
+
+        bool WorkerExecutor::Start(size_t worker_count) {
+            if (worker_count == 0 || is_running_.exchange(true)) {
+                return false;
+            }
+
+            workers_.clear();
+            for (size_t i = 0; i < worker_count; ++i) {
+                workers_.push_back(std::make_unique<Worker>());
+            }
+            for (size_t i = 0; i < worker_count; ++i) {
+                workers_[i]->thread = std::thread(&WorkerExecutor::WorkerLoop, this, i);
+            }
+            return true;
+        }
+
+        void WorkerExecutor::Stop() {
+            if (!is_running_.exchange(false)) {
+                return;
+            }
+
+            for (auto& worker : workers_) {
+                std::lock_guard<std::mutex> lock(worker->mutex);
+                worker->cv.notify_one();
+            }
+            for (auto& worker : workers_) {
+                if (worker->thread.joinable()) {
+                    worker->thread.join();
+                }
+            }
+            workers_.clear();
+        }
+
+        void WorkerExecutor::Post(size_t worker_index, Task task) {
+            if (!is_running_ || workers_.empty()) {
+                task();
+                return;
+            }
+
+            Worker& worker = *workers_[worker_index % workers_.size()];
+            bool was_empty;
+            {
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                was_empty = worker.tasks.empty();
+                worker.tasks.push_back(std::move(task));
+            }
+            if (was_empty) {
+                worker.cv.notify_one();
+            }
+        }
+
+        size_t WorkerExecutor::GetQueueDepth(size_t worker_index) const {
+            if (workers_.empty()) {
+                return 0;
+            }
+            const Worker& worker = *workers_[worker_index % workers_.size()];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            return worker.tasks.size();
+        }
+
+        int WorkerExecutor::GetCurrentWorkerIndex() {
+            return current_worker_index;
+        }
+
+        void WorkerExecutor::WorkerLoop(size_t worker_index) {
+            current_worker_index = static_cast<int>(worker_index);
+            ThreadPlacement::GetInstance()->PinCurrentThread(ThreadRole::WORKER, worker_index);
+            Worker& worker = *workers_[worker_index];
+            std::deque<Task> batch;
+
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(worker.mutex);
+                    worker.cv.wait(lock, [this, &worker]() { return !worker.tasks.empty() || !is_running_; });
+                    if (worker.tasks.empty()) {
+                        break; //  û +  ۾ 
+                    }
+                    batch.swap(worker.tasks);
+                }
+
+                //  ۾     ۿ 
+                for (auto& task : batch) {
+                    task();
+                }
+                batch.clear();
+            }
+
+            current_worker_index = -1;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace NexusCore {
+    namespace Core {
+
+        // Ŀ ۾ ť
+        // Ư Ŀ ۾   Ŀ ǰ Ѵ.  Ŀ  ۾   ǹǷ
+        //  Ŀ  (Ҿƿ  )   ٷ  ִ.
+        class WorkerExecutor {
+        public:
+            using Task = std::function<void()>;
+
+            static WorkerExecutor* GetInstance();
+
+            bool Start(size_t worker_count);
+            void Stop(); //  ۾    
+            bool IsRunning() const { return is_running_; }
+
+            // Ŀ ۾ .   ƴϸ ȣ 忡 ٷ 
+            void Post(size_t worker_index, Task task);
+
+            size_t GetWorkerCount() const { return workers_.size(); }
+            size_t GetQueueDepth(size_t worker_index) const;
+            static int GetCurrentWorkerIndex(); // Ŀ 尡 ƴϸ -1
+
+        private:
+            WorkerExecutor() = default;
+            ~WorkerExecutor();
+
+            struct Worker {
+                mutable std::mutex mutex;
+                std::condition_variable cv;
+                std::deque<Task> tasks;
+                std::thread thread;
+            };
+
+            void WorkerLoop(size_t worker_index);
+
+            std::vector<std::unique_ptr<Worker>> workers_;
+            std::atomic<bool> is_running_{ false };
+
+            static WorkerExecutor* instance_;
+            static std::once_flag init_flag_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "WorkerPoolController.h"
+#include "../Common/Config.h"
+
+#include <algorithm>
+
+namespace NexusCore {
+    namespace Core {
+
+        WorkerPoolOptions WorkerPoolOptions::LoadFromConfig(size_t default_workers) {
+            auto* config = Common::Config::GetInstance();
+
+            WorkerPoolOptions options;
+            const int min_workers = config->GetInt("worker_pool.min", static_cast<int>(default_workers));
+            const int max_workers = config->GetInt("worker_pool.max", static_cast<int>(default_workers));
+            const int interval_ms = config->GetInt("worker_pool.sample_interval_ms", static_cast<int>(options.sample_interval_ms));
+            options.min_workers = min_workers > 0 ? static_cast<size_t>(min_workers) : 1;
+            options.max_workers = max_workers > 0 ? static_cast<size_t>(max_workers) : options.min_workers;
+            options.sample_interval_ms = interval_ms > 0 ? static_cast<uint32_t>(interval_ms) : options.sample_interval_ms;
+            options.grow_utilization = config->GetDouble("worker_pool.grow_utilization", options.grow_utilization);
+            options.shrink_utilization = config->GetDouble("worker_pool.shrink_utilization", options.shrink_utilization);
+            return options;
+        }
+
+        WorkerPoolController::WorkerPoolController(const WorkerPoolOptions& options) : options_(options) {
+            options_.min_workers = (std::max)(options_.min_workers, static_cast<size_t>(1));
+            options_.max_workers = (std::max)(options_.max_workers, options_.min_workers);
+            options_.grow_utilization = (std::min)((std::max)(options_.grow_utilization, 0.0), 1.0);
+            options_.shrink_utilization = (std::min)(options_.shrink_utilization, options_.grow_utilization);
+            options_.grow_after = (std::max)(options_.grow_after, 1u);
+            options_.shrink_after = (std::max)(options_.shrink_after, 1u);
+        }
+
+        ScalingDecision WorkerPoolController::Evaluate(const WorkerPoolSample& sample) {
+            ScalingDecision decision;
+            decision.sample = sample;
+            decision.from_workers = sample.active_workers;
+            decision.to_workers = (std::min)((std::max)(sample.active_workers, options_.min_workers), options_.max_workers);
+            if (decision.to_workers != decision.from_workers) {
+                decision.action = decision.to_workers > decision.from_workers ? ScalingAction::GROW : ScalingAction::SHRINK;
+                grow_streak_ = shrink_streak_ = 0;
+                cooldown_left_ = options_.cooldown;
+                return decision;
+            }
+
+            if (cooldown_left_ > 0) {
+                --cooldown_left_; // ٲ    Ŀ  ݿǱ    ־  
+                return decision;
+            }
+
+            const bool overloaded = sample.utilization >= options_.grow_utilization ||
+                sample.queue_depth > sample.active_workers * options_.grow_queue_per_worker;
+            const bool underloaded = sample.utilization <= options_.shrink_utilization && sample.queue_depth == 0;
+            grow_streak_ = overloaded ? grow_streak_ + 1 : 0;
+            shrink_streak_ = underloaded ? shrink_streak_ + 1 : 0;
+
+            if (grow_streak_ >= options_.grow_after && sample.active_workers < options_.max_workers) {
+                const size_t step = (std::max)(sample.active_workers / 4, static_cast<size_t>(1));
+                decision.to_workers = (std::min)(sample.active_workers + step, options_.max_workers);
+                decision.action = ScalingAction::GROW;
+            }
+            else if (shrink_streak_ >= options_.shrink_after && sample.active_workers > options_.min_workers) {
+                decision.to_workers = sample.active_workers - 1;
+                decision.action = ScalingAction::SHRINK;
+            }
+            else {
+                return decision;
+            }
+
+            grow_streak_ = shrink_streak_ = 0;
+            cooldown_left_ = options_.cooldown;
+            return decision;
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace NexusCore {
+    namespace Core {
+
+        struct WorkerPoolOptions {
+            size_t min_workers = 1;
+            size_t max_workers = 1;
+            uint32_t sample_interval_ms = 1000;
+            double grow_utilization = 0.85;   // ٻ   ̸̻ ø
+            double shrink_utilization = 0.35; //  ̰  ۾  
+            size_t grow_queue_per_worker = 4; // Ŀ  ۾ ̺  ٻ   ø
+            uint32_t grow_after = 2;          //  ̸ŭ   ؾ ٲ
+            uint32_t shrink_after = 10;       // ̴    Ѻ
+            uint32_t cooldown = 3;            // ٲ  ̸ŭ  ״ 
+
+            // "worker_pool.min", "worker_pool.max", "worker_pool.sample_interval_ms", "worker_pool.grow_utilization",
+            // "worker_pool.shrink_utilization"  ä.    default_workers 
+            static WorkerPoolOptions LoadFromConfig(size_t default_workers);
+        };
+
+        //    
+        struct WorkerPoolSample {
+            size_t active_workers = 0;
+            double utilization = 0.0; // Ȱ Ŀ ۾  ð / ( x Ȱ Ŀ )
+            size_t queue_depth = 0;   //      ۾ 
+        };
+
+        enum class ScalingAction : uint8_t {
+            HOLD,
+            GROW,
+            SHRINK
+        };
+
+        struct ScalingDecision {
+            ScalingAction action = ScalingAction::HOLD;
+            size_t from_workers = 0;
+            size_t to_workers = 0;
+            WorkerPoolSample sample;
+        };
+
+        //  Ŀ  ϴ ׸ý  ( ð踦 𸣴  )
+        // ø ذ ̴  ̸  ΰ    ٿ ξ ϰ 迡
+        //  Ŀ   ʰ Ѵ. ø  Ȱ  1/4(ּ 1),   ϳ.
+        class WorkerPoolController {
+        public:
+            explicit WorkerPoolController(const WorkerPoolOptions& options = WorkerPoolOptions()); //  Ʋ ٷ
+
+            //  ϳ ݿ . Ȱ   ̸ ٷ  
+            ScalingDecision Evaluate(const WorkerPoolSample& sample);
+
+            const WorkerPoolOptions& GetOptions() const { return options_; }
+
+        private:
+            WorkerPoolOptions options_;
+            uint32_t grow_streak_ = 0;
+            uint32_t shrink_streak_ = 0;
+            uint32_t cooldown_left_ = 0;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
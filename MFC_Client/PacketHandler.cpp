@@ -1,2 +1,34 @@
 #include "pch.h"
 #include "PacketHandler.h"
+
+void PacketHandler::RegisterHandler(uint16_t packet_id, Handler handler)
+{
+	handlers_[packet_id] = std::move(handler);
+}
+
+bool PacketHandler::Dispatch(const NexusCore::Protocol::PacketHeader& header, const char* payload)
+{
+	using namespace NexusCore::Protocol;
+
+	if (header.packet_id == PacketID::ROOM_CHAT_BATCH_NTF)
+	{
+		auto it = handlers_.find(PacketID::ROOM_CHAT_NTF);
+		if (it == handlers_.end())
+		{
+			return false;
+		}
+
+		const Handler& handler = it->second;
+		return ChatBatchCodec::ForEachEntry(payload, header.payload_length,
+			[&handler](const char* notify, size_t size) { handler(notify, size); });
+	}
+
+	auto it = handlers_.find(header.packet_id);
+	if (it == handlers_.end())
+	{
+		return false;
+	}
+
+	it->second(payload, header.payload_length);
+	return true;
+}
@@ -1,5 +1,21 @@
 #pragma once
+
+#include <functional>
+#include <unordered_map>
+#include "../Common/Protocol.h"
+
+//  Ŷ ID ó Լ й
 class PacketHandler
 {
-};
+public:
+	using Handler = std::function<void(const char* payload, size_t size)>;
 
+	void RegisterHandler(uint16_t packet_id, Handler handler);
+
+	// ROOM_CHAT_BATCH_NTF ׸񸶴 ROOM_CHAT_NTF ó Լ Ǯ ϹǷ
+	// ȭ  ġ θ  ʿ䰡 .
+	bool Dispatch(const NexusCore::Protocol::PacketHeader& header, const char* payload);
+
+private:
+	std::unordered_map<uint16_t, Handler> handlers_;
+};
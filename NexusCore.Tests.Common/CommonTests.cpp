@@ -1,7 +1,16 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include "../Common/HashContext.h"
+#include "../Common/Protocol.h"
+#include "../Common/MemoryAccountant.h"
+#include "../Common/Config.h"
+#include "../Common/Utils.h"
+
+#include <filesystem>
+#include <fstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace NexusCore::Common::Utils;
 
 namespace NexusCoreTestsCommon
 {
@@ -12,5 +21,215 @@ namespace NexusCoreTestsCommon
 		TEST_METHOD(TestMethod1)
 		{
 		}
+
+		TEST_METHOD(IncrementalHashMatchesKnownDigests)
+		{
+			MD5Context md5;
+			md5.Update("a", 1);
+			md5.Update("bc", 2);
+			Assert::AreEqual(std::string("900150983cd24fb0d6963f7d28e17f72"), md5.FinalizeHex());
+
+			SHA256Context sha256;
+			sha256.Update("ab", 2);
+			sha256.Update("c", 1);
+			Assert::AreEqual(std::string("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"), sha256.FinalizeHex());
+		}
+
+		TEST_METHOD(Crc32MatchesBitwiseReference)
+		{
+			Assert::AreEqual(0xCBF43926u, CryptoUtils::CalculateCRC32("123456789", 9));
+
+			// 8Ʈ  ο  Ʈ ΰ  ̿ Ʈ   ƾ 
+			std::vector<char> data(67);
+			for (size_t i = 0; i < data.size(); ++i) {
+				data[i] = static_cast<char>(i * 37 + 11);
+			}
+			for (size_t size = 0; size <= data.size(); ++size) {
+				uint32_t expected = 0xFFFFFFFFu;
+				for (size_t i = 0; i < size; ++i) {
+					expected ^= static_cast<uint8_t>(data[i]);
+					for (int bit = 0; bit < 8; ++bit) {
+						expected = (expected >> 1) ^ (0xEDB88320u & (0u - (expected & 1u)));
+					}
+				}
+				Assert::AreEqual(~expected, CryptoUtils::CalculateCRC32(data.data(), size));
+			}
+		}
+
+		TEST_METHOD(ConfigLoadsSectionsAndFallsBackOnBadValues)
+		{
+			using namespace NexusCore::Common;
+
+			const std::filesystem::path path = std::filesystem::temp_directory_path() / "nexuscore_config_test.ini";
+			{
+				std::ofstream file(path);
+				file << "# comment\n[test_config]\nport = 9100\nratio=0.5\nbroken = 12abc\nhuge = 99999999999\n; comment\nenabled = off\nname = chat server \n";
+			}
+
+			Config* config = Config::GetInstance();
+			Assert::IsTrue(config->LoadFromFile(path.string()));
+			Assert::AreEqual(9100, config->GetInt("test_config.port", 0));
+			Assert::AreEqual(0.5, config->GetDouble("test_config.ratio", 0.0));
+			Assert::AreEqual(7, config->GetInt("test_config.broken", 7));
+			Assert::AreEqual(7, config->GetInt("test_config.huge", 7)); // int   ߶  
+			Assert::IsFalse(config->GetBool("test_config.enabled", true));
+			Assert::AreEqual(std::string("chat server"), config->GetString("test_config.name"));
+			Assert::AreEqual(std::string("fallback"), config->GetString("test_config.missing", "fallback"));
+			Assert::IsFalse(config->LoadFromFile((path.parent_path() / "nexuscore_missing.ini").string()));
+
+			std::error_code ec;
+			std::filesystem::remove(path, ec);
+		}
+
+		TEST_METHOD(ChunkHashVerifierReordersWithinWindow)
+		{
+			std::vector<char> data(10 * 1000);
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 31);
+
+			SHA256Context whole;
+			whole.Update(data.data(), data.size());
+
+			ChunkHashVerifier verifier(HashAlgorithm::SHA256, whole.FinalizeHex(), 10, 2);
+			const uint32_t order[] = { 1, 0, 3, 2, 4, 6, 5, 7, 9, 8 };
+			for (uint32_t index : order) {
+				auto result = verifier.SubmitChunk(index, data.data() + index * 1000, 1000);
+				Assert::IsTrue(result == ChunkHashVerifier::SubmitResult::ACCEPTED);
+			}
+
+			Assert::IsTrue(verifier.IsComplete());
+			Assert::IsTrue(verifier.Verify());
+			Assert::AreEqual(static_cast<size_t>(0), verifier.GetBufferedBytes());
+			Assert::IsTrue(verifier.SubmitChunk(3, data.data(), 1000) == ChunkHashVerifier::SubmitResult::DUPLICATE);
+		}
+
+		TEST_METHOD(ChunkHashVerifierRejectsChunksBeyondWindow)
+		{
+			ChunkHashVerifier verifier(HashAlgorithm::MD5, "", 100, 4);
+			Assert::IsTrue(verifier.SubmitChunk(10, "x", 1) == ChunkHashVerifier::SubmitResult::OUT_OF_WINDOW);
+			Assert::IsTrue(verifier.SubmitChunk(100, "x", 1) == ChunkHashVerifier::SubmitResult::OUT_OF_RANGE);
+		}
+
+
+		TEST_METHOD(ChunkHashVerifierRejectsTornProgress)
+		{
+			std::vector<char> data(4 * 1000);
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 17);
+
+			SHA256Context whole;
+			whole.Update(data.data(), data.size());
+			const std::string file_hash = whole.FinalizeHex();
+
+			ChunkHashVerifier source(HashAlgorithm::SHA256, file_hash, 4);
+			source.SubmitChunk(0, data.data(), 1000);
+			source.SubmitChunk(1, data.data() + 1000, 1000);
+			uint8_t state[IncrementalHash::MAX_STATE_SIZE];
+			const size_t state_size = source.ExportProgress(state);
+
+			// ûũ  ռ  (   )
+			ChunkHashVerifier torn(HashAlgorithm::SHA256, file_hash, 4);
+			Assert::IsFalse(torn.RestoreProgress(3, 3000, state, state_size));
+			Assert::AreEqual(0u, torn.GetNextExpectedChunk());
+
+			ChunkHashVerifier restored(HashAlgorithm::SHA256, file_hash, 4);
+			Assert::IsTrue(restored.RestoreProgress(2, 2000, state, state_size));
+			restored.SubmitChunk(2, data.data() + 2000, 1000);
+			restored.SubmitChunk(3, data.data() + 3000, 1000);
+			Assert::IsTrue(restored.Verify());
+		}
+		TEST_METHOD(ChatBatchCodecRoundTrip)
+		{
+			using NexusCore::Protocol::ChatBatchCodec;
+
+			const std::string first = "short";
+			const std::string second(300, 'x'); // 2Ʈ varint 
+			std::string batch;
+			ChatBatchCodec::AppendEntry(batch, first.data(), first.size());
+			ChatBatchCodec::AppendEntry(batch, second.data(), second.size());
+			Assert::AreEqual(ChatBatchCodec::GetEncodedSize(first.size()) + ChatBatchCodec::GetEncodedSize(second.size()), batch.size());
+
+			std::vector<std::string> decoded;
+			Assert::IsTrue(ChatBatchCodec::ForEachEntry(batch.data(), batch.size(),
+				[&decoded](const char* data, size_t size) { decoded.emplace_back(data, size); }));
+			Assert::AreEqual(static_cast<size_t>(2), decoded.size());
+			Assert::AreEqual(first, decoded[0]);
+			Assert::AreEqual(second, decoded[1]);
+
+			// ߸ ̷ε ź
+			Assert::IsFalse(ChatBatchCodec::ForEachEntry(batch.data(), batch.size() - 1,
+				[](const char*, size_t) {}));
+		}
+
+		TEST_METHOD(WireFormatRoundTripsFieldsAndRejectsTruncation)
+		{
+			using namespace NexusCore::Protocol;
+
+			const std::string token(20, 't');
+			const std::string response = LoginResponseCodec::Encode(true, 300, "", ErrorCode::LOGIN_QUEUED, 0, token);
+
+			uint64_t success = 0, session_id = 0, error_code = 0;
+			std::string decoded_token;
+			Assert::IsTrue(WireFormat::ForEachField(response.data(), response.size(),
+				[&](uint32_t field, uint64_t value, const char* data, size_t length) {
+					switch (field) {
+					case 1: success = value; break;
+					case 2: session_id = value; break;
+					case 4: error_code = value; break;
+					case 6: decoded_token.assign(data, length); break;
+					default: Assert::Fail(L"⺻ ʵ "); break;
+					}
+				}));
+			Assert::AreEqual(static_cast<uint64_t>(1), success);
+			Assert::AreEqual(static_cast<uint64_t>(300), session_id); // 2Ʈ varint
+			Assert::AreEqual(ErrorCode::LOGIN_QUEUED, static_cast<int32_t>(error_code));
+			Assert::AreEqual(token, decoded_token);
+
+			//  int32 10Ʈ ڵǰ ״ ǵƿ
+			std::string negative;
+			WireFormat::AppendInt32Field(negative, 4, -2);
+			Assert::AreEqual(static_cast<size_t>(11), negative.size());
+
+			// ̰  Ʈ Ѱų varint  ź
+			Assert::IsFalse(WireFormat::ForEachField(response.data(), response.size() - 1,
+				[](uint32_t, uint64_t, const char*, size_t) {}));
+			Assert::IsFalse(WireFormat::ForEachField(negative.data(), 5,
+				[](uint32_t, uint64_t, const char*, size_t) {}));
+		}
+
+		TEST_METHOD(MemoryAccountantRaisesPressureAtLimits)
+		{
+			using namespace NexusCore::Common;
+
+			MemoryAccountant* accountant = MemoryAccountant::GetInstance();
+			const size_t soft_limit = accountant->GetSoftLimit();
+			const size_t hard_limit = accountant->GetHardLimit();
+			const size_t base_usage = accountant->GetUsage();
+			accountant->SetLimits(base_usage + 1000, base_usage + 2000);
+
+			{
+				MemoryCharge charge(MemoryCategory::FILE_TRANSFER, 500);
+				Assert::IsTrue(accountant->GetPressure() == MemoryPressure::NORMAL);
+				Assert::IsFalse(accountant->ShouldRejectLogins());
+				Assert::IsFalse(accountant->ShouldShedNotification(1024 * 1024));
+
+				// Ʈ:   , ˸ ۽ и ڿԸ 
+				charge.Resize(1500);
+				Assert::IsTrue(accountant->GetPressure() == MemoryPressure::SOFT);
+				Assert::IsTrue(accountant->ShouldRejectLogins());
+				Assert::IsTrue(accountant->ShouldPauseUploads());
+				Assert::IsFalse(accountant->ShouldShedNotification(0));
+				Assert::IsTrue(accountant->ShouldShedNotification(NexusCore::Protocol::Config::MEMORY_SHED_QUEUE_BYTES));
+
+				// ű    
+				MemoryCharge moved(std::move(charge));
+				moved.Resize(2500);
+				Assert::IsTrue(accountant->GetPressure() == MemoryPressure::HARD);
+				Assert::IsTrue(accountant->ShouldShedNotification(0));
+				Assert::AreEqual(base_usage + 2500, accountant->GetUsage());
+			}
+			Assert::AreEqual(base_usage, accountant->GetUsage());
+			Assert::IsTrue(accountant->GetPressure() == MemoryPressure::NORMAL);
+
+			accountant->SetLimits(soft_limit, hard_limit);
+		}
 	};
 }
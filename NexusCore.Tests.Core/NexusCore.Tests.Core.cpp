@@ -1,10 +1,98 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include "../Core/UploadJournal.h"
+#include "../Core/ContentStore.h"
+#include "../Core/ChatHistory.h"
+#include "../Core/NotifyBatcher.h"
+#include "../Core/RoomFanout.h"
+#include "../Core/WorkerExecutor.h"
+#include "../Core/Actor.h"
+#include "../Core/EpochReclaimer.h"
+#include "../Core/UserIdInterner.h"
+#include "../Core/SlotTable.h"
+#include "../Core/StripedMap.h"
+#include "../Core/PacketAssembler.h"
+#include "../Core/SessionBufferPool.h"
+#include "../Core/TaskScheduler.h"
+#include "../Core/Coroutine.h"
+#include "../Core/SendLaneQueue.h"
+#include "../Core/RateLimiter.h"
+#include "../Core/Statistics.h"
+#include "../Core/LoginAdmission.h"
+#include "../Core/SessionResume.h"
+#include "../Core/ThreadPlacement.h"
+#include "../Core/WorkerPoolController.h"
+#include "../Core/LoopbackTransport.h"
+#include "../Core/PacketHandler.h"
+#include "../Core/Managers.h"
+#include "../Core/FileDownload.h"
+#include "../Common/Config.h"
+#include "../Common/MemoryAccountant.h"
+#include "../Common/Utils.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <thread>
+#include <unordered_map>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace NexusCore::Core;
+using namespace NexusCore::Common::Utils;
 
 namespace NexusCoreTestsCore
 {
+	namespace
+	{
+		Task<int> AddAfterDelay(int a, int b)
+		{
+			co_await Delay(std::chrono::milliseconds(2));
+			co_return a + b;
+		}
+
+		Task<int> ReturnImmediately(int value)
+		{
+			co_return value;
+		}
+
+		Task<bool> EchoMatches(int value)
+		{
+			co_return (co_await ReturnImmediately(value)) == value;
+		}
+
+		// ߴ  ķ ׻  Ʈ忡 Ǵ Ȯ
+		Task<bool> SumOnStrand(TaskStrand* strand, int* out_sum)
+		{
+			bool on_strand = TaskStrand::GetCurrent() == strand;
+			int sum = co_await AddAfterDelay(1, 2);
+			on_strand = on_strand && TaskStrand::GetCurrent() == strand;
+			co_await Yield();
+			sum += co_await ReturnImmediately(4);
+			on_strand = on_strand && TaskStrand::GetCurrent() == strand;
+			*out_sum = sum;
+			co_return on_strand;
+		}
+
+		// HEARTBEAT_REQ ̷ε带 HEARTBEAT_RES ״ 
+		class EchoHandler : public IPacketHandler {
+		public:
+			bool HandlePacket(Session* session, NexusCore::Protocol::PacketHeader* header, char* payload) override
+			{
+				std::string packet = MakeTestPacket(NexusCore::Protocol::PacketID::HEARTBEAT_RES, std::string(payload, header->payload_length));
+				return session->PostSend(packet.data(), packet.size());
+			}
+			uint16_t GetPacketId() const override { return NexusCore::Protocol::PacketID::HEARTBEAT_REQ; }
+
+			static std::string MakeTestPacket(uint16_t packet_id, const std::string& payload)
+			{
+				NexusCore::Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(payload.size()),
+					CryptoUtils::CalculateCRC32(payload.data(), payload.size()));
+				return std::string(reinterpret_cast<const char*>(&header), sizeof(header)) + payload;
+			}
+		};
+	}
+
 	TEST_CLASS(NexusCoreTestsCore)
 	{
 	public:
@@ -12,5 +100,2149 @@ namespace NexusCoreTestsCore
 		TEST_METHOD(TestMethod1)
 		{
 		}
+
+		TEST_METHOD(UploadJournalSurvivesServerKillMidTransfer)
+		{
+			const uint32_t chunk_size = 1000;
+			const uint32_t total_chunks = 50;
+			std::string data(chunk_size * total_chunks - 123, '\0');
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 13 + i / 7);
+
+			SHA256Context whole;
+			whole.Update(data.data(), data.size());
+			const std::string file_hash = whole.FinalizeHex();
+
+			const std::string temp_path = (std::filesystem::temp_directory_path() / "nexus_resume_test.tmp").string();
+			std::ofstream(temp_path, std::ios::binary | std::ios::trunc).write(std::string(data.size(), '\0').data(), data.size());
+
+			UploadJournal::TransferMeta meta;
+			meta.upload_id = 7;
+			meta.file_name = "resume.bin";
+			meta.file_size = data.size();
+			meta.file_hash = file_hash;
+			meta.sender_id = "uploader";
+			meta.chunk_size = chunk_size;
+			meta.total_chunks = total_chunks;
+
+			auto journal = UploadJournal::Create(UploadJournal::GetJournalPath(temp_path), meta);
+			Assert::IsNotNull(journal.get());
+
+			ChunkHashVerifier verifier(HashAlgorithm::SHA256, file_hash, total_chunks, 4);
+			std::fstream temp_file(temp_path, std::ios::binary | std::ios::in | std::ios::out);
+			auto receive_chunk = [&](uint32_t index) {
+				const size_t length = std::min<size_t>(chunk_size, data.size() - index * chunk_size);
+				temp_file.seekp(index * chunk_size);
+				temp_file.write(data.data() + index * chunk_size, length);
+				temp_file.flush();
+				verifier.SubmitChunk(index, data.data() + index * chunk_size, length);
+				journal->MarkChunkReceived(index);
+				journal->SaveHashProgress(verifier);
+			};
+
+			for (uint32_t i = 0; i < 20; ++i) {
+				receive_chunk(i);
+			}
+			receive_chunk(22);
+			receive_chunk(21);
+			temp_file.close();
+
+			//   :   ʰ 
+			journal.release();
+
+			auto recovered = UploadJournal::Open(UploadJournal::GetJournalPath(temp_path));
+			Assert::IsNotNull(recovered.get());
+			Assert::AreEqual(22u, recovered->GetReceivedCount());
+			Assert::AreEqual(std::string("uploader"), recovered->GetMeta().sender_id);
+
+			auto restored = recovered->RestoreVerifier(temp_path, 4);
+			Assert::IsNotNull(restored.get());
+			Assert::AreEqual(20u, restored->GetNextExpectedChunk());
+
+			auto missing = recovered->GetMissingRanges();
+			Assert::AreEqual(static_cast<size_t>(2), missing.size());
+			Assert::AreEqual(20u, missing[0].first);
+			Assert::AreEqual(1u, missing[0].count);
+			Assert::AreEqual(23u, missing[1].first);
+			Assert::AreEqual(27u, missing[1].count);
+
+			for (const auto& range : missing) {
+				for (uint32_t index = range.first; index < range.first + range.count; ++index) {
+					const size_t length = std::min<size_t>(chunk_size, data.size() - index * chunk_size);
+					restored->SubmitChunk(index, data.data() + index * chunk_size, length);
+					recovered->MarkChunkReceived(index);
+				}
+			}
+
+			Assert::IsTrue(recovered->IsAllReceived());
+			Assert::IsTrue(restored->Verify());
+
+			recovered->Remove();
+			std::filesystem::remove(temp_path);
+		}
+
+		TEST_METHOD(ContentStoreDeduplicatesAndSurvivesRestart)
+		{
+			const std::filesystem::path root = std::filesystem::temp_directory_path() / "nexus_store_test";
+			std::filesystem::remove_all(root);
+
+			const std::string content = "same attachment uploaded twice";
+			SHA256Context sha;
+			sha.Update(content.data(), content.size());
+
+			ContentStore::ContentKey key;
+			Assert::IsTrue(ContentStore::MakeKey(sha.FinalizeHex(), content.size(), key));
+
+			ContentStore* store = ContentStore::GetInstance();
+			Assert::IsTrue(store->Initialize(root.string()));
+
+			std::string stored_path;
+			Assert::IsFalse(store->AcquireExisting(key, stored_path));
+
+			const std::string temp_path = (root / "upload.tmp").string();
+			std::ofstream(temp_path, std::ios::binary) << content;
+			Assert::IsTrue(store->Commit(key, temp_path, stored_path));
+			Assert::IsFalse(std::filesystem::exists(temp_path));
+			Assert::IsTrue(std::filesystem::exists(stored_path));
+
+			//  ° ε ûũ    
+			std::string second_path;
+			Assert::IsTrue(store->AcquireExisting(key, second_path));
+			Assert::AreEqual(stored_path, second_path);
+			Assert::AreEqual(2u, store->GetRefCount(key));
+			Assert::AreEqual(static_cast<uint64_t>(content.size()), store->GetStoredBytes());
+			Assert::AreEqual(static_cast<uint64_t>(content.size() * 2), store->GetLogicalBytes());
+
+			//   ε   
+			store->Shutdown();
+			Assert::IsTrue(store->Initialize(root.string()));
+			Assert::AreEqual(2u, store->GetRefCount(key));
+
+			store->Release(key);
+			Assert::AreEqual(static_cast<size_t>(0), store->CollectGarbage(std::chrono::seconds(0)));
+			store->Release(key);
+			Assert::AreEqual(static_cast<size_t>(1), store->CollectGarbage(std::chrono::seconds(0)));
+			Assert::IsFalse(store->Contains(key));
+			Assert::IsFalse(std::filesystem::exists(stored_path));
+
+			// GC     ٽ ø  ü 
+			std::ofstream(temp_path, std::ios::binary) << content;
+			Assert::IsTrue(store->Commit(key, temp_path, stored_path));
+			Assert::IsTrue(std::filesystem::exists(stored_path));
+
+			// ũⰡ ٸ(߸) ü  ġ ʰ ׸ 
+			std::ofstream(stored_path, std::ios::binary | std::ios::trunc) << "short";
+			Assert::IsFalse(store->AcquireExisting(key, second_path));
+			Assert::IsFalse(store->Contains(key));
+
+			store->Shutdown();
+			std::filesystem::remove_all(root);
+		}
+
+		TEST_METHOD(ChatHistoryReplaysRecentMessagesAfterReopen)
+		{
+			const std::filesystem::path root = std::filesystem::temp_directory_path() / "nexus_history_test";
+			std::filesystem::remove_all(root);
+
+			ChatHistoryLog::Options options;
+			options.segment_size = 16 * 1024; // ׸Ʈ ȯ  ѵ  ũ Ȯ
+			options.max_segments = 4;
+			options.index_interval = 8;
+
+			{
+				auto history = ChatHistoryLog::Open(root.string(), 1, options);
+				Assert::IsNotNull(history.get());
+				for (int i = 1; i <= 2000; ++i) {
+					Assert::AreEqual(static_cast<uint64_t>(i),
+						history->Append("user" + std::to_string(i % 7), "message " + std::to_string(i), 0, 1000 + i));
+					if (i % 100 == 0) {
+						history->PrepareNextSegment();
+						history->RemoveRetiredSegments();
+					}
+				}
+				Assert::AreEqual(options.max_segments, history->GetSegmentCount());
+			}
+
+			auto reopened = ChatHistoryLog::Open(root.string(), 1, options);
+			Assert::IsNotNull(reopened.get());
+			Assert::AreEqual(static_cast<uint64_t>(2000), reopened->GetLastSequence());
+			Assert::IsTrue(reopened->GetFirstSequence() > 1);
+
+			auto recent = reopened->GetRecent(10);
+			Assert::AreEqual(static_cast<size_t>(10), recent.size());
+			Assert::AreEqual(static_cast<uint64_t>(1991), recent.front().sequence);
+			Assert::AreEqual(std::string("message 2000"), recent.back().message);
+			Assert::AreEqual(std::string("user5"), recent.back().sender_id);
+
+			// ð  ã   ̾ б
+			const uint64_t from = reopened->FindSequenceByTime(1000 + 1900);
+			Assert::AreEqual(static_cast<uint64_t>(1900), from);
+
+			uint64_t expected = from;
+			size_t read = reopened->ReadFrom(from, 50, [&expected](const HistoryRecordView& view) {
+				Assert::AreEqual(expected++, view.sequence);
+			});
+			Assert::AreEqual(static_cast<size_t>(50), read);
+
+			Assert::AreEqual(static_cast<uint64_t>(2001), reopened->Append("late", "after reopen", 0, 5000));
+
+			reopened.reset();
+			std::filesystem::remove_all(root);
+		}
+
+		TEST_METHOD(ChatRoomKeepsHistoryAfterManagerClosesIt)
+		{
+			const std::filesystem::path root = std::filesystem::temp_directory_path() / "nexus_room_history_test";
+			std::filesystem::remove_all(root);
+
+			ChatHistoryManager* manager = ChatHistoryManager::GetInstance();
+			Assert::IsTrue(manager->Start(root.string()));
+			{
+				//   ڰ      
+				ChatRoom room(77, "history");
+				Assert::IsNotNull(room.GetHistory());
+				Assert::AreEqual(static_cast<uint64_t>(1), room.RecordMessage("alice", "hello", 0, 1000));
+
+				// ڰ  ݾƵ   
+				manager->CloseRoomHistory(77);
+				Assert::AreEqual(static_cast<size_t>(0), manager->GetOpenLogCount());
+				Assert::AreEqual(static_cast<uint64_t>(2), room.RecordMessage("bob", "still here", 0, 1001));
+				Assert::AreEqual(static_cast<uint64_t>(2), room.GetHistory()->GetLastSequence());
+
+				//  ϵ  ϴ  ÷ 尡  
+				std::this_thread::sleep_for(std::chrono::milliseconds(NexusCore::Protocol::Config::HISTORY_FLUSH_INTERVAL_MS * 3));
+				Assert::AreEqual(static_cast<size_t>(1), manager->GetClosingLogCount());
+			}
+
+			//     ÷  Ͽ 
+			for (int i = 0; i < 100 && manager->GetClosingLogCount() != 0; ++i) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(NexusCore::Protocol::Config::HISTORY_FLUSH_INTERVAL_MS));
+			}
+			Assert::AreEqual(static_cast<size_t>(0), manager->GetClosingLogCount());
+			manager->Stop();
+
+			auto reopened = ChatHistoryLog::Open((root / "room_77").string(), 77);
+			Assert::AreEqual(static_cast<uint64_t>(2), reopened->GetLastSequence());
+			Assert::AreEqual(std::string("still here"), reopened->GetRecent(1).back().message);
+
+			reopened.reset();
+			std::filesystem::remove_all(root);
+		}
+
+		TEST_METHOD(NotifyBatcherSendsQuietMessagesImmediatelyAndBatchesBursts)
+		{
+			NotifyBatcher::Options options;
+			options.window_ms = 60 * 1000; // ð  ׽Ʈ  ȣ
+			options.max_messages = 4;
+
+			std::vector<NotifyBatcher::Batch> flushed;
+			NotifyBatcher batcher(options, [&flushed](const NotifyBatcher::Batch& batch) { flushed.push_back(batch); });
+
+			Session* sender = reinterpret_cast<Session*>(0x1000);
+			Session* listener = reinterpret_cast<Session*>(0x2000);
+
+			//   ù ޽ ٷ 
+			Assert::IsTrue(batcher.Add("m0", 2, sender) == NotifyBatcher::AddResult::SEND_NOW);
+
+			// ̾ ޽ Ҵٰ ѵ   
+			for (int i = 1; i <= 4; ++i) {
+				std::string message = "m" + std::to_string(i);
+				Session* from = (i == 2) ? sender : nullptr;
+				Assert::IsTrue(batcher.Add(message.data(), message.size(), from) == NotifyBatcher::AddResult::QUEUED);
+			}
+			Assert::AreEqual(static_cast<size_t>(1), flushed.size());
+			Assert::IsFalse(batcher.HasPending());
+
+			std::string scratch;
+			std::vector<std::string> seen;
+			auto collect = [&seen](const char* data, size_t size) { seen.emplace_back(data, size); };
+
+			const std::string& for_listener = NotifyBatcher::GetPayloadFor(flushed[0], listener, scratch);
+			NexusCore::Protocol::ChatBatchCodec::ForEachEntry(for_listener.data(), for_listener.size(), collect);
+			Assert::AreEqual(static_cast<size_t>(4), seen.size());
+
+			//   ڱ ޽  
+			seen.clear();
+			const std::string& for_sender = NotifyBatcher::GetPayloadFor(flushed[0], sender, scratch);
+			NexusCore::Protocol::ChatBatchCodec::ForEachEntry(for_sender.data(), for_sender.size(), collect);
+			Assert::AreEqual(static_cast<size_t>(3), seen.size());
+			Assert::AreEqual(std::string("m3"), seen[1]);
+
+			//  ð   ġ 
+			Assert::IsTrue(batcher.Add("m5", 2, nullptr) == NotifyBatcher::AddResult::QUEUED);
+			Assert::IsFalse(batcher.FlushIfDue(NotifyBatcher::Clock::now()));
+			Assert::IsTrue(batcher.FlushIfDue(NotifyBatcher::Clock::now() + std::chrono::minutes(2)));
+			Assert::AreEqual(static_cast<size_t>(2), flushed.size());
+			Assert::AreEqual(static_cast<size_t>(1), flushed[1].entries.size());
+		}
+
+		TEST_METHOD(ChatRoomBatchesNotifiesOnSchedulerAndSurvivesToggling)
+		{
+			std::atomic<size_t> single_packets{ 0 };
+			std::atomic<size_t> batch_packets{ 0 };
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t, const NexusCore::Protocol::PacketHeader& header, const char*) {
+					if (header.packet_id == NexusCore::Protocol::PacketID::ROOM_CHAT_NTF) ++single_packets;
+					if (header.packet_id == NexusCore::Protocol::PacketID::ROOM_CHAT_BATCH_NTF) ++batch_packets;
+				});
+				Session::SetTransport(&transport);
+
+				auto room = std::make_unique<ChatRoom>(31, "batch");
+				std::vector<uint64_t> session_ids;
+				for (int i = 0; i < 3; ++i) {
+					const uint64_t session_id = transport.Connect();
+					session_ids.push_back(session_id);
+					EpochGuard guard;
+					Assert::IsTrue(room->Enter(SessionManager::GetInstance()->FindSession(session_id)));
+				}
+
+				NotifyBatcher::Options options;
+				options.window_ms = 20;
+				room->EnableNotifyBatching(options);
+
+				//   ù ˸ ٷ, ̾ ˸ ٷ  ð ڿ ġ
+				room->BroadcastChatNotify("m0", 2);
+				Assert::AreEqual(static_cast<size_t>(3), single_packets.load());
+				room->BroadcastChatNotify("m1", 2);
+				room->BroadcastChatNotify("m2", 2);
+				const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				while (batch_packets < 3 && std::chrono::steady_clock::now() < deadline) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				Assert::AreEqual(static_cast<size_t>(3), batch_packets.load());
+
+				//  ߿ Ѱ  ó  Բ 
+				std::atomic<bool> stop{ false };
+				std::thread toggler([&]() {
+					while (!stop) {
+						room->DisableNotifyBatching();
+						room->EnableNotifyBatching(options);
+					}
+				});
+				for (int i = 0; i < 2000; ++i) {
+					room->BroadcastChatNotify("mx", 2);
+				}
+				stop = true;
+				toggler.join();
+				room->DisableNotifyBatching();
+				Assert::IsFalse(room->IsNotifyBatching());
+
+				room.reset();
+				for (uint64_t session_id : session_ids) {
+					transport.Close(session_id);
+				}
+			}
+			Session::SetTransport(nullptr);
+		}
+
+		TEST_METHOD(LargeRoomSendsBatchesThroughShardsWithoutOwnMessages)
+		{
+			WorkerExecutor* executor = WorkerExecutor::GetInstance();
+			Assert::IsTrue(executor->Start(2));
+			{
+				std::mutex mutex;
+				std::unordered_map<uint64_t, std::vector<size_t>> batches; // Ǻ  ġ ׸ 
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t session_id, const NexusCore::Protocol::PacketHeader& header, const char* payload) {
+					if (header.packet_id != NexusCore::Protocol::PacketID::ROOM_CHAT_BATCH_NTF) {
+						return;
+					}
+					size_t entries = 0;
+					NexusCore::Protocol::ChatBatchCodec::ForEachEntry(payload, header.payload_length,
+						[&entries](const char*, size_t) { ++entries; });
+					std::lock_guard<std::mutex> lock(mutex);
+					batches[session_id].push_back(entries);
+				});
+				Session::SetTransport(&transport);
+
+				auto room = std::make_unique<ChatRoom>(35, "large batch");
+				room->EnableLargeRoomMode();
+				Assert::IsTrue(room->IsLargeRoom());
+				Assert::IsFalse(room->IsNotifyBatching()); //   尡 ġ  
+
+				std::vector<uint64_t> session_ids;
+				std::vector<Session*> sessions;
+				for (int i = 0; i < 3; ++i) {
+					session_ids.push_back(transport.Connect());
+					EpochGuard guard;
+					sessions.push_back(SessionManager::GetInstance()->FindSession(session_ids.back()));
+					Assert::IsTrue(room->Enter(sessions.back()));
+				}
+
+				NotifyBatcher::Options options;
+				options.window_ms = 20;
+				room->EnableNotifyBatching(options);
+
+				// ù ˸ ٷ, ̾  ġ.   ڱ ޽  ġ 
+				room->BroadcastChatNotify("m0", 2);
+				room->BroadcastChatNotify("m1", 2, sessions[0]);
+				room->BroadcastChatNotify("m2", 2);
+				const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				for (;;) {
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						if (batches.size() == 3) {
+							break;
+						}
+					}
+					Assert::IsTrue(std::chrono::steady_clock::now() < deadline);
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					Assert::IsTrue(batches[session_ids[0]] == std::vector<size_t>{ 1 });
+					Assert::IsTrue(batches[session_ids[1]] == std::vector<size_t>{ 2 });
+					Assert::IsTrue(batches[session_ids[2]] == std::vector<size_t>{ 2 });
+				}
+
+				for (Session* session : sessions) {
+					room->Leave(session);
+				}
+				room.reset();
+				for (uint64_t session_id : session_ids) {
+					transport.Close(session_id);
+				}
+			}
+			Session::SetTransport(nullptr);
+			executor->Stop();
+		}
+
+		TEST_METHOD(LargeRoomTracksParticipantsWithoutSnapshots)
+		{
+			WorkerExecutor* executor = WorkerExecutor::GetInstance();
+			Assert::IsTrue(executor->Start(2));
+			{
+				LoopbackTransport transport;
+				Session::SetTransport(&transport);
+				std::vector<uint64_t> session_ids;
+				for (int i = 0; i < 3; ++i) {
+					session_ids.push_back(transport.Connect());
+				}
+
+				for (bool actor_mode : { false, true }) {
+					ChatRoom room(34, "large");
+					if (actor_mode) {
+						room.EnableActorMode();
+					}
+					room.EnableLargeRoomMode();
+
+					std::vector<Session*> sessions;
+					{
+						EpochGuard guard;
+						for (uint64_t session_id : session_ids) {
+							sessions.push_back(SessionManager::GetInstance()->FindSession(session_id));
+						}
+					}
+					for (Session* session : sessions) {
+						Assert::IsTrue(room.Enter(session));
+					}
+
+					//  ̵ ο// ȸ   ¸ 
+					Assert::AreEqual(static_cast<size_t>(3), room.GetParticipantCount());
+					Assert::AreEqual(static_cast<size_t>(3), room.GetParticipantIds().size());
+					Assert::IsTrue(room.IsUserInRoom(sessions[0]->GetUserId()));
+
+					for (Session* session : sessions) {
+						room.Leave(session);
+					}
+					if (actor_mode) { //  ޽ ó 
+						std::promise<void> drained;
+						room.Post([&drained]() { drained.set_value(); });
+						drained.get_future().get();
+					}
+					Assert::AreEqual(static_cast<size_t>(0), room.GetParticipantCount());
+					Assert::IsTrue(room.GetParticipantIds().empty());
+					Assert::IsFalse(room.IsUserInRoom(sessions[0]->GetUserId()));
+				}
+
+				for (uint64_t session_id : session_ids) {
+					transport.Close(session_id);
+				}
+			}
+			Session::SetTransport(nullptr);
+			executor->Stop();
+		}
+
+		TEST_METHOD(RoomFanoutDeliversAcrossWorkerShards)
+		{
+			WorkerExecutor* executor = WorkerExecutor::GetInstance();
+			Assert::IsTrue(executor->Start(4));
+
+			std::atomic<size_t> deliveries{ 0 };
+			RoomFanout fanout(7, 0, [&deliveries](Session*, const RoomFanout::SharedPacket& packet) {
+				Assert::AreEqual(static_cast<size_t>(3), packet->size());
+				++deliveries;
+			});
+			Assert::AreEqual(static_cast<size_t>(4), fanout.GetShardCount());
+
+			std::vector<Session*> members;
+			for (uintptr_t i = 1; i <= 10000; ++i) {
+				members.push_back(reinterpret_cast<Session*>(i * 64));
+				fanout.AddMember(members.back());
+			}
+			for (size_t i = 0; i < 1000; ++i) {
+				fanout.RemoveMember(members[i]);
+			}
+			Assert::AreEqual(static_cast<size_t>(9000), fanout.GetMemberCount());
+
+			auto packet = std::make_shared<const std::vector<char>>(3, 'x');
+			std::promise<size_t> done;
+			fanout.Broadcast(packet, members.back(), [&done](size_t delivered) { done.set_value(delivered); });
+
+			//   Ŀ  ̹Ƿ 帶   ݿ
+			Assert::AreEqual(static_cast<size_t>(8999), done.get_future().get());
+			Assert::AreEqual(static_cast<size_t>(8999), deliveries.load());
+
+			// и  ڿ   RunAfterRemoval     ۹  (  )
+			Session* removed = members[5000];
+			std::atomic<bool> is_retired{ false };
+			std::atomic<size_t> late_deliveries{ 0 };
+			RoomFanout tracked(8, 0, [&](Session* session, const RoomFanout::SharedPacket&) {
+				if (session == removed && is_retired) {
+					++late_deliveries;
+				}
+			});
+			for (Session* member : members) {
+				tracked.AddMember(member);
+			}
+			for (int i = 0; i < 20; ++i) {
+				tracked.Broadcast(packet);
+			}
+			tracked.RemoveMember(removed);
+			tracked.RunAfterRemoval(removed, [&is_retired]() { is_retired = true; });
+			std::promise<size_t> last;
+			tracked.Broadcast(packet, nullptr, [&last](size_t delivered) { last.set_value(delivered); });
+			Assert::AreEqual(static_cast<size_t>(9999), last.get_future().get());
+			Assert::IsTrue(is_retired.load());
+			Assert::AreEqual(static_cast<size_t>(0), late_deliveries.load());
+
+			executor->Stop();
+		}
+
+		TEST_METHOD(ActorProcessesMessagesInOrderWithoutLocks)
+		{
+			WorkerExecutor* executor = WorkerExecutor::GetInstance();
+			Assert::IsTrue(executor->Start(4));
+
+			const int producer_count = 4;
+			const int messages_per_producer = 20000;
+
+			{
+				Actor actor(1);
+				uint64_t total = 0; //  ȿ 
+				std::vector<int> last_seen(producer_count, -1);
+				bool in_order = true;
+
+				std::vector<std::thread> producers;
+				for (int p = 0; p < producer_count; ++p) {
+					producers.emplace_back([&, p]() {
+						for (int i = 0; i < messages_per_producer; ++i) {
+							actor.Tell([&, p, i]() {
+								in_order = in_order && (last_seen[p] == i - 1);
+								last_seen[p] = i;
+								++total;
+							});
+						}
+					});
+				}
+				for (auto& producer : producers) {
+					producer.join();
+				}
+
+				uint64_t observed = actor.Ask([&total]() { return total; });
+				Assert::AreEqual(static_cast<uint64_t>(producer_count * messages_per_producer), observed);
+				Assert::IsTrue(actor.Ask([&in_order]() { return in_order; }));
+				Assert::AreEqual(static_cast<size_t>(0), actor.GetPendingCount());
+
+				//  ޽ ȿ IsInsideActor (Ask ø ˻ )
+				Assert::IsFalse(Actor::IsInsideActor());
+				Assert::IsTrue(actor.Ask([]() { return Actor::IsInsideActor(); }));
+
+				//  Ŀ Askص  ʰ,   ޽  ó
+				std::promise<uint64_t> from_home;
+				executor->Post(actor.GetHomeWorker(), [&]() {
+					actor.Tell([&total]() { total += 100; });
+					from_home.set_value(actor.Ask([&total]() { return total; }));
+				});
+				Assert::AreEqual(static_cast<uint64_t>(producer_count * messages_per_producer + 100), from_home.get_future().get());
+			}
+
+			executor->Stop();
+		}
+
+		TEST_METHOD(EpochReclaimerDefersFreeUntilReadersLeave)
+		{
+			EpochReclaimer* reclaimer = EpochReclaimer::GetInstance();
+			std::atomic<bool> freed{ false };
+
+			// д  尡 ִ ȿ   ȸص  
+			std::promise<void> entered;
+			std::promise<void> release;
+			std::thread reader([&]() {
+				EpochGuard guard;
+				entered.set_value();
+				release.get_future().wait();
+			});
+			entered.get_future().wait();
+
+			reclaimer->Retire([&freed]() { freed = true; });
+			for (int i = 0; i < 8; ++i) {
+				reclaimer->Reclaim();
+			}
+			Assert::IsFalse(freed.load());
+
+			release.set_value();
+			reader.join();
+			for (int i = 0; i < 2 && !freed; ++i) {
+				reclaimer->Reclaim();
+			}
+			Assert::IsTrue(freed.load());
+
+			// Խÿ ȸ ݺϴ  д  ׻  ִ  
+			struct Snapshot {
+				std::vector<int> values;
+				bool is_alive = true;
+				~Snapshot() { is_alive = false; }
+			};
+			std::atomic<const Snapshot*> current{ new Snapshot{ { 1, 2, 3 } } };
+			std::atomic<bool> stop{ false };
+			std::atomic<bool> saw_dead{ false };
+
+			std::vector<std::thread> readers;
+			for (int r = 0; r < 3; ++r) {
+				readers.emplace_back([&]() {
+					while (!stop) {
+						EpochGuard guard;
+						const Snapshot* snapshot = current.load(std::memory_order_acquire);
+						if (!snapshot->is_alive || snapshot->values.size() != 3) {
+							saw_dead = true;
+						}
+					}
+				});
+			}
+			for (int i = 0; i < 20000; ++i) {
+				reclaimer->Retire(current.exchange(new Snapshot{ { i, i, i } }, std::memory_order_acq_rel));
+			}
+			stop = true;
+			for (auto& thread : readers) {
+				thread.join();
+			}
+
+			Assert::IsFalse(saw_dead.load());
+
+			// д 尡  Ƿ  ü  
+			reclaimer->Retire(current.exchange(nullptr));
+			reclaimer->Reclaim();
+			reclaimer->Reclaim();
+			Assert::AreEqual(static_cast<size_t>(0), reclaimer->GetRetiredCount());
+		}
+
+		TEST_METHOD(UserIdInternerGivesStableHandles)
+		{
+			UserIdInterner* interner = UserIdInterner::GetInstance();
+
+			Assert::AreEqual(INVALID_USER_HANDLE, interner->Find("intern_test_never_seen"));
+
+			//  尡  ID ÿ ص ڵ ϳ
+			std::vector<UserHandle> handles(8);
+			std::vector<std::thread> threads;
+			for (size_t t = 0; t < handles.size(); ++t) {
+				threads.emplace_back([&handles, interner, t]() {
+					for (int i = 0; i < 1000; ++i) {
+						interner->Intern("intern_test_user" + std::to_string(i));
+					}
+					handles[t] = interner->Intern("intern_test_user0");
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+			for (UserHandle handle : handles) {
+				Assert::AreEqual(handles[0], handle);
+			}
+
+			Assert::AreNotEqual(INVALID_USER_HANDLE, handles[0]);
+			Assert::AreEqual(handles[0], interner->Find("intern_test_user0"));
+			Assert::AreNotEqual(handles[0], interner->Find("intern_test_user1"));
+			Assert::AreEqual(std::string("intern_test_user0"), interner->GetUserId(handles[0]));
+			Assert::AreEqual(std::string(), interner->GetUserId(INVALID_USER_HANDLE));
+		}
+
+		TEST_METHOD(SlotTableRejectsStaleSessionIds)
+		{
+			SlotTable<int> table(4);
+			int a = 1, b = 2;
+
+			uint64_t id_a = table.Allocate();
+			table.Publish(id_a, &a);
+			Assert::IsTrue(table.Find(id_a) == &a);
+
+			//   ٽ ᵵ  IDδ  ü ã 
+			Assert::IsTrue(table.Remove(id_a) == &a);
+			Assert::IsTrue(table.Remove(id_a) == nullptr);
+			uint64_t id_b = table.Allocate();
+			table.Publish(id_b, &b);
+			Assert::AreEqual(SlotTable<int>::GetIndex(id_a), SlotTable<int>::GetIndex(id_b));
+			Assert::AreNotEqual(id_a, id_b);
+			Assert::IsTrue(table.Find(id_a) == nullptr);
+			Assert::IsTrue(table.Find(id_b) == &b);
+
+			for (int i = 0; i < 3; ++i) {
+				Assert::AreNotEqual(SlotTable<int>::INVALID_ID, table.Allocate());
+			}
+			Assert::AreEqual(SlotTable<int>::INVALID_ID, table.Allocate());
+
+			// / ݺϴ  ٸ  ȸ ڱ ID ü 
+			SlotTable<uint64_t> churn(64);
+			std::vector<std::unique_ptr<uint64_t>> objects; //   ڿ (ȸ EpochReclaimer )
+			objects.reserve(20000);
+			std::atomic<uint64_t> published_id{ SlotTable<uint64_t>::INVALID_ID };
+			std::atomic<bool> stop{ false };
+			std::atomic<bool> saw_wrong{ false };
+
+			std::vector<std::thread> readers;
+			for (int r = 0; r < 3; ++r) {
+				readers.emplace_back([&]() {
+					while (!stop) {
+						uint64_t id = published_id.load();
+						uint64_t* object = churn.Find(id);
+						if (object && *object != id) {
+							saw_wrong = true;
+						}
+					}
+				});
+			}
+			for (int i = 0; i < 20000; ++i) {
+				uint64_t id = churn.Allocate();
+				objects.push_back(std::make_unique<uint64_t>(id));
+				churn.Publish(id, objects.back().get());
+				published_id = id;
+				churn.Remove(id);
+			}
+			stop = true;
+			for (auto& thread : readers) {
+				thread.join();
+			}
+			Assert::IsFalse(saw_wrong.load());
+			Assert::AreEqual(static_cast<size_t>(0), churn.GetCount());
+
+			StripedMap<std::string, uint64_t> user_sessions(8);
+			Assert::IsTrue(user_sessions.Insert("alice", 1));
+			Assert::IsFalse(user_sessions.Insert("alice", 2));
+			user_sessions.Assign("alice", 3);
+			Assert::IsFalse(user_sessions.EraseIfEqual("alice", 1)); //    
+			uint64_t found = 0;
+			Assert::IsTrue(user_sessions.Find("alice", found));
+			Assert::AreEqual(static_cast<uint64_t>(3), found);
+			Assert::IsTrue(user_sessions.EraseIfEqual("alice", 3));
+			Assert::AreEqual(static_cast<size_t>(0), user_sessions.GetSize());
+		}
+
+		TEST_METHOD(PacketAssemblerBorrowsBufferOnlyForSplitFrames)
+		{
+			SessionBufferPool* pool = SessionBufferPool::GetInstance();
+			const size_t borrowed_before = pool->GetBorrowedReassemblyCount();
+
+			// Ŷ 3 ̾  Ʈ
+			std::vector<char> stream;
+			for (uint16_t id = 1; id <= 3; ++id) {
+				std::string payload(id * 100, static_cast<char>('a' + id));
+				NexusCore::Protocol::PacketHeader header(id, static_cast<uint16_t>(payload.size()));
+				stream.insert(stream.end(), reinterpret_cast<char*>(&header), reinterpret_cast<char*>(&header) + sizeof(header));
+				stream.insert(stream.end(), payload.begin(), payload.end());
+			}
+
+			std::vector<uint16_t> received;
+			auto on_packet = [&received](NexusCore::Protocol::PacketHeader* header, char* payload) {
+				received.push_back(header->packet_id);
+				return std::string(header->payload_length, static_cast<char>('a' + header->packet_id)) ==
+					std::string(payload, header->payload_length);
+			};
+
+			//  迡   
+			PacketAssembler assembler;
+			Assert::IsTrue(assembler.Feed(stream.data(), stream.size(), on_packet));
+			Assert::AreEqual(static_cast<size_t>(3), received.size());
+			Assert::IsFalse(assembler.HasPendingFrame());
+			Assert::AreEqual(borrowed_before, pool->GetBorrowedReassemblyCount());
+
+			//    ޾Ƶ  Ŷ, ߸ ȸ 
+			received.clear();
+			const size_t cuts[] = { 3, 120, 121, 400, stream.size() };
+			size_t offset = 0;
+			for (size_t cut : cuts) {
+				Assert::IsTrue(assembler.Feed(stream.data() + offset, cut - offset, on_packet));
+				Assert::AreEqual(assembler.HasPendingFrame() ? borrowed_before + 1 : borrowed_before,
+					pool->GetBorrowedReassemblyCount());
+				offset = cut;
+			}
+			Assert::AreEqual(static_cast<size_t>(3), received.size());
+			Assert::AreEqual(static_cast<uint16_t>(3), received.back());
+			Assert::IsFalse(assembler.HasPendingFrame());
+			Assert::AreEqual(static_cast<size_t>(0), assembler.GetResidentBytes());
+
+			// ִ Ŷ ũ⸦ Ѵ  ź
+			NexusCore::Protocol::PacketHeader oversized(1, 0xFFFF);
+			Assert::IsFalse(assembler.Feed(reinterpret_cast<char*>(&oversized), sizeof(oversized), on_packet));
+		}
+
+		TEST_METHOD(TaskSchedulerStealsWorkAndKeepsStrandOrder)
+		{
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(4));
+
+			//  ۾ ڱ   ۾ ٸ Ŀ ļ  
+			std::atomic<int> fast_done{ 0 };
+			std::promise<bool> slow_result;
+			scheduler->Submit([&]() {
+				for (int i = 0; i < 200; ++i) {
+					scheduler->Submit([&fast_done]() { ++fast_done; });
+				}
+				auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				while (fast_done < 200 && std::chrono::steady_clock::now() < deadline) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1)); //  ڵ鷯 䳻
+				}
+				slow_result.set_value(fast_done == 200);
+			});
+			Assert::IsTrue(slow_result.get_future().get());
+			Assert::IsTrue(scheduler->GetStealCount() > 0);
+
+			// Ʈ:  尡 ־   ϳ, 庰   
+			auto strand = TaskStrand::Create();
+			const int producer_count = 4;
+			const int tasks_per_producer = 5000;
+			std::vector<int> last_seen(producer_count, -1);
+			std::atomic<int> running{ 0 };
+			bool in_order = true;
+			bool overlapped = false;
+			std::promise<void> all_done;
+			std::atomic<int> remaining{ producer_count * tasks_per_producer };
+
+			std::vector<std::thread> producers;
+			for (int p = 0; p < producer_count; ++p) {
+				producers.emplace_back([&, p]() {
+					for (int i = 0; i < tasks_per_producer; ++i) {
+						strand->Post([&, p, i]() {
+							overlapped = overlapped || (running.fetch_add(1) != 0);
+							in_order = in_order && (last_seen[p] == i - 1);
+							last_seen[p] = i;
+							running.fetch_sub(1);
+							if (--remaining == 0) {
+								all_done.set_value();
+							}
+						});
+					}
+				});
+			}
+			for (auto& producer : producers) {
+				producer.join();
+			}
+			all_done.get_future().wait();
+
+			Assert::IsTrue(in_order);
+			Assert::IsFalse(overlapped);
+			scheduler->Stop();
+			Assert::AreEqual(static_cast<size_t>(0), scheduler->GetQueueDepth());
+		}
+
+		TEST_METHOD(CoroutineHandlersResumeOnStrandWithPooledFrames)
+		{
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+
+			// Ÿ̸/纸 ߴܵŵ  Ʈ忡 簳
+			auto strand = TaskStrand::Create();
+			int sum = 0;
+			std::promise<bool> finished;
+			strand->Post([&]() {
+				SpawnTask(SumOnStrand(strand.get(), &sum), [&finished](bool on_strand) { finished.set_value(on_strand); });
+			});
+			Assert::IsTrue(finished.get_future().get());
+			Assert::AreEqual(7, sum);
+
+			//  ڷƾ     ڷƾ ٽ 
+			const uint64_t allocated_before = CoroutineFramePool::GetAllocatedCount();
+			const uint64_t reused_before = CoroutineFramePool::GetReusedCount();
+			int matched = 0;
+			for (int i = 0; i < 1000; ++i) {
+				SpawnTask(EchoMatches(i), [&matched](bool success) { matched += success ? 1 : 0; });
+			}
+			Assert::AreEqual(1000, matched);
+			Assert::IsTrue(CoroutineFramePool::GetReusedCount() - reused_before >= 2990);
+			Assert::IsTrue(CoroutineFramePool::GetAllocatedCount() - allocated_before <= 10);
+
+			scheduler->Stop();
+		}
+
+		TEST_METHOD(PriorityLanesServeControlFirstAndShareByWeight)
+		{
+			namespace Protocol = NexusCore::Protocol;
+
+			// ۽ ť: ū    ׿ ־ ƮƮ , ä ״
+			auto make_packet = [](uint16_t packet_id, size_t payload_size) {
+				std::vector<char> packet(sizeof(Protocol::PacketHeader) + payload_size, 'x');
+				Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(payload_size));
+				memcpy(packet.data(), &header, sizeof(header));
+				return std::make_unique<SendData>(packet.data(), packet.size());
+			};
+
+			SendLaneQueue send_queue;
+			for (int i = 0; i < 10; ++i) {
+				send_queue.Push(make_packet(Protocol::PacketID::FILE_DOWNLOAD_DATA, 60 * 1024));
+			}
+			for (int i = 0; i < 10; ++i) {
+				send_queue.Push(make_packet(Protocol::PacketID::ROOM_CHAT_NTF, 100));
+			}
+			send_queue.Push(make_packet(Protocol::PacketID::HEARTBEAT_RES, 0));
+			Assert::AreEqual(static_cast<size_t>(21), send_queue.GetQueuedCount());
+
+			std::vector<Protocol::PacketClass> send_order;
+			while (auto send_data = send_queue.Pop()) {
+				send_order.push_back(SendLaneQueue::Classify(*send_data));
+			}
+			Assert::AreEqual(static_cast<size_t>(21), send_order.size());
+			Assert::IsTrue(send_order[0] == Protocol::PacketClass::CONTROL);
+			for (size_t i = 1; i <= 10; ++i) {
+				Assert::IsTrue(send_order[i] == Protocol::PacketClass::CHAT);
+			}
+			Assert::AreEqual(static_cast<size_t>(0), send_queue.GetQueuedBytes(Protocol::PacketClass::BULK));
+
+			// ٷ : Ŀ ϳ    ۾  , ä: = 8:1 
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(1));
+
+			std::promise<void> entered;
+			std::promise<void> release;
+			std::shared_future<void> release_future = release.get_future().share();
+			scheduler->Submit([&entered, release_future]() {
+				entered.set_value();
+				release_future.wait();
+			});
+			entered.get_future().wait();
+
+			std::vector<Protocol::PacketClass> run_order;
+			for (int i = 0; i < 20; ++i) {
+				scheduler->Submit([&run_order]() { run_order.push_back(Protocol::PacketClass::BULK); }, Protocol::PacketClass::BULK);
+			}
+			for (int i = 0; i < 20; ++i) {
+				scheduler->Submit([&run_order]() { run_order.push_back(Protocol::PacketClass::CHAT); }, Protocol::PacketClass::CHAT);
+			}
+			scheduler->Submit([&run_order]() { run_order.push_back(Protocol::PacketClass::CONTROL); }, Protocol::PacketClass::CONTROL);
+			release.set_value();
+			scheduler->Stop();
+
+			Assert::AreEqual(static_cast<size_t>(41), run_order.size());
+			Assert::IsTrue(run_order[0] == Protocol::PacketClass::CONTROL);
+			Assert::AreEqual(static_cast<ptrdiff_t>(8),
+				std::count(run_order.begin() + 1, run_order.begin() + 10, Protocol::PacketClass::CHAT));
+		}
+
+		TEST_METHOD(ReceiveLaneAcceptsOnlyControlPacketsBeforeLogin)
+		{
+			{
+				LoopbackTransport transport;
+				Session::SetTransport(&transport);
+				const uint64_t session_id = transport.Connect();
+
+				EpochGuard guard;
+				Session* session = SessionManager::GetInstance()->FindSession(session_id);
+				NexusCore::Protocol::PacketClass lane = NexusCore::Protocol::PacketClass::BULK;
+
+				// α : α//ƮƮ  ,  
+				for (uint16_t packet_id : { NexusCore::Protocol::PacketID::LOGIN_REQ, NexusCore::Protocol::PacketID::RESUME_REQ, NexusCore::Protocol::PacketID::HEARTBEAT_REQ }) {
+					Assert::IsTrue(session->GetReceiveLane(packet_id, lane));
+					Assert::IsTrue(lane == NexusCore::Protocol::PacketClass::CONTROL);
+				}
+				Assert::IsFalse(session->GetReceiveLane(NexusCore::Protocol::PacketID::ENTER_ROOM_REQ, lane));
+				Assert::IsFalse(session->GetReceiveLane(NexusCore::Protocol::PacketID::ROOM_CHAT_REQ, lane));
+				Assert::IsFalse(session->GetReceiveLane(9999, lane));
+
+				// α : Ŷ 뿪
+				session->SetLoggedIn("lane_user");
+				Assert::IsTrue(session->GetReceiveLane(NexusCore::Protocol::PacketID::ROOM_CHAT_REQ, lane));
+				Assert::IsTrue(lane == NexusCore::Protocol::PacketClass::CHAT);
+
+				transport.Close(session_id);
+			}
+			Session::SetTransport(nullptr);
+		}
+
+		TEST_METHOD(RateLimiterEnforcesBucketsAndSharesUploadBandwidth)
+		{
+			namespace Protocol = NexusCore::Protocol;
+
+			RateLimiter* limiter = RateLimiter::GetInstance();
+			limiter->ResetPolicies();
+			const int64_t now_ms = 1000000;
+
+			// ɸ  ̹Ƿ ռ   
+			Statistics* stats = Statistics::GetInstance();
+			limiter->PublishStats();
+			const uint64_t chat_dropped_before = stats->GetCounter("ratelimit.chat.dropped");
+			const uint64_t session_kicked_before = stats->GetCounter("ratelimit.session.kicked");
+
+			// ä ʴ 10, Ʈ 5: ټ   , 100ms  ϳ  
+			limiter->SetClassPolicy(Protocol::PacketClass::CHAT, { 10, 5, RateLimitAction::DROP });
+			SessionRateState chat_state;
+			for (int i = 0; i < 5; ++i) {
+				Assert::IsTrue(limiter->Check(chat_state, Protocol::PacketID::ROOM_CHAT_REQ, 16, now_ms) == RateLimitAction::ALLOW);
+			}
+			Assert::IsTrue(limiter->Check(chat_state, Protocol::PacketID::ROOM_CHAT_REQ, 16, now_ms) == RateLimitAction::DROP);
+			Assert::IsTrue(limiter->Check(chat_state, Protocol::PacketID::ROOM_CHAT_REQ, 16, now_ms + 100) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(chat_state, Protocol::PacketID::ROOM_CHAT_REQ, 16, now_ms + 100) == RateLimitAction::DROP);
+			Assert::AreEqual(static_cast<int64_t>(0), chat_state.throttled_until_ms);
+
+			// THROTTLE Ű ū 1 ƿ   ߰ 
+			limiter->SetClassPolicy(Protocol::PacketClass::BULK, { 10, 1, RateLimitAction::THROTTLE });
+			SessionRateState bulk_state;
+			Assert::IsTrue(limiter->Check(bulk_state, Protocol::PacketID::FILE_UPLOAD_REQ, 16, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(bulk_state, Protocol::PacketID::FILE_UPLOAD_REQ, 16, now_ms) == RateLimitAction::THROTTLE);
+			Assert::IsTrue(bulk_state.throttled_until_ms >= now_ms + 200 && bulk_state.throttled_until_ms <= now_ms + 201);
+
+			//  ü ѵ Ŭ ϰ ,   
+			limiter->SetSessionPolicy({ 10, 2, RateLimitAction::KICK });
+			SessionRateState flood_state;
+			Assert::IsTrue(limiter->Check(flood_state, Protocol::PacketID::ROOM_CHAT_REQ, 16, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(flood_state, Protocol::PacketID::HEARTBEAT_REQ, 0, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(flood_state, Protocol::PacketID::FILE_UPLOAD_REQ, 16, now_ms) == RateLimitAction::KICK);
+
+			// ɸ  PublishStats  /ġ īͷ 
+			limiter->PublishStats();
+			Assert::AreEqual(chat_dropped_before + 2, stats->GetCounter("ratelimit.chat.dropped"));
+			Assert::AreEqual(session_kicked_before + 1, stats->GetCounter("ratelimit.session.kicked"));
+
+			// ε 1MB/s   64KB ûũ    (ûũ ϳ 62.5ms, Ʈ 100ms)
+			limiter->ResetPolicies();
+			limiter->SetUploadBandwidth(1024 * 1024);
+			SessionRateState upload_a;
+			SessionRateState upload_b;
+			const uint32_t chunk = 64 * 1024;
+			Assert::IsTrue(limiter->Check(upload_a, Protocol::PacketID::FILE_CHUNK_SEND, chunk, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(upload_b, Protocol::PacketID::FILE_CHUNK_SEND, chunk, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(upload_a, Protocol::PacketID::FILE_CHUNK_SEND, chunk, now_ms) == RateLimitAction::ALLOW);
+			Assert::IsTrue(limiter->Check(upload_b, Protocol::PacketID::FILE_CHUNK_SEND, chunk, now_ms) == RateLimitAction::THROTTLE);
+			Assert::IsTrue(limiter->Check(upload_a, Protocol::PacketID::FILE_CHUNK_SEND, chunk, now_ms) == RateLimitAction::THROTTLE);
+			Assert::AreEqual(now_ms + 50, upload_b.throttled_until_ms);
+			Assert::AreEqual(now_ms + 112, upload_a.throttled_until_ms);
+
+			limiter->ResetPolicies();
+		}
+
+		TEST_METHOD(SendQueuesAndPoolsChargeMemoryAccountant)
+		{
+			namespace Protocol = NexusCore::Protocol;
+			using NexusCore::Common::MemoryAccountant;
+			using NexusCore::Common::MemoryCategory;
+
+			MemoryAccountant* accountant = MemoryAccountant::GetInstance();
+			const size_t base_send = accountant->GetUsage(MemoryCategory::SEND_QUEUE);
+			const size_t base_pool = accountant->GetUsage(MemoryCategory::POOL);
+
+			//  Ŷ ,   Ŷ 常 
+			Protocol::PacketHeader header(Protocol::PacketID::ROOM_CHAT_NTF, 100);
+			std::vector<char> packet(sizeof(header) + 100);
+			memcpy(packet.data(), &header, sizeof(header));
+			{
+				SendLaneQueue send_queue;
+				send_queue.Push(std::make_unique<SendData>(packet.data(), packet.size()));
+				send_queue.Push(std::make_unique<SendData>(std::make_shared<const std::vector<char>>(packet)));
+				Assert::AreEqual(2 * sizeof(SendData) + packet.size(), send_queue.GetResidentBytes());
+
+				//  Ŷ  ˸Ƿ    ״,  ũ⸦ ѱ ׶ ̸   ݿ
+				Assert::AreEqual(base_send, accountant->GetUsage(MemoryCategory::SEND_QUEUE));
+				std::vector<char> large(sizeof(header) + SendLaneQueue::CHARGE_BATCH_BYTES);
+				memcpy(large.data(), &header, sizeof(header));
+				send_queue.Push(std::make_unique<SendData>(large.data(), large.size()));
+				Assert::AreEqual(base_send + send_queue.GetResidentBytes(), accountant->GetUsage(MemoryCategory::SEND_QUEUE));
+
+				// ť  ٷ 
+				Assert::AreEqual(Protocol::PacketID::ROOM_CHAT_NTF, SendLaneQueue::GetPacketId(*send_queue.Pop()));
+				send_queue.Pop();
+				send_queue.Pop();
+				Assert::IsTrue(send_queue.IsEmpty());
+				Assert::AreEqual(base_send, accountant->GetUsage(MemoryCategory::SEND_QUEUE));
+
+				send_queue.Push(std::make_unique<SendData>(large.data(), large.size()));
+			}
+			Assert::AreEqual(base_send, accountant->GetUsage(MemoryCategory::SEND_QUEUE)); //  ׸ Ҹ  
+
+			// Ǯ  ü ŭ (   ), ļ  ü Ҹ   ü 
+			{
+				MemoryPool<uint64_t> pool(2, 2);
+				Assert::AreEqual(base_pool + 2 * sizeof(uint64_t), accountant->GetUsage(MemoryCategory::POOL));
+				auto first = pool.Acquire();
+				auto second = pool.Acquire();
+				auto third = pool.Acquire();
+				Assert::AreEqual(base_pool + 3 * sizeof(uint64_t), accountant->GetUsage(MemoryCategory::POOL));
+				pool.Release(std::move(first));
+				pool.Release(std::move(second));
+				pool.Release(std::move(third));
+				Assert::AreEqual(base_pool + 2 * sizeof(uint64_t), accountant->GetUsage(MemoryCategory::POOL));
+			}
+			Assert::AreEqual(base_pool, accountant->GetUsage(MemoryCategory::POOL));
+		}
+
+		TEST_METHOD(LoginAdmissionQueuesInOrderWithinBudget)
+		{
+			namespace Protocol = NexusCore::Protocol;
+
+			LoginAdmission* admission = LoginAdmission::GetInstance();
+			admission->SetLimits(2, 3);
+
+			std::vector<uint64_t> started;
+			auto start_of = [&started](uint64_t session_id) {
+				return [&started, session_id]() { started.push_back(session_id); };
+			};
+
+			//  2 ٷ , Ĵ   
+			uint32_t position = 0;
+			Assert::IsTrue(admission->Request(1, start_of(1), position) == LoginAdmission::Result::ADMITTED);
+			Assert::IsTrue(admission->Request(2, start_of(2), position) == LoginAdmission::Result::ADMITTED);
+			Assert::IsTrue(admission->Request(3, start_of(3), position) == LoginAdmission::Result::QUEUED);
+			Assert::AreEqual(static_cast<uint32_t>(1), position);
+			Assert::IsTrue(admission->Request(4, start_of(4), position) == LoginAdmission::Result::QUEUED);
+			Assert::AreEqual(static_cast<uint32_t>(2), position);
+			Assert::IsTrue(admission->Request(3, start_of(3), position) == LoginAdmission::Result::DUPLICATE);
+			Assert::IsTrue(admission->Request(5, start_of(5), position) == LoginAdmission::Result::QUEUED);
+			Assert::IsTrue(admission->Request(6, start_of(6), position) == LoginAdmission::Result::REJECTED);
+			Assert::AreEqual(static_cast<size_t>(2), started.size());
+
+			//  α ڸ ⿭  
+			admission->Complete();
+			Assert::AreEqual(static_cast<uint64_t>(3), started.back());
+			Assert::AreEqual(static_cast<size_t>(2), admission->GetInFlightCount());
+
+			// ڸ    û   û ڿ 
+			Assert::IsTrue(admission->Request(7, start_of(7), position) == LoginAdmission::Result::QUEUED);
+			Assert::AreEqual(static_cast<uint32_t>(3), position);
+
+			//  ø   û ٷ 
+			admission->SetLimits(4, 3);
+			Assert::AreEqual(static_cast<size_t>(5), started.size());
+			Assert::AreEqual(static_cast<uint64_t>(5), started.back());
+			admission->Complete();
+			Assert::AreEqual(static_cast<uint64_t>(7), started.back());
+			for (int i = 0; i < 4; ++i) {
+				admission->Complete();
+			}
+			Assert::AreEqual(static_cast<size_t>(0), admission->GetInFlightCount());
+			Assert::AreEqual(static_cast<size_t>(0), admission->GetQueuedCount());
+
+			//   Ŀ и ۾ 
+			Assert::AreEqual(static_cast<uint32_t>(0), LoginAdmission::ComputeAcceptDelayMs(Protocol::Config::ACCEPT_LOAD_LOW));
+			Assert::AreEqual(Protocol::Config::ACCEPT_MAX_DELAY_MS, LoginAdmission::ComputeAcceptDelayMs(Protocol::Config::ACCEPT_LOAD_HIGH * 2));
+			const uint32_t middle = LoginAdmission::ComputeAcceptDelayMs(
+				(Protocol::Config::ACCEPT_LOAD_LOW + Protocol::Config::ACCEPT_LOAD_HIGH) / 2);
+			Assert::IsTrue(middle > 0 && middle < Protocol::Config::ACCEPT_MAX_DELAY_MS);
+
+			admission->SetLimits(Protocol::Config::LOGIN_MAX_CONCURRENT, Protocol::Config::LOGIN_QUEUE_CAPACITY);
+		}
+
+		TEST_METHOD(ReplayRingResendsOnlyMissedPackets)
+		{
+			namespace Protocol = NexusCore::Protocol;
+			using NexusCore::Common::MemoryAccountant;
+			using NexusCore::Common::MemoryCategory;
+
+			MemoryAccountant* accountant = MemoryAccountant::GetInstance();
+			const size_t base_usage = accountant->GetUsage(MemoryCategory::REPLAY_BUFFER);
+
+			auto make_packet = [](char tag, size_t size) {
+				return std::make_shared<const std::vector<char>>(size, tag);
+			};
+
+			{
+				//  ѵ 4:   ð  ͺ з
+				ReplayRing ring(4, 1024);
+				for (char tag = 'a'; tag <= 'f'; ++tag) {
+					ring.Push(make_packet(tag, 10));
+				}
+				Assert::AreEqual(static_cast<uint64_t>(6), ring.GetLastSequence());
+				Assert::AreEqual(static_cast<size_t>(4), ring.GetCount());
+				Assert::AreEqual(base_usage + 40, accountant->GetUsage(MemoryCategory::REPLAY_BUFFER));
+
+				//     ͸,  
+				std::vector<ReplayRing::Packet> missed;
+				Assert::IsTrue(ring.CollectAfter(3, missed));
+				Assert::AreEqual(static_cast<size_t>(3), missed.size());
+				Assert::AreEqual('d', missed.front()->front());
+				Assert::AreEqual('f', missed.back()->front());
+
+				missed.clear();
+				Assert::IsTrue(ring.CollectAfter(6, missed));
+				Assert::IsTrue(missed.empty());
+
+				// ̹ з ̳     簳 Ұ
+				Assert::IsFalse(ring.CollectAfter(1, missed));
+				Assert::IsFalse(ring.CollectAfter(7, missed));
+
+				// Ʈ ѵ: ū Ŷ   ͵ о (   )
+				ReplayRing small(100, 64);
+				small.Push(make_packet('x', 30));
+				small.Push(make_packet('y', 30));
+				small.Push(make_packet('z', 100));
+				Assert::AreEqual(static_cast<size_t>(1), small.GetCount());
+				Assert::AreEqual(static_cast<size_t>(100), small.GetBytes());
+				Assert::IsTrue(small.CollectAfter(2, missed));
+				Assert::IsFalse(small.CollectAfter(1, missed));
+
+				//   Űܵ  뷮 ״
+				ReplayRing moved = std::move(ring);
+				Assert::AreEqual(static_cast<uint64_t>(7), moved.Push(make_packet('g', 10)));
+				Assert::AreEqual(base_usage + 140, accountant->GetUsage(MemoryCategory::REPLAY_BUFFER));
+			}
+			Assert::AreEqual(base_usage, accountant->GetUsage(MemoryCategory::REPLAY_BUFFER));
+
+			// ResumeRequest { resume_token = 1; last_sequence = 2; } + 𸣴 ʵ
+			std::string request;
+			request += static_cast<char>(0x0A);
+			request += static_cast<char>(3);
+			request += "tok";
+			request += static_cast<char>(0x10);
+			request += static_cast<char>(0xAC);
+			request += static_cast<char>(0x02); // 300
+			request += static_cast<char>(0x18);
+			request += static_cast<char>(0x01);
+
+			std::string token;
+			uint64_t last_sequence = 0;
+			Assert::IsTrue(Protocol::SessionResumeCodec::DecodeRequest(request.data(), request.size(), token, last_sequence));
+			Assert::AreEqual(std::string("tok"), token);
+			Assert::AreEqual(static_cast<uint64_t>(300), last_sequence);
+			Assert::IsFalse(Protocol::SessionResumeCodec::DecodeRequest(request.data(), 4, token, last_sequence));
+			Assert::IsFalse(Protocol::SessionResumeCodec::DecodeRequest(request.data() + 5, 3, token, last_sequence));
+
+			const std::string response = Protocol::SessionResumeCodec::EncodeResponse(true, 5, "", 0, 2);
+			Assert::AreEqual(std::string("\x08\x01\x10\x05\x28\x02", 6), response);
+		}
+
+		TEST_METHOD(ThreadPlacementKeepsWorkersOnNodeBlocks)
+		{
+			std::vector<uint32_t> cpus;
+			Assert::IsTrue(AffinityOptions::ParseCpuList("0-3, 8,10-11", cpus));
+			Assert::IsTrue(std::vector<uint32_t>{ 0, 1, 2, 3, 8, 10, 11 } == cpus);
+			Assert::IsTrue(AffinityOptions::ParseCpuList("", cpus));
+			Assert::IsTrue(cpus.empty());
+			Assert::IsFalse(AffinityOptions::ParseCpuList("3-1", cpus));
+			Assert::IsFalse(AffinityOptions::ParseCpuList("1,", cpus));
+			Assert::IsFalse(AffinityOptions::ParseCpuList("x", cpus));
+
+			//  2 x  ھ 4 x SMT 2: CPU 2k, 2k+1  ھ
+			std::vector<LogicalCpu> logical;
+			for (uint32_t i = 0; i < 16; ++i) {
+				logical.push_back({ 0, static_cast<uint8_t>(i), i / 8, i / 2 });
+			}
+			const CpuTopology topology(logical);
+			Assert::AreEqual(static_cast<size_t>(2), topology.GetNodeCount());
+			Assert::AreEqual(static_cast<size_t>(8), topology.GetCoreCount());
+
+			//  0 ù ھ accept/ , Ŀ 帶    ھ
+			AffinityOptions options;
+			AffinityPlan plan = ThreadPlacement::BuildPlan(topology, options, 4);
+			Assert::IsTrue(std::vector<uint32_t>{ 2, 4, 8, 10 } == plan.worker_cpus);
+			Assert::IsTrue(std::vector<uint32_t>{ 0, 1 } == plan.accept_cpus);
+			Assert::IsTrue(std::vector<uint32_t>{ 0, 1 } == plan.admin_cpus);
+
+			plan = ThreadPlacement::BuildPlan(topology, options, 3);
+			Assert::IsTrue(std::vector<uint32_t>{ 2, 4, 8 } == plan.worker_cpus);
+
+			plan = ThreadPlacement::BuildPlan(topology, options, 0);
+			Assert::IsTrue(std::vector<uint32_t>{ 2, 4, 6, 3, 5, 7, 8, 10, 12, 14, 9, 11, 13, 15 } == plan.worker_cpus);
+
+			//    ״ ( CPU )
+			options.worker_cpus = { 1, 99 };
+			options.admin_cpus = { 15 };
+			plan = ThreadPlacement::BuildPlan(topology, options, 4);
+			Assert::IsTrue(std::vector<uint32_t>{ 1 } == plan.worker_cpus);
+			Assert::IsTrue(std::vector<uint32_t>{ 15 } == plan.admin_cpus);
+
+			options.enabled = false;
+			plan = ThreadPlacement::BuildPlan(topology, options, 4);
+			Assert::IsTrue(plan.worker_cpus.empty() && plan.accept_cpus.empty());
+
+			// ھ  Ŀ    
+			const CpuTopology small({ { 0, 0, 0, 0 }, { 0, 1, 0, 1 } });
+			plan = ThreadPlacement::BuildPlan(small, AffinityOptions(), 2);
+			Assert::IsTrue(std::vector<uint32_t>{ 0, 1 } == plan.worker_cpus);
+			Assert::IsTrue(plan.accept_cpus.empty());
+		}
+
+		TEST_METHOD(WorkerPoolFollowsLoadRampWithHysteresis)
+		{
+			WorkerPoolOptions options;
+			options.min_workers = 2;
+			options.max_workers = 8;
+			WorkerPoolController controller(options);
+
+			size_t active = 2;
+			size_t grows = 0;
+			size_t shrinks = 0;
+			auto feed = [&](double utilization, size_t queue_depth, size_t samples) {
+				for (size_t i = 0; i < samples; ++i) {
+					WorkerPoolSample sample;
+					sample.active_workers = active;
+					sample.utilization = utilization;
+					sample.queue_depth = queue_depth;
+					const ScalingDecision decision = controller.Evaluate(sample);
+					Assert::AreEqual(active, decision.from_workers);
+					grows += decision.action == ScalingAction::GROW ? 1 : 0;
+					shrinks += decision.action == ScalingAction::SHRINK ? 1 : 0;
+					active = decision.to_workers;
+					Assert::IsTrue(active >= 2 && active <= 8);
+				}
+			};
+
+			//   ϳ 踦  Ϸδ ٲ 
+			feed(0.6, 0, 50);
+			for (int i = 0; i < 20; ++i) {
+				feed(0.95, 0, 1);
+				feed(0.2, 0, 1);
+			}
+			Assert::AreEqual(static_cast<size_t>(2), active);
+			Assert::AreEqual(static_cast<size_t>(0), grows + shrinks);
+
+			// :   ̸ ø, ٿ(3)  ״
+			feed(0.95, 0, 1);
+			Assert::AreEqual(static_cast<size_t>(2), active);
+			feed(0.95, 0, 1);
+			Assert::AreEqual(static_cast<size_t>(3), active);
+			feed(0.95, 0, 4);
+			Assert::AreEqual(static_cast<size_t>(3), active);
+			feed(0.95, 0, 1);
+			Assert::AreEqual(static_cast<size_t>(4), active);
+			feed(0.95, 0, 40);
+			Assert::AreEqual(static_cast<size_t>(8), active);
+			Assert::AreEqual(static_cast<size_t>(6), grows);
+
+			// : ϳ,  õõ ּұ
+			feed(0.1, 0, 13);
+			Assert::AreEqual(static_cast<size_t>(7), active);
+			feed(0.1, 0, 200);
+			Assert::AreEqual(static_cast<size_t>(2), active);
+			Assert::AreEqual(static_cast<size_t>(6), shrinks);
+
+			// ٻ  Ƶ  ۾ Ŀ ѵ  ø
+			feed(0.0, 9, 1);
+			Assert::AreEqual(static_cast<size_t>(2), active);
+			feed(0.0, 9, 1);
+			Assert::AreEqual(static_cast<size_t>(3), active);
+
+			//  ̸ ٷ  
+			WorkerPoolSample outside;
+			outside.active_workers = 20;
+			const ScalingDecision clamp = controller.Evaluate(outside);
+			Assert::IsTrue(clamp.action == ScalingAction::SHRINK);
+			Assert::AreEqual(static_cast<size_t>(8), clamp.to_workers);
+
+			// ٷ: ִ ŭ  ּ  ,  Ŀ ־ ۾  
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			options.min_workers = 1;
+			options.max_workers = 3;
+			options.sample_interval_ms = 60000;
+			Assert::IsTrue(scheduler->Start(options));
+			Assert::AreEqual(static_cast<size_t>(3), scheduler->GetWorkerCount());
+			Assert::AreEqual(static_cast<size_t>(1), scheduler->GetActiveWorkerCount());
+
+			std::vector<ScalingDecision> logged;
+			scheduler->SetScalingListener([&logged](const ScalingDecision& decision) { logged.push_back(decision); });
+
+			std::atomic<int> done{ 0 };
+			for (int i = 0; i < 200; ++i) {
+				scheduler->Submit([&done]() { ++done; });
+			}
+			scheduler->SetActiveWorkerCount(10);
+			Assert::AreEqual(static_cast<size_t>(3), scheduler->GetActiveWorkerCount());
+			for (int i = 0; i < 200; ++i) {
+				scheduler->Submit([&done]() { ++done; });
+			}
+			scheduler->SetActiveWorkerCount(1);
+			for (int i = 0; i < 200; ++i) {
+				scheduler->Submit([&done]() { ++done; });
+			}
+			for (int i = 0; i < 1000 && done.load() < 600; ++i) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			Assert::AreEqual(600, done.load());
+
+			scheduler->AdjustWorkerCount(); //  Ƿ ״ (̷   ʿ)
+			Assert::AreEqual(static_cast<size_t>(1), scheduler->GetActiveWorkerCount());
+			Assert::IsTrue(logged.empty());
+			scheduler->SetScalingListener(nullptr);
+			scheduler->Stop();
+		}
+
+		TEST_METHOD(LoopbackTransportCarriesSplitPacketsBothWays)
+		{
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+			PacketDispatcher::GetInstance()->RegisterHandler(NexusCore::Protocol::PacketID::HEARTBEAT_REQ, std::make_unique<EchoHandler>());
+
+			std::mutex mutex;
+			std::vector<std::pair<uint64_t, std::string>> replies;
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t session_id, const NexusCore::Protocol::PacketHeader& header, const char* payload) {
+					if (header.packet_id == NexusCore::Protocol::PacketID::HEARTBEAT_RES) {
+						std::lock_guard<std::mutex> lock(mutex);
+						replies.emplace_back(session_id, std::string(payload, header.payload_length));
+					}
+				});
+				Session::SetTransport(&transport);
+
+				const uint64_t first = transport.Connect();
+				const uint64_t second = transport.Connect();
+				Assert::IsTrue(first != 0 && second != 0);
+				Assert::AreEqual(static_cast<size_t>(2), transport.GetConnectionCount());
+
+				//  ߰ ߸ Ŷ     Ŷ
+				const std::string ping = EchoHandler::MakeTestPacket(NexusCore::Protocol::PacketID::HEARTBEAT_REQ, "ping");
+				transport.Write(first, ping.data(), 3);
+				transport.Write(second, (ping + EchoHandler::MakeTestPacket(NexusCore::Protocol::PacketID::HEARTBEAT_REQ, "pong")).c_str(), ping.size() * 2);
+				Assert::AreEqual(static_cast<size_t>(2), transport.Pump());
+				transport.Write(first, ping.data() + 3, ping.size() - 3);
+
+				auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				for (;;) {
+					transport.Pump();
+					std::lock_guard<std::mutex> lock(mutex);
+					if (replies.size() == 3 || std::chrono::steady_clock::now() >= deadline) {
+						break;
+					}
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					Assert::AreEqual(static_cast<size_t>(3), replies.size());
+					std::vector<std::string> second_replies;
+					size_t first_replies = 0;
+					for (const auto& reply : replies) {
+						if (reply.first == second) {
+							second_replies.push_back(reply.second);
+						}
+						else {
+							Assert::AreEqual(first, reply.first);
+							Assert::AreEqual(std::string("ping"), reply.second);
+							++first_replies;
+						}
+					}
+					Assert::AreEqual(static_cast<size_t>(1), first_replies);
+					Assert::IsTrue(second_replies == std::vector<std::string>{ "ping", "pong" }); //    
+				}
+
+				// ߸     ᵵ 
+				const std::string garbage(16, '\xFF');
+				transport.Write(first, garbage.data(), garbage.size());
+				for (int i = 0; i < 4 && transport.GetConnectionCount() == 2; ++i) {
+					transport.Pump(); // ޸ ̸  0Ʈ  
+				}
+				Assert::AreEqual(static_cast<size_t>(1), transport.GetConnectionCount());
+				Assert::IsNull(SessionManager::GetInstance()->FindSession(first));
+
+				transport.Close(second);
+				Assert::AreEqual(static_cast<size_t>(0), transport.GetConnectionCount());
+			}
+			Session::SetTransport(nullptr);
+			PacketDispatcher::GetInstance()->UnregisterHandler(NexusCore::Protocol::PacketID::HEARTBEAT_REQ);
+			scheduler->Stop();
+		}
+
+		TEST_METHOD(LoopbackSessionHibernatesWakesAndHibernatesAgain)
+		{
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+			PacketDispatcher::GetInstance()->RegisterHandler(NexusCore::Protocol::PacketID::HEARTBEAT_REQ, std::make_unique<EchoHandler>());
+			Session::SetHibernateIdleMs(1);
+
+			std::atomic<size_t> replies{ 0 };
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&replies](uint64_t, const NexusCore::Protocol::PacketHeader&, const char*) { ++replies; });
+				Session::SetTransport(&transport);
+
+				SessionBufferPool* pool = SessionBufferPool::GetInstance();
+				const size_t borrowed_before = pool->GetBorrowedRecvCount();
+				const uint64_t session_id = transport.Connect();
+				Assert::IsTrue(session_id != 0);
+
+				auto is_hibernating = [session_id]() {
+					EpochGuard guard;
+					return SessionManager::GetInstance()->FindSession(session_id)->IsHibernating();
+				};
+				auto resident_bytes = [session_id]() {
+					EpochGuard guard;
+					return SessionManager::GetInstance()->FindSession(session_id)->GetResidentBytes();
+				};
+				const std::string heartbeat = EchoHandler::MakeTestPacket(NexusCore::Protocol::PacketID::HEARTBEAT_REQ, "hb");
+
+				// ƮƮ Ȱ ġ Ƿ  ð       ɸ
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				transport.Write(session_id, heartbeat.data(), heartbeat.size());
+				Assert::AreEqual(static_cast<size_t>(1), transport.Pump());
+				Assert::IsTrue(is_hibernating());
+				Assert::AreEqual(borrowed_before, pool->GetBorrowedRecvCount());
+				const size_t hibernating_bytes = resident_bytes();
+
+				//  : 0Ʈ   ۸ ٽ    
+				transport.Write(session_id, heartbeat.data(), heartbeat.size());
+				Assert::AreEqual(static_cast<size_t>(1), transport.Pump());
+				Assert::IsFalse(is_hibernating());
+				Assert::AreEqual(borrowed_before + 1, pool->GetBorrowedRecvCount());
+				Assert::AreEqual(hibernating_bytes + sizeof(RecvBuffer), resident_bytes());
+
+				//  Ʈ ް  ٽ ޸ϸ ۴ Ǯ ư
+				Assert::AreEqual(static_cast<size_t>(1), transport.Pump());
+				Assert::IsTrue(is_hibernating());
+				Assert::AreEqual(borrowed_before, pool->GetBorrowedRecvCount());
+				Assert::AreEqual(hibernating_bytes, resident_bytes());
+
+				auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				while (replies < 2 && std::chrono::steady_clock::now() < deadline) {
+					std::this_thread::yield();
+				}
+				Assert::AreEqual(static_cast<size_t>(2), replies.load());
+
+				transport.Close(session_id);
+			}
+			Session::SetTransport(nullptr);
+			Session::SetHibernateIdleMs(NexusCore::Protocol::Config::SESSION_HIBERNATE_IDLE_SEC * 1000);
+			PacketDispatcher::GetInstance()->UnregisterHandler(NexusCore::Protocol::PacketID::HEARTBEAT_REQ);
+			scheduler->Stop();
+		}
+
+		TEST_METHOD(LoginIssuesResumeTokenThatResumesAfterDisconnect)
+		{
+			namespace Protocol = NexusCore::Protocol;
+			namespace WireFormat = NexusCore::Protocol::WireFormat;
+
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+			PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+			dispatcher->RegisterHandler(Protocol::PacketID::LOGIN_REQ, std::make_unique<LoginHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::RESUME_REQ, std::make_unique<ResumeHandler>());
+
+			struct Reply {
+				uint64_t session_id;
+				uint16_t packet_id;
+				std::string payload;
+			};
+			std::mutex mutex;
+			std::vector<Reply> replies;
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t session_id, const Protocol::PacketHeader& header, const char* payload) {
+					std::lock_guard<std::mutex> lock(mutex);
+					replies.push_back({ session_id, header.packet_id, std::string(payload, header.payload_length) });
+				});
+				Session::SetTransport(&transport);
+
+				//    Pump (  ϳ )
+				size_t next_reply = 0;
+				auto wait_reply = [&](uint16_t packet_id) {
+					auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+					for (;;) {
+						transport.Pump();
+						std::lock_guard<std::mutex> lock(mutex);
+						for (; next_reply < replies.size(); ++next_reply) {
+							if (replies[next_reply].packet_id == packet_id) {
+								return replies[next_reply++];
+							}
+						}
+						Assert::IsTrue(std::chrono::steady_clock::now() < deadline);
+					}
+				};
+				auto read_fields = [](const std::string& payload) {
+					std::unordered_map<uint32_t, std::string> fields; // varint 10 ڿ
+					Assert::IsTrue(WireFormat::ForEachField(payload.data(), payload.size(),
+						[&fields](uint32_t field, uint64_t value, const char* data, size_t length) {
+							fields[field] = data ? std::string(data, length) : std::to_string(value);
+						}));
+					return fields;
+				};
+
+				const uint64_t first = transport.Connect();
+				std::string login;
+				WireFormat::AppendBytesField(login, 1, "resume_user");
+				WireFormat::AppendBytesField(login, 2, "pw");
+				const std::string login_packet = EchoHandler::MakeTestPacket(Protocol::PacketID::LOGIN_REQ, login);
+				transport.Write(first, login_packet.data(), login_packet.size());
+
+				// LOGIN_RES ,  ID,  ū
+				const Reply login_reply = wait_reply(Protocol::PacketID::LOGIN_RES);
+				Assert::AreEqual(first, login_reply.session_id);
+				auto login_fields = read_fields(login_reply.payload);
+				Assert::AreEqual(std::string("1"), login_fields[1]);
+				Assert::AreEqual(std::to_string(first), login_fields[2]);
+				const std::string token = login_fields[6];
+				Assert::AreEqual(static_cast<size_t>(16), token.size());
+				{
+					EpochGuard guard;
+					Assert::IsTrue(SessionManager::GetInstance()->FindSessionByUserId("resume_user") ==
+						SessionManager::GetInstance()->FindSession(first));
+				}
+
+				//    , ׵ ä 뿪 Ŷ   
+				transport.Drop(first);
+				const std::string notify = EchoHandler::MakeTestPacket(Protocol::PacketID::ROOM_CHAT_NTF, "missed");
+				{
+					EpochGuard guard;
+					Session* suspended = SessionManager::GetInstance()->FindSession(first);
+					Assert::IsNotNull(suspended);
+					Assert::IsTrue(suspended->PostSend(notify.data(), notify.size()));
+				}
+
+				// ٸ ū ,  ū̸   α ¸ Ѱܹް ģ Ŷ 
+				const uint64_t second = transport.Connect();
+				std::string bad_resume;
+				WireFormat::AppendBytesField(bad_resume, 1, std::string(16, 'x'));
+				const std::string bad_packet = EchoHandler::MakeTestPacket(Protocol::PacketID::RESUME_REQ, bad_resume);
+				transport.Write(second, bad_packet.data(), bad_packet.size());
+				auto bad_fields = read_fields(wait_reply(Protocol::PacketID::RESUME_RES).payload);
+				Assert::AreEqual(std::to_string(Protocol::ErrorCode::RESUME_NOT_FOUND), bad_fields[4]);
+
+				std::string resume;
+				WireFormat::AppendBytesField(resume, 1, token);
+				const std::string resume_packet = EchoHandler::MakeTestPacket(Protocol::PacketID::RESUME_REQ, resume);
+				transport.Write(second, resume_packet.data(), resume_packet.size());
+				const Reply resume_reply = wait_reply(Protocol::PacketID::RESUME_RES);
+				Assert::AreEqual(second, resume_reply.session_id);
+				auto resume_fields = read_fields(resume_reply.payload);
+				Assert::AreEqual(std::string("1"), resume_fields[1]);
+				Assert::AreEqual(std::to_string(second), resume_fields[2]);
+				Assert::AreEqual(std::string("1"), resume_fields[5]);
+
+				const Reply replayed = wait_reply(Protocol::PacketID::ROOM_CHAT_NTF);
+				Assert::AreEqual(second, replayed.session_id);
+				Assert::AreEqual(std::string("missed"), replayed.payload);
+				{
+					EpochGuard guard;
+					Assert::IsNull(SessionManager::GetInstance()->FindSession(first));
+					Session* resumed = SessionManager::GetInstance()->FindSessionByUserId("resume_user");
+					Assert::IsTrue(resumed == SessionManager::GetInstance()->FindSession(second));
+					Assert::IsTrue(resumed->IsLoggedIn());
+					Assert::AreEqual(token, resumed->GetResumeToken());
+				}
+
+				transport.Close(second);
+			}
+			Session::SetTransport(nullptr);
+			dispatcher->UnregisterHandler(Protocol::PacketID::LOGIN_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::RESUME_REQ);
+			scheduler->Stop();
+		}
+
+		TEST_METHOD(EnterRoomReturnsRecentChatRecordedByRoomChat)
+		{
+			namespace Protocol = NexusCore::Protocol;
+			namespace WireFormat = NexusCore::Protocol::WireFormat;
+
+			const std::filesystem::path root = std::filesystem::temp_directory_path() / "nexus_enter_history_test";
+			std::filesystem::remove_all(root);
+			Assert::IsTrue(ChatHistoryManager::GetInstance()->Start(root.string()));
+
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+			PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+			dispatcher->RegisterHandler(Protocol::PacketID::LOGIN_REQ, std::make_unique<LoginHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::ENTER_ROOM_REQ, std::make_unique<EnterRoomHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::LEAVE_ROOM_REQ, std::make_unique<LeaveRoomHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::ROOM_CHAT_REQ, std::make_unique<ChatMessageHandler>());
+
+			ChatRoom* room = RoomManager::GetInstance()->CreateRoom("lobby");
+			Assert::IsNotNull(room);
+			Assert::IsNotNull(room->GetHistory());
+			const uint32_t room_id = room->GetRoomId();
+
+			struct Reply {
+				uint64_t session_id;
+				uint16_t packet_id;
+				std::string payload;
+			};
+			std::mutex mutex;
+			std::vector<Reply> replies;
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t session_id, const Protocol::PacketHeader& header, const char* payload) {
+					std::lock_guard<std::mutex> lock(mutex);
+					replies.push_back({ session_id, header.packet_id, std::string(payload, header.payload_length) });
+				});
+				Session::SetTransport(&transport);
+
+				auto wait_reply = [&](uint64_t session_id, uint16_t packet_id) {
+					auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+					for (;;) {
+						transport.Pump();
+						std::lock_guard<std::mutex> lock(mutex);
+						for (const Reply& reply : replies) {
+							if (reply.session_id == session_id && reply.packet_id == packet_id) {
+								return reply;
+							}
+						}
+						Assert::IsTrue(std::chrono::steady_clock::now() < deadline);
+					}
+				};
+				auto read_fields = [](const std::string& payload) {
+					std::vector<std::pair<uint32_t, std::string>> fields; // varint 10 ڿ, ݺ ʵ 
+					Assert::IsTrue(WireFormat::ForEachField(payload.data(), payload.size(),
+						[&fields](uint32_t field, uint64_t value, const char* data, size_t length) {
+							fields.emplace_back(field, data ? std::string(data, length) : std::to_string(value));
+						}));
+					return fields;
+				};
+				auto send = [&](uint64_t session_id, uint16_t packet_id, const std::string& payload) {
+					const std::string packet = EchoHandler::MakeTestPacket(packet_id, payload);
+					transport.Write(session_id, packet.data(), packet.size());
+				};
+				auto login_and_enter = [&](const std::string& user_id, uint32_t history_count) {
+					const uint64_t session_id = transport.Connect();
+					std::string login;
+					WireFormat::AppendBytesField(login, 1, user_id);
+					WireFormat::AppendBytesField(login, 2, "pw");
+					send(session_id, Protocol::PacketID::LOGIN_REQ, login);
+					wait_reply(session_id, Protocol::PacketID::LOGIN_RES);
+
+					std::string enter;
+					WireFormat::AppendVarintField(enter, 1, room_id);
+					WireFormat::AppendVarintField(enter, 3, history_count);
+					send(session_id, Protocol::PacketID::ENTER_ROOM_REQ, enter);
+					return session_id;
+				};
+
+				// alice    ϸ  Ͽ  
+				const uint64_t alice = login_and_enter("alice", 0);
+				wait_reply(alice, Protocol::PacketID::ENTER_ROOM_RES);
+				for (int i = 1; i <= 3; ++i) {
+					std::string chat;
+					WireFormat::AppendBytesField(chat, 1, "chat " + std::to_string(i));
+					send(alice, Protocol::PacketID::ROOM_CHAT_REQ, chat);
+				}
+				auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+				while (room->GetHistory()->GetLastSequence() < 3) {
+					transport.Pump();
+					Assert::IsTrue(std::chrono::steady_clock::now() < deadline);
+				}
+
+				// ߿  bob û ŭ ֱ ä( )   
+				const uint64_t bob = login_and_enter("bob", 2);
+				auto enter_fields = read_fields(wait_reply(bob, Protocol::PacketID::ENTER_ROOM_RES).payload);
+				std::vector<std::string> users;
+				std::vector<std::string> recent;
+				std::string last_sequence;
+				for (const auto& field : enter_fields) {
+					if (field.first == 1) {
+						Assert::AreEqual(std::string("1"), field.second);
+					}
+					else if (field.first == 4) {
+						users.push_back(read_fields(field.second).front().second);
+					}
+					else if (field.first == 6) {
+						auto notify = read_fields(field.second);
+						Assert::AreEqual(std::string("alice"), notify[0].second);
+						recent.push_back(notify[1].second);
+					}
+					else if (field.first == 7) {
+						last_sequence = field.second;
+					}
+				}
+				Assert::AreEqual(static_cast<size_t>(2), recent.size());
+				Assert::AreEqual(std::string("chat 2"), recent[0]);
+				Assert::AreEqual(std::string("chat 3"), recent[1]);
+				Assert::AreEqual(std::string("3"), last_sequence);
+				std::sort(users.begin(), users.end());
+				Assert::AreEqual(static_cast<size_t>(2), users.size());
+				Assert::AreEqual(std::string("alice"), users[0]);
+				Assert::AreEqual(std::string("bob"), users[1]);
+
+				//  ִ alice  ˸
+				auto new_user = read_fields(wait_reply(alice, Protocol::PacketID::NEW_USER_IN_ROOM_NTF).payload);
+				Assert::AreEqual(std::string("bob"), read_fields(new_user[0].second).front().second);
+
+				// bob   alice  ˸
+				std::string leave;
+				WireFormat::AppendVarintField(leave, 1, room_id);
+				send(bob, Protocol::PacketID::LEAVE_ROOM_REQ, leave);
+				auto user_left = read_fields(wait_reply(alice, Protocol::PacketID::USER_LEFT_ROOM_NTF).payload);
+				Assert::AreEqual(std::string("bob"), user_left[0].second);
+				Assert::AreEqual(static_cast<size_t>(1), room->GetParticipantCount());
+
+				transport.Close(alice);
+				transport.Close(bob);
+			}
+			Session::SetTransport(nullptr);
+			Assert::IsTrue(RoomManager::GetInstance()->RemoveRoom(room_id));
+			dispatcher->UnregisterHandler(Protocol::PacketID::LOGIN_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::ENTER_ROOM_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::LEAVE_ROOM_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::ROOM_CHAT_REQ);
+			scheduler->Stop();
+			ChatHistoryManager::GetInstance()->Stop();
+			std::filesystem::remove_all(root);
+		}
+
+		TEST_METHOD(UploadHandlerStoresChunksAndDeduplicatesRepeatUpload)
+		{
+			namespace Protocol = NexusCore::Protocol;
+			namespace WireFormat = NexusCore::Protocol::WireFormat;
+
+			const uint32_t chunk_size = Protocol::Config::UPLOAD_CHUNK_SIZE;
+			std::string data(chunk_size * 2 + 321, '\0');
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 7 + i / 11);
+			SHA256Context sha;
+			sha.Update(data.data(), data.size());
+			const std::string file_hash = sha.FinalizeHex();
+
+			const std::filesystem::path directory = std::filesystem::temp_directory_path() / "nexus_upload_handler_test";
+			std::filesystem::remove_all(directory);
+			ContentStore::GetInstance()->Shutdown();
+			NexusCore::Common::Config::GetInstance()->SetString("file.storage_root", (directory / "storage").string());
+
+			TaskScheduler* scheduler = TaskScheduler::GetInstance();
+			Assert::IsTrue(scheduler->Start(2));
+			PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+			dispatcher->RegisterHandler(Protocol::PacketID::LOGIN_REQ, std::make_unique<LoginHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::FILE_UPLOAD_REQ, std::make_unique<FileUploadHandler>());
+			dispatcher->RegisterHandler(Protocol::PacketID::FILE_CHUNK_SEND, std::make_unique<FileUploadHandler>());
+
+			std::mutex mutex;
+			std::vector<std::pair<uint16_t, std::string>> replies;
+			{
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&](uint64_t, const Protocol::PacketHeader& header, const char* payload) {
+					std::lock_guard<std::mutex> lock(mutex);
+					replies.emplace_back(header.packet_id, std::string(payload, header.payload_length));
+				});
+				Session::SetTransport(&transport);
+
+				size_t next_reply = 0;
+				auto wait_reply = [&](uint16_t packet_id) {
+					auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+					for (;;) {
+						transport.Pump();
+						std::lock_guard<std::mutex> lock(mutex);
+						for (; next_reply < replies.size(); ++next_reply) {
+							if (replies[next_reply].first == packet_id) {
+								return replies[next_reply++].second;
+							}
+						}
+						Assert::IsTrue(std::chrono::steady_clock::now() < deadline);
+					}
+				};
+				auto read_fields = [](const std::string& payload) {
+					std::unordered_map<uint32_t, std::string> fields;
+					Assert::IsTrue(WireFormat::ForEachField(payload.data(), payload.size(),
+						[&fields](uint32_t field, uint64_t value, const char* data, size_t length) {
+							fields[field] = data ? std::string(data, length) : std::to_string(value);
+						}));
+					return fields;
+				};
+				const uint64_t session_id = transport.Connect();
+				auto send = [&](uint16_t packet_id, const std::string& payload) {
+					const std::string packet = EchoHandler::MakeTestPacket(packet_id, payload);
+					transport.Write(session_id, packet.data(), packet.size());
+				};
+				std::string upload;
+				WireFormat::AppendBytesField(upload, 1, "handler.bin");
+				WireFormat::AppendVarintField(upload, 2, data.size());
+				WireFormat::AppendBytesField(upload, 3, file_hash);
+
+				std::string login;
+				WireFormat::AppendBytesField(login, 1, "uploader");
+				send(Protocol::PacketID::LOGIN_REQ, login);
+				wait_reply(Protocol::PacketID::LOGIN_RES);
+
+				// ˷ ûũ ũ    ûũ ڿ Ϸ ˸
+				send(Protocol::PacketID::FILE_UPLOAD_REQ, upload);
+				auto response = read_fields(wait_reply(Protocol::PacketID::FILE_UPLOAD_RES));
+				Assert::AreEqual(std::string("1"), response[1]);
+				Assert::AreEqual(std::to_string(chunk_size), response[3]);
+				const uint64_t upload_id = std::stoull(response[2]);
+				for (uint32_t index = 0; index * chunk_size < data.size(); ++index) {
+					const size_t length = std::min<size_t>(chunk_size, data.size() - index * chunk_size);
+					std::string chunk;
+					WireFormat::AppendVarintField(chunk, 1, upload_id);
+					WireFormat::AppendVarintField(chunk, 2, index);
+					WireFormat::AppendVarintField(chunk, 3, length);
+					WireFormat::AppendBytesField(chunk, 4, data.data() + index * chunk_size, length);
+					send(Protocol::PacketID::FILE_CHUNK_SEND, chunk);
+				}
+				auto complete = read_fields(wait_reply(Protocol::PacketID::FILE_UPLOAD_COMPLETE_NTF));
+				Assert::AreEqual(std::to_string(upload_id), complete[1]);
+				Assert::AreEqual(std::string("1"), complete[2]);
+				std::ifstream stored(complete[3], std::ios::binary);
+				Assert::AreEqual(data, std::string(std::istreambuf_iterator<char>(stored), std::istreambuf_iterator<char>()));
+				stored.close();
+
+				//   ٽ ø ûũ   η Ϸ
+				send(Protocol::PacketID::FILE_UPLOAD_REQ, upload);
+				auto repeated = read_fields(wait_reply(Protocol::PacketID::FILE_UPLOAD_RES));
+				Assert::AreEqual(std::string("1"), repeated[1]);
+				Assert::AreEqual(std::string("1"), repeated[8]);
+				Assert::AreEqual(complete[3], repeated[9]);
+
+				transport.Close(session_id);
+			}
+			Session::SetTransport(nullptr);
+			dispatcher->UnregisterHandler(Protocol::PacketID::LOGIN_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::FILE_UPLOAD_REQ);
+			dispatcher->UnregisterHandler(Protocol::PacketID::FILE_CHUNK_SEND);
+			scheduler->Stop();
+			FileTransferManager::GetInstance()->CleanupExpiredTransfers();
+			ContentStore::GetInstance()->Shutdown();
+			std::filesystem::remove_all(directory);
+		}
+
+		TEST_METHOD(BroadcastCountsDeliveriesAcrossPartitions)
+		{
+			WorkerExecutor* executor = WorkerExecutor::GetInstance();
+			Assert::IsTrue(executor->Start(4));
+			{
+				std::atomic<size_t> received{ 0 };
+				LoopbackTransport transport;
+				transport.SetPacketCallback([&received](uint64_t, const NexusCore::Protocol::PacketHeader&, const char*) { ++received; });
+				Session::SetTransport(&transport);
+
+				//  ϳ ּ  (1024)    Ŀ .   ϳ α
+				const size_t session_count = 3 * 1024;
+				std::vector<uint64_t> session_ids;
+				size_t logged_in = 0;
+				for (size_t i = 0; i < session_count; ++i) {
+					session_ids.push_back(transport.Connect());
+					if (i % 3 == 0) {
+						EpochGuard guard;
+						SessionManager::GetInstance()->FindSession(session_ids.back())->SetLoggedIn("user" + std::to_string(i));
+						++logged_in;
+					}
+				}
+
+				const std::string notice = EchoHandler::MakeTestPacket(NexusCore::Protocol::PacketID::HEARTBEAT_RES, "notice");
+				BroadcastHandle all = SessionManager::GetInstance()->BroadcastToAll(notice.data(), notice.size());
+				Assert::AreEqual(session_count, all->Wait());
+
+				BroadcastHandle logged_in_only = SessionManager::GetInstance()->BroadcastToLoggedInUsers(notice.data(), notice.size());
+				Assert::AreEqual(logged_in, logged_in_only->Wait());
+
+				//     Ŷ   (Ϸ     )
+				Assert::AreEqual(session_count + logged_in, received.load());
+
+				for (uint64_t session_id : session_ids) {
+					transport.Close(session_id);
+				}
+			}
+			Session::SetTransport(nullptr);
+			executor->Stop();
+		}
+
+		TEST_METHOD(FileTransferManagerVerifiesHashAsChunksArrive)
+		{
+			const uint32_t chunk_size = NexusCore::Protocol::Config::UPLOAD_CHUNK_SIZE;
+			std::string data(chunk_size * 5 + 321, '\0');
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 7 + i / 11);
+
+			SHA256Context sha;
+			sha.Update(data.data(), data.size());
+			const std::string file_hash = sha.FinalizeHex();
+
+			// Ϸ  file.storage_root/store ̵
+			const std::filesystem::path storage_root = std::filesystem::temp_directory_path() / "nexus_upload_store_test";
+			ContentStore::GetInstance()->Shutdown();
+			std::filesystem::remove_all(storage_root);
+			NexusCore::Common::Config::GetInstance()->SetString("file.storage_root", storage_root.string());
+
+			FileTransferManager* manager = FileTransferManager::GetInstance();
+			auto send_chunk = [&](uint64_t upload_id, uint32_t index, char corrupt) {
+				std::string chunk = data.substr(static_cast<size_t>(index) * chunk_size, chunk_size);
+				chunk[0] ^= corrupt;
+				return manager->ProcessFileChunk(upload_id, index, chunk.data(), chunk.size());
+			};
+
+			//   ûũ 쿡 ߴٰ ؽÿ ݿ
+			const uint64_t upload_id = manager->StartFileUpload("chunks.bin", data.size(), file_hash, "uploader");
+			Assert::AreNotEqual(static_cast<uint64_t>(0), upload_id);
+			for (uint32_t index : { 0u, 2u, 1u, 4u, 3u, 5u, 3u }) {
+				Assert::IsTrue(send_chunk(upload_id, index, 0));
+			}
+			Assert::IsFalse(manager->ProcessFileChunk(upload_id, 6, data.data(), 1));
+			Assert::IsTrue(manager->CompleteTransfer(upload_id));
+
+			const std::string stored_path = manager->GetTransferInfo(upload_id)->stored_file_path;
+			Assert::IsFalse(std::filesystem::exists(manager->GetTransferInfo(upload_id)->temp_file_path));
+			std::ifstream stored(stored_path, std::ios::binary);
+			Assert::IsTrue(std::string(std::istreambuf_iterator<char>(stored), {}) == data);
+			stored.close();
+
+			//   ûũ  ٷ Ϸ
+			const uint64_t again_id = manager->StartFileUpload("again.bin", data.size(), file_hash, "other");
+			Assert::IsTrue(manager->GetTransferInfo(again_id)->is_deduplicated);
+			Assert::AreEqual(stored_path, manager->GetTransferInfo(again_id)->stored_file_path);
+			Assert::IsFalse(send_chunk(again_id, 0, 0));
+
+			//  ٲ ûũ ̸ Ϸ ź
+			data[0] ^= 0x55;
+			SHA256Context other_sha;
+			other_sha.Update(data.data(), data.size());
+			const uint64_t corrupt_id = manager->StartFileUpload("corrupt.bin", data.size(), other_sha.FinalizeHex(), "uploader");
+			for (uint32_t index = 0; index < 6; ++index) {
+				Assert::IsTrue(send_chunk(corrupt_id, index, index == 3 ? 1 : 0));
+			}
+			Assert::IsFalse(manager->CompleteTransfer(corrupt_id));
+
+			manager->CancelTransfer(corrupt_id);
+			manager->CancelTransfer(again_id);
+			manager->CancelTransfer(upload_id);
+			Assert::IsNull(manager->GetTransferInfo(upload_id));
+			ContentStore::GetInstance()->Shutdown();
+			NexusCore::Common::Config::GetInstance()->SetString("file.storage_root", "uploads");
+			std::filesystem::remove_all(storage_root);
+		}
+
+		TEST_METHOD(FileDownloadServesOnlyStorageRootAndFollowsReplacedFiles)
+		{
+			namespace fs = std::filesystem;
+			fs::create_directories("uploads");
+			fs::create_directories("uploads_private");
+			const std::string file_path = "uploads/nexus_download_test.bin";
+			std::ofstream("uploads_private/secret.bin", std::ios::binary) << "secret";
+			std::ofstream("uploadsX", std::ios::binary) << "sibling";
+
+			auto write_file = [&](size_t size) {
+				std::ofstream(file_path, std::ios::binary | std::ios::trunc) << std::string(size, 'd');
+			};
+			auto make_request = [](const std::string& path, uint64_t offset) {
+				std::string payload(1, '\x0A');
+				payload.push_back(static_cast<char>(path.size()));
+				payload += path;
+				payload.push_back('\x10');
+				for (; offset >= 0x80; offset >>= 7) payload.push_back(static_cast<char>((offset & 0x7F) | 0x80));
+				payload.push_back(static_cast<char>(offset));
+				return EchoHandler::MakeTestPacket(NexusCore::Protocol::PacketID::FILE_DOWNLOAD_REQ, payload);
+			};
+
+			std::vector<std::pair<uint16_t, std::string>> received;
+			uint64_t file_bytes = 0;
+			LoopbackTransport transport;
+			transport.SetPacketCallback([&](uint64_t, const NexusCore::Protocol::PacketHeader& header, const char* payload) {
+				if (header.packet_id == NexusCore::Protocol::PacketID::FILE_DOWNLOAD_DATA) {
+					Assert::IsNull(payload); //    Ѿ
+					file_bytes += header.payload_length - sizeof(NexusCore::Protocol::FileDownloadChunkHeader);
+				}
+				received.emplace_back(header.packet_id, payload ? std::string(payload, header.payload_length) : std::string());
+			});
+			Session::SetTransport(&transport);
+			const uint64_t session_id = transport.Connect();
+
+			FileDownloadHandler handler;
+			auto download = [&](const std::string& path, uint64_t offset) {
+				received.clear();
+				file_bytes = 0;
+				std::string packet = make_request(path, offset);
+				EpochGuard guard;
+				Session* session = SessionManager::GetInstance()->FindSession(session_id);
+				Assert::IsTrue(handler.HandlePacket(session, reinterpret_cast<NexusCore::Protocol::PacketHeader*>(packet.data()),
+					packet.data() + sizeof(NexusCore::Protocol::PacketHeader)));
+				Assert::IsFalse(received.empty());
+				Assert::AreEqual(NexusCore::Protocol::PacketID::FILE_DOWNLOAD_RES, received.front().first);
+				return received.front().second.size() > 1 && received.front().second[0] == '\x08'; // success = true
+			};
+
+			const uint32_t chunk = NexusCore::Protocol::Config::DOWNLOAD_CHUNK_SIZE;
+			write_file(chunk * 2 + 100);
+			Assert::IsTrue(download(file_path, 1000));
+			Assert::AreEqual(static_cast<uint64_t>(chunk * 2 + 100 - 1000), file_bytes);
+			Assert::AreEqual(static_cast<size_t>(4), received.size()); //  +  2 + Ϸ
+			Assert::AreEqual(NexusCore::Protocol::PacketID::FILE_DOWNLOAD_COMPLETE_NTF, received.back().first);
+
+			//  ο ̸ ġ δ ź
+			Assert::IsFalse(download("uploads_private/secret.bin", 0));
+			Assert::IsFalse(download("uploadsX", 0));
+			Assert::IsFalse(download("uploads/../uploads_private/secret.bin", 0));
+			Assert::AreEqual(static_cast<size_t>(1), received.size());
+
+			// ü  ĳõ ڵ    
+			write_file(chunk / 2);
+			Assert::IsTrue(download(file_path, 0));
+			Assert::AreEqual(static_cast<uint64_t>(chunk / 2), file_bytes);
+			Assert::AreEqual(static_cast<size_t>(0), FileDownloadManager::GetInstance()->GetActiveDownloadCount());
+
+			transport.Close(session_id);
+			Session::SetTransport(nullptr);
+			fs::remove(file_path);
+			fs::remove_all("uploads_private");
+			fs::remove("uploadsX");
+		}
+
+		TEST_METHOD(FileTransferManagerResumesFromJournalAfterRestart)
+		{
+			const uint32_t chunk_size = NexusCore::Protocol::Config::UPLOAD_CHUNK_SIZE;
+			std::string data(chunk_size * 6 + 77, '\0');
+			for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * 5 + i / 3);
+
+			SHA256Context sha;
+			sha.Update(data.data(), data.size());
+			const std::string file_hash = sha.FinalizeHex();
+
+			const std::filesystem::path directory = std::filesystem::temp_directory_path() / "nexus_resume_manager_test";
+			std::filesystem::remove_all(directory);
+			std::filesystem::create_directories(directory);
+			ContentStore::GetInstance()->Shutdown();
+			NexusCore::Common::Config::GetInstance()->SetString("file.storage_root", (directory / "storage").string());
+
+			//     ӽ  +  (ûũ 0~2, 4 )
+			const std::string temp_path = (directory / "upload_900.tmp").string();
+			std::ofstream(temp_path, std::ios::binary) << std::string(data.size(), '\0');
+			UploadJournal::TransferMeta meta;
+			meta.upload_id = 900;
+			meta.file_name = "restart.bin";
+			meta.file_size = data.size();
+			meta.file_hash = file_hash;
+			meta.sender_id = "uploader";
+			meta.chunk_size = chunk_size;
+			meta.total_chunks = 7;
+			{
+				auto journal = UploadJournal::Create(UploadJournal::GetJournalPath(temp_path), meta);
+				ChunkHashVerifier verifier(HashAlgorithm::SHA256, file_hash, meta.total_chunks);
+				std::fstream temp_file(temp_path, std::ios::binary | std::ios::in | std::ios::out);
+				for (uint32_t index : { 0u, 1u, 2u, 4u }) {
+					const size_t length = std::min<size_t>(chunk_size, data.size() - index * chunk_size);
+					temp_file.seekp(index * chunk_size);
+					temp_file.write(data.data() + index * chunk_size, length);
+					verifier.SubmitChunk(index, data.data() + index * chunk_size, length);
+					journal->MarkChunkReceived(index);
+					journal->SaveHashProgress(verifier);
+				}
+			}
+
+			FileTransferManager* manager = FileTransferManager::GetInstance();
+			Assert::AreEqual(static_cast<size_t>(1), manager->RecoverPersistedTransfers(directory.string()));
+			Assert::IsTrue(manager->GetTransferInfo(900)->is_detached);
+			Assert::IsFalse(manager->ProcessFileChunk(900, 3, data.data() + 3 * chunk_size, chunk_size)); // ̾ޱ 
+
+			std::vector<UploadJournal::ChunkRange> missing;
+			Assert::IsFalse(manager->ResumeFileUpload(900, "someone_else", missing));
+			Assert::IsTrue(manager->ResumeFileUpload(900, "uploader", missing));
+			Assert::AreEqual(static_cast<size_t>(2), missing.size());
+			Assert::AreEqual(3u, missing[0].first);
+			Assert::AreEqual(5u, missing[1].first);
+			Assert::AreEqual(2u, missing[1].count);
+
+			//  ε ID  ID ġ 
+			const uint64_t next_id = manager->StartFileUpload("next.bin", 10, file_hash, "uploader");
+			Assert::IsTrue(next_id > 900);
+			manager->CancelTransfer(next_id);
+
+			//   ٽ پ  ûũ  Ϸ
+			Assert::IsTrue(manager->ProcessFileChunk(900, 3, data.data() + 3 * chunk_size, chunk_size));
+			manager->DetachTransfersForUser("uploader");
+			Assert::IsTrue(manager->ResumeFileUpload(900, "uploader", missing));
+			Assert::AreEqual(static_cast<size_t>(1), missing.size());
+			Assert::AreEqual(5u, missing[0].first);
+			Assert::IsTrue(manager->ProcessFileChunk(900, 5, data.data() + 5 * chunk_size, chunk_size));
+			Assert::IsTrue(manager->ProcessFileChunk(900, 6, data.data() + 6 * chunk_size, 77));
+			Assert::IsTrue(manager->CompleteTransfer(900));
+			Assert::IsFalse(std::filesystem::exists(UploadJournal::GetJournalPath(temp_path)));
+
+			manager->CancelTransfer(900);
+			ContentStore::GetInstance()->Shutdown();
+			NexusCore::Common::Config::GetInstance()->SetString("file.storage_root", "uploads");
+			std::filesystem::remove_all(directory);
+		}
 	};
 }
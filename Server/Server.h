@@ -29,17 +29,19 @@ namespace NexusCore {
             bool InitializeWinsock();
             bool CreateIocpHandle();
             bool CreateListenSocket(uint16_t port);
-            bool CreateWorkerThreads();
+            bool CreateWorkerThreads(); // 带   ThreadPlacement::LoadFromConfig(worker_thread_count_)
+            // ڵ鷯 ٷ TaskScheduler::Start(WorkerPoolOptions::LoadFromConfig(worker_thread_count_)),
+            //   SetScalingListener LOG_INFO 
 
             //  Լ
-            static unsigned int __stdcall AcceptThreadProc(void* param);
-            static unsigned int __stdcall WorkerThreadProc(void* param);
-            static unsigned int __stdcall AdminThreadProc(void* param);
+            static unsigned int __stdcall AcceptThreadProc(void* param); // accept LoginAdmission::GetAcceptDelayMs()ŭ 
+            static unsigned int __stdcall WorkerThreadProc(void* param); //   PinCurrentThread(WORKER, Ŀ ȣ)
+            static unsigned int __stdcall AdminThreadProc(void* param);  // accept/ 嵵    ҷ 
 
             // I/O ó
             void ProcessIoCompletion(DWORD bytes_transferred, Core::Session* session,
                 Core::PerIoContext* io_context);
-            void ProcessRecvCompletion(Core::Session* session, DWORD bytes_transferred);
+            void ProcessRecvCompletion(Core::Session* session, DWORD bytes_transferred); //   SessionManager::SuspendSession
             void ProcessSendCompletion(Core::Session* session);
 
             //  ̽
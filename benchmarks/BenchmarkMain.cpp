@@ -0,0 +1,36 @@
+// NexusCore ũ ġũ 
+//  ְܼ Բ JSON Ϸε  ೢ Ѵ (compare.py ).
+// --benchmark_out  ָ   ״ .
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    bool has_out = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--benchmark_out=", 16) == 0) {
+            has_out = true;
+        }
+    }
+
+    std::string out_arg = "--benchmark_out=nexuscore_benchmarks.json";
+    std::string format_arg = "--benchmark_out_format=json";
+    std::vector<char*> args(argv, argv + argc);
+    if (!has_out) {
+        args.push_back(out_arg.data());
+        args.push_back(format_arg.data());
+    }
+    int arg_count = static_cast<int>(args.size());
+
+    benchmark::Initialize(&arg_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(arg_count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
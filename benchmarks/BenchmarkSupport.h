@@ -0,0 +1,154 @@
+#pragma once
+
+// ġũ : Ŀ ۰    
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Core/LoopbackTransport.h"
+#include "../Core/TaskScheduler.h"
+#include "../Core/WorkerExecutor.h"
+#include "../Common/Utils.h"
+
+namespace NexusCore {
+    namespace Benchmarks {
+
+        // ٷ Ŀ ⸦    (μ   )
+        inline size_t EnsureWorkers() {
+            static std::once_flag started;
+            static size_t worker_count = 0;
+            std::call_once(started, []() {
+                worker_count = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 4;
+                Core::TaskScheduler::GetInstance()->Start(worker_count);
+                Core::WorkerExecutor::GetInstance()->Start(worker_count);
+            });
+            return worker_count;
+        }
+
+        inline int64_t NowNs() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // ǥ fraction  (0.99 p99). ǥ  0
+        inline double Percentile(std::vector<double> samples, double fraction) {
+            if (samples.empty()) {
+                return 0.0;
+            }
+            const size_t index = (std::min)(samples.size() - 1, static_cast<size_t>(fraction * static_cast<double>(samples.size())));
+            std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+            return samples[index];
+        }
+
+        inline std::vector<char> MakePacket(uint16_t packet_id, const std::string& payload) {
+            Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(payload.size()),
+                Common::Utils::CryptoUtils::CalculateCRC32(payload.data(), payload.size()));
+
+            std::vector<char> packet(sizeof(header) + payload.size());
+            memcpy(packet.data(), &header, sizeof(header));
+            memcpy(packet.data() + sizeof(header), payload.data(), payload.size());
+            return packet;
+        }
+
+        // payload  8Ʈ  ð(NowNs)  Ŷ (ڴ padding Ʈŭ ä)
+        inline std::vector<char> MakeTimestampPacket(uint16_t packet_id, size_t padding = 0) {
+            const int64_t now_ns = NowNs();
+            std::string payload(sizeof(now_ns) + padding, 'x');
+            memcpy(payload.data(), &now_ns, sizeof(now_ns));
+            return MakePacket(packet_id, payload);
+        }
+
+        // LoopbackTransport   N.   Ŷ  
+        //   Ŷ ID ϸ  Ŷ payload  8Ʈ(MakeTimestampPacket  ۽ ð)  
+        class LoopbackClients {
+        public:
+            explicit LoopbackClients(size_t count) {
+                transport_.SetPacketCallback([this](uint64_t, const Protocol::PacketHeader& header, const char* payload) {
+                    if (header.packet_id == probe_packet_id_.load(std::memory_order_relaxed) &&
+                        payload && header.payload_length >= sizeof(int64_t)) {
+                        RecordLatency(payload);
+                    }
+                    delivered_.fetch_add(1, std::memory_order_release);
+                });
+                Core::Session::SetTransport(&transport_);
+
+                session_ids_.reserve(count);
+                for (size_t i = 0; i < count; ++i) {
+                    if (Connect() == 0) {
+                        break;
+                    }
+                }
+            }
+
+            ~LoopbackClients() {
+                for (uint64_t session_id : session_ids_) {
+                    transport_.Close(session_id);
+                }
+                Core::Session::SetTransport(nullptr);
+            }
+
+            //  ϳ ߰ ( ̺   0)
+            uint64_t Connect() {
+                const uint64_t session_id = transport_.Connect();
+                if (session_id != 0) {
+                    session_ids_.push_back(session_id);
+                }
+                return session_id;
+            }
+
+            //  ῡ  Ʈ  ǵ      (Pumpó  忡)
+            void WriteToAll(const std::vector<char>& bytes) {
+                for (uint64_t session_id : session_ids_) {
+                    transport_.Write(session_id, bytes.data(), bytes.size());
+                }
+                while (transport_.Pump() != 0) {
+                }
+            }
+
+            Core::LoopbackTransport& GetTransport() { return transport_; }
+            const std::vector<uint64_t>& GetSessionIds() const { return session_ids_; }
+            uint64_t GetDelivered() const { return delivered_.load(std::memory_order_relaxed); }
+
+            void SetLatencyProbe(uint16_t packet_id) { probe_packet_id_.store(packet_id, std::memory_order_relaxed); }
+
+            // ݱ   (ũ) ѱ 
+            std::vector<double> TakeLatencySamples() {
+                std::lock_guard<std::mutex> lock(latency_mutex_);
+                return std::exchange(latency_samples_us_, {});
+            }
+
+            //  Ŷ  target ̸  
+            void WaitForDelivered(uint64_t target) const {
+                while (delivered_.load(std::memory_order_acquire) < target) {
+                    std::this_thread::yield();
+                }
+            }
+
+        private:
+            void RecordLatency(const char* payload) {
+                int64_t sent_ns = 0;
+                memcpy(&sent_ns, payload, sizeof(sent_ns));
+                const double latency_us = static_cast<double>(NowNs() - sent_ns) / 1000.0;
+
+                std::lock_guard<std::mutex> lock(latency_mutex_);
+                latency_samples_us_.push_back(latency_us);
+            }
+
+            Core::LoopbackTransport transport_;
+            std::vector<uint64_t> session_ids_;
+            std::atomic<uint64_t> delivered_{ 0 };
+            std::atomic<uint16_t> probe_packet_id_{ 0 };
+            std::mutex latency_mutex_;
+            std::vector<double> latency_samples_us_;
+        };
+
+    } // namespace Benchmarks
+} // namespace NexusCore
@@ -0,0 +1,112 @@
+// Common ̺귯: CRC32,  ȸ, ΰ, ޸ 
+
+#include <benchmark/benchmark.h>
+
+#include "../Common/Config.h"
+#include "../Common/Logger.h"
+#include "../Common/MemoryAccountant.h"
+#include "../Common/Utils.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace NexusCore::Common;
+
+namespace {
+
+    // Ŷ   (  + ۽ )
+    void BM_Crc32(benchmark::State& state) {
+        std::vector<char> data(static_cast<size_t>(state.range(0)));
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<char>(i * 31);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Utils::CryptoUtils::CalculateCRC32(data.data(), data.size()));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+    BENCHMARK(BM_Crc32)->Arg(64)->Arg(512)->Arg(4096)->Arg(32 * 1024);
+
+    //     LoadFromConfig  ߿ Ҹ ( ȸ + ȯ)
+    void BM_ConfigGetInt(benchmark::State& state) {
+        Config* config = Config::GetInstance();
+        config->SetInt("bench.int_value", 42);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(config->GetInt("bench.int_value", 0));
+        }
+    }
+    BENCHMARK(BM_ConfigGetInt);
+
+    void BM_ConfigGetStringMissing(benchmark::State& state) {
+        Config* config = Config::GetInstance();
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(config->GetString("bench.missing_key", "default"));
+        }
+    }
+    BENCHMARK(BM_ConfigGetStringMissing);
+
+    void BM_ConfigGetIntContended(benchmark::State& state) {
+        Config* config = Config::GetInstance();
+        if (state.thread_index() == 0) {
+            config->SetInt("bench.int_value", 42);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(config->GetInt("bench.int_value", 0));
+        }
+    }
+    BENCHMARK(BM_ConfigGetIntContended)->ThreadRange(1, 8)->UseRealTime();
+
+    // ΰ: ּ  Ʒ  ȣ ϱ  ȣ
+    class LoggerFixture : public benchmark::Fixture {
+    public:
+        void SetUp(const benchmark::State& state) override {
+            if (state.thread_index() == 0) {
+                path_ = (std::filesystem::temp_directory_path() / "nexuscore_bench.log").string();
+                Logger::GetInstance()->Initialize(path_, LogLevel::INFO);
+                Logger::GetInstance()->SetConsoleOutput(false);
+            }
+        }
+
+        void TearDown(const benchmark::State& state) override {
+            if (state.thread_index() == 0) {
+                Logger::GetInstance()->Shutdown();
+                std::error_code ec;
+                std::filesystem::remove(path_, ec);
+            }
+        }
+
+    private:
+        std::string path_;
+    };
+
+    BENCHMARK_DEFINE_F(LoggerFixture, FilteredDebug)(benchmark::State& state) {
+        for (auto _ : state) {
+            LOG_DEBUG("bench debug message that is below the minimum level");
+        }
+    }
+    BENCHMARK_REGISTER_F(LoggerFixture, FilteredDebug)->ThreadRange(1, 4)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(LoggerFixture, InfoToFile)(benchmark::State& state) {
+        for (auto _ : state) {
+            LOG_INFO("bench info message written to the log file");
+        }
+    }
+    BENCHMARK_REGISTER_F(LoggerFixture, InfoToFile)->ThreadRange(1, 4)->UseRealTime();
+
+    // Ǯ/ť ü    θ
+    void BM_MemoryAccountantChargeRelease(benchmark::State& state) {
+        MemoryAccountant* accountant = MemoryAccountant::GetInstance();
+
+        for (auto _ : state) {
+            accountant->Charge(MemoryCategory::POOL, 256);
+            accountant->Release(MemoryCategory::POOL, 256);
+        }
+    }
+    BENCHMARK(BM_MemoryAccountantChargeRelease)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
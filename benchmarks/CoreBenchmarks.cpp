@@ -0,0 +1,377 @@
+// Core ⺻ ǰ: ޸ Ǯ, ,  , ġ,  ѵ, ٷ,  ȸ,  ,   NUMA ġ
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.h"
+#include "../Core/MemoryPool.h"
+#include "../Core/Statistics.h"
+#include "../Core/PacketAssembler.h"
+#include "../Core/PacketHandler.h"
+#include "../Core/RateLimiter.h"
+#include "../Core/SessionResume.h"
+#include "../Core/Managers.h"
+#include "../Core/EpochReclaimer.h"
+#include "../Core/SessionBufferPool.h"
+#include "../Core/ThreadPlacement.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NexusCore;
+using namespace NexusCore::Core;
+using NexusCore::Benchmarks::MakePacket;
+
+namespace {
+
+    // ===== MemoryPool =====
+
+    struct PooledBuffer {
+        char data[1024];
+    };
+
+    void BM_MemoryPoolAcquireRelease(benchmark::State& state) {
+        static MemoryPool<PooledBuffer> pool(64, 1024);
+
+        for (auto _ : state) {
+            auto buffer = pool.Acquire();
+            benchmark::DoNotOptimize(buffer.get());
+            pool.Release(std::move(buffer));
+        }
+    }
+    BENCHMARK(BM_MemoryPoolAcquireRelease)->ThreadRange(1, 8)->UseRealTime();
+
+    //  : Ǯ  new/delete
+    void BM_HeapAllocateFree(benchmark::State& state) {
+        for (auto _ : state) {
+            auto buffer = std::make_unique<PooledBuffer>();
+            benchmark::DoNotOptimize(buffer.get());
+        }
+    }
+    BENCHMARK(BM_HeapAllocateFree)->ThreadRange(1, 8)->UseRealTime();
+
+    // ===== Statistics =====
+
+    void BM_StatsIncrement(benchmark::State& state) {
+        for (auto _ : state) {
+            STATS_INCREMENT("bench.counter");
+        }
+    }
+    BENCHMARK(BM_StatsIncrement)->ThreadRange(1, 8)->UseRealTime();
+
+    void BM_StatsRecord(benchmark::State& state) {
+        double value = 0.0;
+        for (auto _ : state) {
+            STATS_RECORD("bench.latency_ms", value);
+            value += 0.5;
+        }
+    }
+    BENCHMARK(BM_StatsRecord)->ThreadRange(1, 8)->UseRealTime();
+
+    // =====   =====
+
+    //  ϳ ϼ Ŷ range(0) (   )
+    void BM_AssemblerWholeFrames(benchmark::State& state) {
+        const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_REQ, std::string(64, 'x'));
+        std::vector<char> stream;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            stream.insert(stream.end(), packet.begin(), packet.end());
+        }
+
+        PacketAssembler assembler;
+        size_t packets = 0;
+        const PacketAssembler::PacketCallback on_packet = [&packets](Protocol::PacketHeader*, char*) {
+            ++packets;
+            return true;
+        };
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(assembler.Feed(stream.data(), stream.size(), on_packet));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(packets));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+    }
+    BENCHMARK(BM_AssemblerWholeFrames)->Arg(1)->Arg(16)->Arg(128);
+
+    //  Ŷ  ſ  ߷  ( ۸  ̾ ̴ )
+    void BM_AssemblerSplitFrames(benchmark::State& state) {
+        std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_REQ, std::string(static_cast<size_t>(state.range(0)), 'x'));
+        const size_t half = packet.size() / 2;
+
+        PacketAssembler assembler;
+        size_t packets = 0;
+        const PacketAssembler::PacketCallback on_packet = [&packets](Protocol::PacketHeader*, char*) {
+            ++packets;
+            return true;
+        };
+
+        for (auto _ : state) {
+            assembler.Feed(packet.data(), half, on_packet);
+            benchmark::DoNotOptimize(assembler.Feed(packet.data() + half, packet.size() - half, on_packet));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(packets));
+    }
+    BENCHMARK(BM_AssemblerSplitFrames)->Arg(64)->Arg(4096)->Arg(32 * 1024);
+
+    // ===== ġ =====
+
+    class NoopHandler : public IPacketHandler {
+    public:
+        explicit NoopHandler(uint16_t packet_id) : packet_id_(packet_id) {}
+        bool HandlePacket(Session*, Protocol::PacketHeader*, char* payload) override {
+            benchmark::DoNotOptimize(payload);
+            return true;
+        }
+        uint16_t GetPacketId() const override { return packet_id_; }
+
+    private:
+        uint16_t packet_id_;
+    };
+
+    // ڵ鷯 ǥ ȸ +  ȣ (ȣ 忡 ٷ)
+    void BM_DispatchPacket(benchmark::State& state) {
+        PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+        if (state.thread_index() == 0) {
+            dispatcher->RegisterHandler(Protocol::PacketID::HEARTBEAT_REQ, std::make_unique<NoopHandler>(Protocol::PacketID::HEARTBEAT_REQ));
+        }
+        std::vector<char> packet = MakePacket(Protocol::PacketID::HEARTBEAT_REQ, std::string(16, 'h'));
+        auto* header = reinterpret_cast<Protocol::PacketHeader*>(packet.data());
+        char* payload = packet.data() + sizeof(Protocol::PacketHeader);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(dispatcher->DispatchPacket(nullptr, header, payload));
+        }
+
+        if (state.thread_index() == 0) {
+            dispatcher->UnregisterHandler(Protocol::PacketID::HEARTBEAT_REQ);
+        }
+    }
+    BENCHMARK(BM_DispatchPacket)->ThreadRange(1, 8)->UseRealTime();
+
+    // =====  ѵ =====
+
+    //  Ŷ  Ŷ + Ŭ Ŷ Һ
+    void BM_RateLimiterCheck(benchmark::State& state) {
+        RateLimiter* limiter = RateLimiter::GetInstance();
+        SessionRateState rate_state;
+        int64_t now_ms = RateLimiter::NowMs();
+        uint64_t step = 0;
+
+        for (auto _ : state) {
+            if ((++step & 0xFF) == 0) {
+                ++now_ms; // ū ٽ    θ  ʵ
+            }
+            benchmark::DoNotOptimize(limiter->Check(rate_state, Protocol::PacketID::ROOM_CHAT_REQ, 64, now_ms));
+        }
+    }
+    BENCHMARK(BM_RateLimiterCheck)->ThreadRange(1, 8)->UseRealTime();
+
+    // ===== ٷ =====
+
+    //  -> Ŀ   (⿭   պ)
+    void BM_SchedulerSubmitRoundTrip(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        TaskScheduler* scheduler = TaskScheduler::GetInstance();
+        std::atomic<bool> done{ false };
+
+        for (auto _ : state) {
+            const auto start = std::chrono::steady_clock::now();
+            done.store(false, std::memory_order_relaxed);
+            scheduler->Submit([&done]() { done.store(true, std::memory_order_release); }, Protocol::PacketClass::CHAT);
+            while (!done.load(std::memory_order_acquire)) {
+            }
+            state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+    BENCHMARK(BM_SchedulerSubmitRoundTrip)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+    // ε  з   ä ۾  ð ( ġ ä  )
+    void BM_SchedulerChatUnderBulkLoad(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        TaskScheduler* scheduler = TaskScheduler::GetInstance();
+        std::atomic<bool> done{ false };
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            for (int64_t i = 0; i < state.range(0); ++i) {
+                scheduler->Submit([]() {
+                    volatile uint64_t sink = 0;
+                    for (int spin = 0; spin < 2000; ++spin) {
+                        sink = sink + spin;
+                    }
+                }, Protocol::PacketClass::BULK);
+            }
+            done.store(false, std::memory_order_relaxed);
+            state.ResumeTiming();
+
+            scheduler->Submit([&done]() { done.store(true, std::memory_order_release); }, Protocol::PacketClass::CHAT);
+            while (!done.load(std::memory_order_acquire)) {
+            }
+
+            state.PauseTiming();
+            while (scheduler->GetQueueDepth() > 0) {
+                std::this_thread::yield();
+            }
+            state.ResumeTiming();
+        }
+    }
+    BENCHMARK(BM_SchedulerChatUnderBulkLoad)->Arg(0)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    // =====  ȸ =====
+
+    //  range(0)   ȸ ( ε +  Ȯ,  )
+    class SessionTableFixture : public benchmark::Fixture {
+    public:
+        void SetUp(const benchmark::State& state) override {
+            if (state.thread_index() == 0) {
+                for (int64_t i = 0; i < state.range(0); ++i) {
+                    Session* session = SessionManager::GetInstance()->CreateSession(INVALID_SOCKET);
+                    if (!session) {
+                        break;
+                    }
+                    session_ids_.push_back(session->GetSessionId());
+                }
+            }
+        }
+
+        void TearDown(const benchmark::State& state) override {
+            if (state.thread_index() == 0) {
+                for (uint64_t session_id : session_ids_) {
+                    SessionManager::GetInstance()->RemoveSession(session_id);
+                }
+                session_ids_.clear();
+                EpochReclaimer::GetInstance()->Reclaim();
+            }
+        }
+
+    protected:
+        std::vector<uint64_t> session_ids_;
+    };
+
+    BENCHMARK_DEFINE_F(SessionTableFixture, FindSession)(benchmark::State& state) {
+        SessionManager* manager = SessionManager::GetInstance();
+        uint64_t index = static_cast<uint64_t>(state.thread_index()) * 7919;
+
+        for (auto _ : state) {
+            index = (index * 6364136223846793005ull + 1442695040888963407ull);
+            EpochGuard guard;
+            benchmark::DoNotOptimize(manager->FindSession(session_ids_[(index >> 33) % session_ids_.size()]));
+        }
+    }
+    BENCHMARK_REGISTER_F(SessionTableFixture, FindSession)->Arg(1000)->Arg(100000)->ThreadRange(1, 8)->UseRealTime();
+
+    //  range(0)   (뷮 /    )
+    void BM_SessionCreateRemove(benchmark::State& state) {
+        SessionManager* manager = SessionManager::GetInstance();
+        std::vector<uint64_t> session_ids;
+        session_ids.reserve(static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            for (int64_t i = 0; i < state.range(0); ++i) {
+                Session* session = manager->CreateSession(INVALID_SOCKET);
+                if (session) {
+                    session_ids.push_back(session->GetSessionId());
+                }
+            }
+            for (uint64_t session_id : session_ids) {
+                manager->RemoveSession(session_id);
+            }
+            session_ids.clear();
+            EpochReclaimer::GetInstance()->Reclaim();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SessionCreateRemove)->Arg(1000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+    // =====   =====
+
+    //    ۽Ÿ ٴ 
+    void BM_ReplayRingPush(benchmark::State& state) {
+        ReplayRing ring;
+        auto packet = std::make_shared<const std::vector<char>>(MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x')));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(ring.Push(packet));
+        }
+    }
+    BENCHMARK(BM_ReplayRingPush);
+
+    //   ģ range(0) 
+    void BM_ReplayRingCollect(benchmark::State& state) {
+        ReplayRing ring;
+        auto packet = std::make_shared<const std::vector<char>>(MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x')));
+        for (int i = 0; i < 256; ++i) {
+            ring.Push(packet);
+        }
+        const uint64_t last_sequence = ring.GetLastSequence() - static_cast<uint64_t>(state.range(0));
+        std::vector<ReplayRing::Packet> missed;
+
+        for (auto _ : state) {
+            missed.clear();
+            benchmark::DoNotOptimize(ring.CollectAfter(last_sequence, missed));
+        }
+    }
+    BENCHMARK(BM_ReplayRingCollect)->Arg(1)->Arg(32)->Arg(100);
+
+    // =====   NUMA ġ =====
+
+    // Ŀ ŭ 尡  ۸  ä   ݳ ( Ϸ ó ޸ ).
+    // range(0) 1̸ 带 ThreadPlacement ȹ  ۰  ڱ  Ǯ ,
+    // 0̸ OS 带 űǷ ٸ  Ǯ ۸    ִ.   Ʈ    
+    //     尡 ٸ Ƚ(remote_ratio) ϸ, 尡 ϳ  찡 .
+    void BM_RecvBufferNodeLocality(benchmark::State& state) {
+        const bool pinned = state.range(0) != 0;
+        const size_t thread_count = (std::max)(std::thread::hardware_concurrency(), 2u);
+        constexpr int ROUNDS_PER_THREAD = 4096;
+
+        ThreadPlacement* placement = ThreadPlacement::GetInstance();
+        if (pinned) {
+            placement->Configure(CpuTopology::Detect(), AffinityOptions(), thread_count);
+        }
+
+        std::atomic<uint64_t> remote{ 0 };
+        for (auto _ : state) {
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < thread_count; ++i) {
+                threads.emplace_back([i, pinned, &remote]() {
+                    if (pinned) {
+                        ThreadPlacement::GetInstance()->PinCurrentThread(ThreadRole::WORKER, i);
+                    }
+
+                    SessionBufferPool* pool = SessionBufferPool::GetInstance();
+                    uint64_t local_remote = 0;
+                    uint64_t sum = 0;
+                    for (int round = 0; round < ROUNDS_PER_THREAD; ++round) {
+                        std::unique_ptr<RecvBuffer> buffer = pool->AcquireRecvBuffer();
+                        memset(buffer->data, round, sizeof(buffer->data));
+                        for (size_t offset = 0; offset < sizeof(buffer->data); offset += 64) {
+                            sum += static_cast<uint8_t>(buffer->data[offset]);
+                        }
+                        if (buffer->home_node != ThreadPlacement::GetCurrentNode()) {
+                            ++local_remote;
+                        }
+                        pool->ReleaseRecvBuffer(std::move(buffer));
+                    }
+                    benchmark::DoNotOptimize(sum);
+                    remote.fetch_add(local_remote, std::memory_order_relaxed);
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        const double touched = static_cast<double>(state.iterations()) * static_cast<double>(thread_count * ROUNDS_PER_THREAD);
+        state.SetBytesProcessed(static_cast<int64_t>(touched) * static_cast<int64_t>(sizeof(RecvBuffer::data)));
+        state.counters["remote_ratio"] = static_cast<double>(remote.load()) / touched;
+        state.counters["numa_nodes"] = static_cast<double>(placement->GetNodeCount());
+        state.counters["threads"] = static_cast<double>(thread_count);
+    }
+    BENCHMARK(BM_RecvBufferNodeLocality)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,210 @@
+// /ü  Ҿƿ:    (// )  ڰ   (ݺ p50/p99)
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.h"
+#include "../Core/ChatRoom.h"
+#include "../Core/Managers.h"
+#include "../Core/EpochReclaimer.h"
+#include "../Core/WorkerExecutor.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NexusCore;
+using namespace NexusCore::Core;
+using NexusCore::Benchmarks::LoopbackClients;
+using NexusCore::Benchmarks::MakePacket;
+
+namespace {
+
+    enum class RoomMode {
+        LOCKED,
+        ACTOR,
+        LARGE
+    };
+
+    // participants   ϳ.  LoopbackTransport پ ־  Ŷ    ִ.
+    // visitors Ǹ  濡  
+    class RoomFixture {
+    public:
+        RoomFixture(size_t participants, RoomMode mode, size_t visitors = 0)
+            : clients_(participants + visitors)
+            , room_(std::make_unique<ChatRoom>(1, "bench", participants + visitors)) {
+            if (mode == RoomMode::ACTOR) {
+                room_->EnableActorMode();
+            }
+            else if (mode == RoomMode::LARGE) {
+                room_->EnableLargeRoomMode();
+            }
+
+            // 帶    ȸ  ѾǷ ũ      
+            // (  Ƚó Ƿ ã ʹ  ȿ)
+            const std::vector<uint64_t>& session_ids = clients_.GetSessionIds();
+            for (size_t i = 0; i < participants && i < session_ids.size(); ++i) {
+                Session* session = nullptr;
+                {
+                    EpochGuard guard;
+                    session = SessionManager::GetInstance()->FindSession(session_ids[i]);
+                }
+                if (session) {
+                    room_->Enter(session);
+                    entered_.push_back(session);
+                }
+            }
+        }
+
+        ~RoomFixture() {
+            // Ǻ   , /Ϲڽ и   ڿ  ( ͸  )
+            std::atomic<size_t> remaining{ entered_.size() };
+            for (Session* session : entered_) {
+                room_->Leave(session);
+                room_->RunAfterLeave(session, [&remaining]() { --remaining; });
+            }
+            while (remaining.load(std::memory_order_acquire) != 0) {
+                std::this_thread::yield();
+            }
+            room_.reset();
+        }
+
+        ChatRoom* GetRoom() const { return room_.get(); }
+        const LoopbackClients& GetClients() const { return clients_; }
+
+    private:
+        LoopbackClients clients_;
+        std::unique_ptr<ChatRoom> room_;
+        std::vector<Session*> entered_;
+    };
+
+    // Ϲ         غ O(n)̹Ƿ, 10  ݺ     غ
+    void RunRoomBroadcast(benchmark::State& state, RoomMode mode) {
+        Benchmarks::EnsureWorkers();
+        const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x'));
+
+        RoomFixture fixture(static_cast<size_t>(state.range(0)), mode);
+        const uint64_t participants = fixture.GetRoom()->GetParticipantCount();
+        uint64_t target = fixture.GetClients().GetDelivered();
+        std::vector<double> latency_us;
+
+        for (auto _ : state) {
+            const int64_t start_ns = Benchmarks::NowNs();
+            fixture.GetRoom()->BroadcastMessage(packet.data(), packet.size());
+            target += participants;
+            fixture.GetClients().WaitForDelivered(target);
+            latency_us.push_back(static_cast<double>(Benchmarks::NowNs() - start_ns) / 1000.0);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * participants));
+        state.counters["participants"] = static_cast<double>(participants);
+        state.counters["p50_us"] = Benchmarks::Percentile(latency_us, 0.50);
+        state.counters["p99_us"] = Benchmarks::Percentile(latency_us, 0.99);
+    }
+
+    void BM_RoomBroadcastLocked(benchmark::State& state) {
+        RunRoomBroadcast(state, RoomMode::LOCKED);
+    }
+    BENCHMARK(BM_RoomBroadcastLocked)->RangeMultiplier(10)->Range(100, 10000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_RoomBroadcastLocked)->Arg(100000)->Iterations(10)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+    void BM_RoomBroadcastActor(benchmark::State& state) {
+        RunRoomBroadcast(state, RoomMode::ACTOR);
+    }
+    BENCHMARK(BM_RoomBroadcastActor)->RangeMultiplier(10)->Range(100, 10000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_RoomBroadcastActor)->Arg(100000)->Iterations(10)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+    void BM_RoomBroadcastLargeRoom(benchmark::State& state) {
+        RunRoomBroadcast(state, RoomMode::LARGE);
+    }
+    BENCHMARK(BM_RoomBroadcastLargeRoom)->RangeMultiplier(10)->Range(100, 10000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_RoomBroadcastLargeRoom)->Arg(100000)->Iterations(10)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+    // n 濡 /    (Ϲ  /帶   ,   常 ٲ)
+    void RunRoomChurn(benchmark::State& state, RoomMode mode) {
+        Benchmarks::EnsureWorkers();
+        const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x'));
+
+        RoomFixture fixture(static_cast<size_t>(state.range(0)), mode, 1);
+        Session* visitor = nullptr;
+        {
+            EpochGuard guard;
+            visitor = SessionManager::GetInstance()->FindSession(fixture.GetClients().GetSessionIds().back());
+        }
+
+        //  /    ٸ Ƿ и  MAX_PENDING_BROADCASTS 
+        // (   ť  ׿        ɸ)
+        constexpr uint64_t MAX_PENDING_BROADCASTS = 8;
+        const uint64_t participants = fixture.GetRoom()->GetParticipantCount();
+        uint64_t target = fixture.GetClients().GetDelivered();
+
+        for (auto _ : state) {
+            fixture.GetRoom()->Enter(visitor);
+            fixture.GetRoom()->BroadcastMessage(packet.data(), packet.size(), visitor);
+            fixture.GetRoom()->Leave(visitor);
+
+            target += participants;
+            if (target > participants * MAX_PENDING_BROADCASTS) {
+                fixture.GetClients().WaitForDelivered(target - participants * MAX_PENDING_BROADCASTS);
+            }
+        }
+    }
+
+    void BM_RoomChurnLocked(benchmark::State& state) {
+        RunRoomChurn(state, RoomMode::LOCKED);
+    }
+    BENCHMARK(BM_RoomChurnLocked)->Arg(50)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    void BM_RoomChurnActor(benchmark::State& state) {
+        RunRoomChurn(state, RoomMode::ACTOR);
+    }
+    BENCHMARK(BM_RoomChurnActor)->Arg(50)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    void BM_RoomChurnLargeRoom(benchmark::State& state) {
+        RunRoomChurn(state, RoomMode::LARGE);
+    }
+    BENCHMARK(BM_RoomChurnLargeRoom)->Arg(50)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    //  ü :  ̺ Ŀ ŭ   
+    void BM_BroadcastToAll(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x'));
+        LoopbackClients clients(static_cast<size_t>(state.range(0)));
+        size_t delivered = 0;
+
+        for (auto _ : state) {
+            delivered += SessionManager::GetInstance()->BroadcastToAll(packet.data(), packet.size())->Wait();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(delivered));
+    }
+    BENCHMARK(BM_BroadcastToAll)->Arg(10000)->Arg(100000)->Arg(200000)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    //   Ŀ range(1)    (ھ   Ȯ).   Ŀ  ǵ
+    void BM_BroadcastToAllScaling(benchmark::State& state) {
+        const size_t default_workers = Benchmarks::EnsureWorkers();
+        WorkerExecutor* executor = WorkerExecutor::GetInstance();
+        executor->Stop();
+        executor->Start(static_cast<size_t>(state.range(1)));
+
+        const std::vector<char> packet = MakePacket(Protocol::PacketID::ROOM_CHAT_NTF, std::string(64, 'x'));
+        size_t delivered = 0;
+        {
+            LoopbackClients clients(static_cast<size_t>(state.range(0)));
+            for (auto _ : state) {
+                delivered += SessionManager::GetInstance()->BroadcastToAll(packet.data(), packet.size())->Wait();
+            }
+        }
+
+        executor->Stop();
+        executor->Start(default_workers);
+
+        state.SetItemsProcessed(static_cast<int64_t>(delivered));
+        state.counters["workers"] = static_cast<double>(state.range(1));
+        state.counters["hardware_threads"] = static_cast<double>(std::thread::hardware_concurrency());
+    }
+    BENCHMARK(BM_BroadcastToAllScaling)->ArgsProduct({ { 100000 }, { 1, 2, 4, 8 } })
+        ->MeasureProcessCPUTime()->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,128 @@
+//  ε: ûũ   (̾ޱ) / 
+
+#include <benchmark/benchmark.h>
+
+#include "../Common/HashContext.h"
+#include "../Core/UploadJournal.h"
+#include "../Common/Protocol.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NexusCore::Common::Utils;
+using namespace NexusCore::Core;
+
+namespace {
+
+    const uint32_t CHUNK_SIZE = NexusCore::Protocol::Config::UPLOAD_CHUNK_SIZE;
+
+    std::string MakeBenchPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    UploadJournal::TransferMeta MakeMeta(uint32_t total_chunks) {
+        UploadJournal::TransferMeta meta;
+        meta.upload_id = 1;
+        meta.file_name = "bench.bin";
+        meta.file_size = static_cast<uint64_t>(total_chunks) * CHUNK_SIZE;
+        meta.sender_id = "bench";
+        meta.chunk_size = CHUNK_SIZE;
+        meta.total_chunks = total_chunks;
+        return meta;
+    }
+
+    //   ⸸: ûũ ϳ ؽ  (ؼ)
+    void BM_UploadChunkVerifyOnly(benchmark::State& state) {
+        const uint32_t total_chunks = 1024;
+        const std::vector<char> chunk(CHUNK_SIZE, 'x');
+        auto verifier = std::make_unique<ChunkHashVerifier>(HashAlgorithm::SHA256, "", total_chunks);
+        uint32_t index = 0;
+
+        for (auto _ : state) {
+            if (index == total_chunks) {
+                state.PauseTiming();
+                verifier = std::make_unique<ChunkHashVerifier>(HashAlgorithm::SHA256, "", total_chunks);
+                index = 0;
+                state.ResumeTiming();
+            }
+            verifier->SubmitChunk(index, chunk.data(), chunk.size());
+            ++index;
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * CHUNK_SIZE);
+    }
+    BENCHMARK(BM_UploadChunkVerifyOnly);
+
+    // FileTransferManager::ProcessFileChunk  :  + Ʈ + ؽ  
+    void BM_UploadChunkVerifyWithJournal(benchmark::State& state) {
+        const uint32_t total_chunks = 1024;
+        const std::vector<char> chunk(CHUNK_SIZE, 'x');
+        const std::string journal_path = MakeBenchPath("nexus_bench_upload.journal");
+        auto journal = UploadJournal::Create(journal_path, MakeMeta(total_chunks));
+        auto verifier = std::make_unique<ChunkHashVerifier>(HashAlgorithm::SHA256, "", total_chunks);
+        uint32_t index = 0;
+
+        for (auto _ : state) {
+            if (index == total_chunks) {
+                state.PauseTiming();
+                journal = UploadJournal::Create(journal_path, MakeMeta(total_chunks));
+                verifier = std::make_unique<ChunkHashVerifier>(HashAlgorithm::SHA256, "", total_chunks);
+                index = 0;
+                state.ResumeTiming();
+            }
+            verifier->SubmitChunk(index, chunk.data(), chunk.size());
+            journal->MarkChunkReceived(index);
+            journal->SaveHashProgress(*verifier);
+            ++index;
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * CHUNK_SIZE);
+
+        journal->Remove();
+    }
+    BENCHMARK(BM_UploadChunkVerifyWithJournal);
+
+    //   ̾ޱ غ:   +   +   
+    // : ü ûũ .   ް, ؽ  ڿ ûũ     
+    void BM_UploadJournalResume(benchmark::State& state) {
+        const uint32_t total_chunks = static_cast<uint32_t>(state.range(0));
+        const uint32_t hashed_chunks = total_chunks / 2;
+        const std::vector<char> chunk(CHUNK_SIZE, 'x');
+        const std::string temp_path = MakeBenchPath("nexus_bench_resume.tmp");
+        const std::string journal_path = UploadJournal::GetJournalPath(temp_path);
+        {
+            std::ofstream temp_file(temp_path, std::ios::binary | std::ios::trunc);
+            for (uint32_t i = 0; i < total_chunks; ++i) {
+                temp_file.write(chunk.data(), chunk.size());
+            }
+
+            auto journal = UploadJournal::Create(journal_path, MakeMeta(total_chunks));
+            ChunkHashVerifier verifier(HashAlgorithm::SHA256, "", total_chunks);
+            for (uint32_t i = 0; i < hashed_chunks; ++i) {
+                verifier.SubmitChunk(i, chunk.data(), chunk.size());
+                journal->MarkChunkReceived(i);
+            }
+            journal->SaveHashProgress(verifier);
+            for (uint32_t i = hashed_chunks + 1; i < hashed_chunks + 4 && i < total_chunks; ++i) {
+                journal->MarkChunkReceived(i);
+            }
+            journal->Flush(true);
+        }
+
+        size_t missing_ranges = 0;
+        for (auto _ : state) {
+            auto journal = UploadJournal::Open(journal_path);
+            auto verifier = journal->RestoreVerifier(temp_path);
+            missing_ranges = journal->GetMissingRanges().size();
+            benchmark::DoNotOptimize(verifier.get());
+        }
+        state.counters["missing_ranges"] = static_cast<double>(missing_ranges);
+
+        std::error_code ec;
+        std::filesystem::remove(journal_path, ec);
+        std::filesystem::remove(temp_path, ec);
+    }
+    BENCHMARK(BM_UploadJournalResume)->Arg(64)->Arg(1024)->Arg(16 * 1024)->Unit(benchmark::kMicrosecond);
+
+} // namespace
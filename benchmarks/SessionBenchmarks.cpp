@@ -0,0 +1,311 @@
+//  Ը ó:    , ڷƾ/ŷ ڵ鷯,    α Ϸ ð ä 
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.h"
+#include "../Core/PacketHandler.h"
+#include "../Core/Coroutine.h"
+#include "../Core/LoginAdmission.h"
+#include "../Core/RateLimiter.h"
+#include "../Core/SessionBufferPool.h"
+#include "../Core/Managers.h"
+#include "../Core/EpochReclaimer.h"
+#include "../Common/MemoryAccountant.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NexusCore;
+using namespace NexusCore::Core;
+using NexusCore::Benchmarks::LoopbackClients;
+using NexusCore::Benchmarks::MakePacket;
+using NexusCore::Benchmarks::MakeTimestampPacket;
+
+namespace {
+
+    //  payload response_id ״ . block_ms  ׵ Ŀ  (DB ȣ  ŷ I/O 䳻)
+    class EchoHandler : public IPacketHandler {
+    public:
+        EchoHandler(uint16_t packet_id, uint16_t response_id, uint32_t block_ms = 0)
+            : packet_id_(packet_id), response_id_(response_id), block_ms_(block_ms) {}
+
+        bool HandlePacket(Session* session, Protocol::PacketHeader* header, char* payload) override {
+            if (block_ms_ != 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(block_ms_));
+            }
+            const std::vector<char> response = MakePacket(response_id_, std::string(payload, header->payload_length));
+            return session->PostSend(response.data(), response.size());
+        }
+        uint16_t GetPacketId() const override { return packet_id_; }
+
+    private:
+        uint16_t packet_id_;
+        uint16_t response_id_;
+        uint32_t block_ms_;
+    };
+
+    // EchoHandler   wait_ms ٸ  , ٸ  Ŀ  
+    class AsyncEchoHandler : public IAsyncPacketHandler {
+    public:
+        AsyncEchoHandler(uint16_t packet_id, uint16_t response_id, uint32_t wait_ms)
+            : packet_id_(packet_id), response_id_(response_id), wait_ms_(wait_ms) {}
+
+        Task<bool> HandleAsync(Session* session, Protocol::PacketHeader* header, char* payload) override {
+            const uint64_t session_id = session->GetSessionId();
+            auto response = std::make_shared<const std::vector<char>>(
+                MakePacket(response_id_, std::string(payload, header->payload_length)));
+
+            co_await Delay(std::chrono::milliseconds(wait_ms_));
+
+            // ٸ     Ƿ ٽ ã (簳 ũ  ȿ )
+            Session* target = SessionManager::GetInstance()->FindSession(session_id);
+            if (!target) {
+                co_return false;
+            }
+            co_return co_await SendAsync(target, std::move(response));
+        }
+        uint16_t GetPacketId() const override { return packet_id_; }
+
+    private:
+        uint16_t packet_id_;
+        uint16_t response_id_;
+        uint32_t wait_ms_;
+    };
+
+    // α ó 䳻:  CPU ۾( ؽ  )  α · ٲٰ Ϸ  
+    class SimulatedLoginHandler : public IPacketHandler {
+    public:
+        explicit SimulatedLoginHandler(std::atomic<uint64_t>& logged_in) : logged_in_(logged_in) {}
+
+        bool HandlePacket(Session* session, Protocol::PacketHeader*, char*) override {
+            volatile uint64_t sink = 0;
+            for (int spin = 0; spin < 20000; ++spin) {
+                sink = sink + spin;
+            }
+            session->SetLoggedIn("bench" + std::to_string(session->GetSessionId()));
+            logged_in_.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+        uint16_t GetPacketId() const override { return Protocol::PacketID::LOGIN_REQ; }
+
+    private:
+        std::atomic<uint64_t>& logged_in_;
+    };
+
+    //   ݺؼ  ų  ʰ /  ѵ  ǯ ( ǵ)
+    class RateLimitLift {
+    public:
+        RateLimitLift() {
+            RateLimiter* limiter = RateLimiter::GetInstance();
+            session_policy_ = limiter->GetSessionPolicy();
+            limiter->SetSessionPolicy({ 0, 1, session_policy_.action });
+            for (size_t lane = 0; lane < Protocol::PACKET_CLASS_COUNT; ++lane) {
+                const auto packet_class = static_cast<Protocol::PacketClass>(lane);
+                class_policies_[lane] = limiter->GetClassPolicy(packet_class);
+                limiter->SetClassPolicy(packet_class, { 0, 1, class_policies_[lane].action });
+            }
+        }
+
+        ~RateLimitLift() {
+            RateLimiter* limiter = RateLimiter::GetInstance();
+            limiter->SetSessionPolicy(session_policy_);
+            for (size_t lane = 0; lane < Protocol::PACKET_CLASS_COUNT; ++lane) {
+                limiter->SetClassPolicy(static_cast<Protocol::PacketClass>(lane), class_policies_[lane]);
+            }
+        }
+
+    private:
+        RatePolicy session_policy_;
+        RatePolicy class_policies_[Protocol::PACKET_CLASS_COUNT];
+    };
+
+    // ƮƮ    range(0):  (     ) ð/CPU Ǵ  ޸
+    // range(1) 1̸ ޸  ƮƮ ̿  ۸  (ƮƮ Ȱ ġ )
+    void BM_IdleSessionsHeartbeat(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        const size_t session_count = static_cast<size_t>(state.range(0));
+        const bool hibernate = state.range(1) != 0;
+
+        RateLimitLift rate_limit_lift;
+        Session::SetHibernateIdleMs(hibernate ? 1 : 0);
+        PacketDispatcher::GetInstance()->RegisterHandler(Protocol::PacketID::HEARTBEAT_REQ,
+            std::make_unique<EchoHandler>(Protocol::PacketID::HEARTBEAT_REQ, Protocol::PacketID::HEARTBEAT_RES));
+
+        const std::vector<char> heartbeat = MakePacket(Protocol::PacketID::HEARTBEAT_REQ, std::string(8, 'h'));
+        size_t borrowed_recv = 0;
+        size_t accounted_bytes = 0;
+        {
+            LoopbackClients clients(session_count);
+            const uint64_t connected = clients.GetSessionIds().size();
+            uint64_t target = clients.GetDelivered();
+
+            for (auto _ : state) {
+                clients.WriteToAll(heartbeat);
+                target += connected;
+                clients.WaitForDelivered(target);
+            }
+
+            //    ǵ   ٽ   (޸̸ ۸ ݳ )
+            while (clients.GetTransport().Pump() != 0) {
+            }
+            borrowed_recv = SessionBufferPool::GetInstance()->GetBorrowedRecvCount();
+            accounted_bytes = Common::MemoryAccountant::GetInstance()->GetUsage();
+            state.counters["sessions"] = static_cast<double>(connected);
+        }
+        EpochReclaimer::GetInstance()->Reclaim();
+
+        PacketDispatcher::GetInstance()->UnregisterHandler(Protocol::PacketID::HEARTBEAT_REQ);
+        Session::SetHibernateIdleMs(Protocol::Config::SESSION_HIBERNATE_IDLE_SEC * 1000);
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * session_count));
+        state.counters["recv_buffers"] = static_cast<double>(borrowed_recv);
+        state.counters["resident_bytes_per_session"] = static_cast<double>(sizeof(Session)) +
+            static_cast<double>(borrowed_recv * sizeof(RecvBuffer)) / static_cast<double>(session_count);
+        state.counters["accounted_mb"] = static_cast<double>(accounted_bytes) / (1024.0 * 1024.0);
+    }
+    // 20  ޸   ۸  800MB
+    BENCHMARK(BM_IdleSessionsHeartbeat)->ArgsProduct({ { 20000, 200000 }, { 0, 1 } })
+        ->MeasureProcessCPUTime()->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    // ڵ鷯 1ms ٸ û range(0) Ǹ ϳ    ޱ
+    // range(1) 0̸ Ŀ  ڴ  ڵ鷯, 1̸ Delay Ŀ  ִ ڷƾ ڵ鷯
+    void BM_HandlerWaitCoroutineVsBlocking(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        const bool use_coroutine = state.range(1) != 0;
+        constexpr uint32_t WAIT_MS = 1;
+
+        RateLimitLift rate_limit_lift;
+        PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+        if (use_coroutine) {
+            dispatcher->RegisterAsyncHandler(Protocol::PacketID::HEARTBEAT_REQ,
+                std::make_unique<AsyncEchoHandler>(Protocol::PacketID::HEARTBEAT_REQ, Protocol::PacketID::HEARTBEAT_RES, WAIT_MS));
+        }
+        else {
+            dispatcher->RegisterHandler(Protocol::PacketID::HEARTBEAT_REQ,
+                std::make_unique<EchoHandler>(Protocol::PacketID::HEARTBEAT_REQ, Protocol::PacketID::HEARTBEAT_RES, WAIT_MS));
+        }
+
+        const std::vector<char> request = MakePacket(Protocol::PacketID::HEARTBEAT_REQ, std::string(8, 'h'));
+        {
+            LoopbackClients clients(static_cast<size_t>(state.range(0)));
+            const uint64_t connected = clients.GetSessionIds().size();
+            uint64_t target = clients.GetDelivered();
+
+            for (auto _ : state) {
+                clients.WriteToAll(request);
+                target += connected;
+                clients.WaitForDelivered(target);
+            }
+            state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * connected));
+        }
+        EpochReclaimer::GetInstance()->Reclaim();
+
+        dispatcher->UnregisterHandler(Protocol::PacketID::HEARTBEAT_REQ);
+        state.counters["workers"] = static_cast<double>(TaskScheduler::GetInstance()->GetWorkerCount());
+    }
+    BENCHMARK(BM_HandlerWaitCoroutineVsBlocking)->ArgsProduct({ { 100, 1000 }, { 0, 1 } })
+        ->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    //  : range(0)  Ѳ ٽ پ α   αϱ ɸ ð
+    // ׵ ̹ α ִ ǵ ä պ  (p50/p99)
+    // range(1)  α  (0̸   ް   )
+    void BM_ReconnectStorm(benchmark::State& state) {
+        Benchmarks::EnsureWorkers();
+        const size_t storm_size = static_cast<size_t>(state.range(0));
+        const uint32_t login_budget = static_cast<uint32_t>(state.range(1));
+        constexpr size_t CHATTING_SESSIONS = 32;
+        constexpr auto CHAT_INTERVAL = std::chrono::milliseconds(1);
+
+        RateLimitLift rate_limit_lift;
+        LoginAdmission* admission = LoginAdmission::GetInstance();
+        admission->SetLimits(login_budget != 0 ? login_budget : UINT32_MAX, static_cast<uint32_t>(storm_size));
+
+        std::atomic<uint64_t> logged_in{ 0 };
+        PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+        dispatcher->RegisterHandler(Protocol::PacketID::LOGIN_REQ, std::make_unique<SimulatedLoginHandler>(logged_in));
+        dispatcher->RegisterHandler(Protocol::PacketID::ROOM_CHAT_REQ,
+            std::make_unique<EchoHandler>(Protocol::PacketID::ROOM_CHAT_REQ, Protocol::PacketID::ROOM_CHAT_NTF));
+
+        const std::vector<char> login = MakePacket(Protocol::PacketID::LOGIN_REQ, "bench");
+        std::vector<double> chat_latency_us;
+
+        for (auto _ : state) {
+            LoopbackClients clients(CHATTING_SESSIONS);
+            Core::LoopbackTransport& transport = clients.GetTransport();
+            const std::vector<uint64_t> chatting = clients.GetSessionIds();
+            for (uint64_t session_id : chatting) {
+                EpochGuard guard;
+                if (Session* session = SessionManager::GetInstance()->FindSession(session_id)) {
+                    session->SetLoggedIn("chat" + std::to_string(session_id));
+                }
+            }
+            clients.SetLatencyProbe(Protocol::PacketID::ROOM_CHAT_NTF);
+
+            // IO  (Pump  忡)
+            std::atomic<bool> stop{ false };
+            std::thread io_thread([&]() {
+                while (!stop.load(std::memory_order_acquire)) {
+                    if (transport.Pump() == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            // äϴ ǵ  CHAT_INTERVAL   
+            std::thread chat_thread([&]() {
+                for (size_t turn = 0; !stop.load(std::memory_order_acquire); ++turn) {
+                    const std::vector<char> chat = MakeTimestampPacket(Protocol::PacketID::ROOM_CHAT_REQ, 56);
+                    transport.Write(chatting[turn % chatting.size()], chat.data(), chat.size());
+                    std::this_thread::sleep_for(CHAT_INTERVAL);
+                }
+            });
+
+            //  尡 accept :  θ ó и ۾   
+            const auto start = std::chrono::steady_clock::now();
+            const uint64_t logged_in_before = logged_in.load(std::memory_order_acquire);
+            for (size_t i = 0; i < storm_size; ++i) {
+                if (login_budget != 0) {
+                    const uint32_t delay_ms = admission->GetAcceptDelayMs();
+                    if (delay_ms != 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+                    }
+                }
+                const uint64_t session_id = clients.Connect();
+                if (session_id == 0) {
+                    break;
+                }
+                transport.Write(session_id, login.data(), login.size());
+            }
+            const uint64_t expected = clients.GetSessionIds().size() - chatting.size();
+            while (logged_in.load(std::memory_order_acquire) - logged_in_before < expected) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+            stop.store(true, std::memory_order_release);
+            chat_thread.join();
+            io_thread.join();
+
+            // ְ   ƿ   
+            std::vector<double> samples = clients.TakeLatencySamples();
+            chat_latency_us.insert(chat_latency_us.end(), samples.begin(), samples.end());
+        }
+        EpochReclaimer::GetInstance()->Reclaim();
+
+        dispatcher->UnregisterHandler(Protocol::PacketID::LOGIN_REQ);
+        dispatcher->UnregisterHandler(Protocol::PacketID::ROOM_CHAT_REQ);
+        admission->SetLimits(Protocol::Config::LOGIN_MAX_CONCURRENT, Protocol::Config::LOGIN_QUEUE_CAPACITY);
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * storm_size));
+        state.counters["chat_samples"] = static_cast<double>(chat_latency_us.size());
+        state.counters["chat_p50_us"] = Benchmarks::Percentile(chat_latency_us, 0.50);
+        state.counters["chat_p99_us"] = Benchmarks::Percentile(chat_latency_us, 0.99);
+    }
+    BENCHMARK(BM_ReconnectStorm)->Args({ 50000, 0 })->Args({ 50000, 64 })
+        ->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
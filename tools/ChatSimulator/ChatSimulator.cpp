@@ -0,0 +1,530 @@
+#include "ChatSimulator.h"
+#include "../../Core/LoopbackTransport.h"
+#include "../../Core/Managers.h"
+#include "../../Core/TaskScheduler.h"
+#include "../../Common/Protocol.h"
+#include "../../Common/Utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NexusCore {
+    namespace Core {
+
+        namespace {
+            using Clock = std::chrono::steady_clock;
+
+            constexpr uint32_t MAX_CHUNK_BYTES = 0xFFFF - 32;  // ûũ ʵ Ӹ 16Ʈ ̷ε  ȿ  
+            constexpr uint32_t QUIET_MS = 100;                 // ̸ŭ Ŷ  Ʈ   
+
+            // Ŭ̾Ʈ  û ڵ (protocols.md ʵ ȣ,  ʵ常)
+            using Protocol::WireFormat::AppendVarintField;
+            using Protocol::WireFormat::AppendBytesField;
+
+            void AppendStringField(std::string& out, uint32_t field, const std::string& value) {
+                AppendBytesField(out, field, value);
+            }
+
+            // 信 ʵ ϳ ã ( ȣ  ̸ ó )
+            bool FindField(const char* payload, size_t size, uint32_t wanted,
+                uint64_t& value, const char*& bytes, size_t& length) {
+                bool found = false;
+                Protocol::WireFormat::ForEachField(payload, size,
+                    [&](uint32_t field, uint64_t field_value, const char* data, size_t data_length) {
+                        if (field == wanted && !found) {
+                            found = true;
+                            value = field_value;
+                            bytes = data;
+                            length = data_length;
+                        }
+                    });
+                return found;
+            }
+
+            uint64_t ReadVarintField(const char* payload, size_t size, uint32_t field) {
+                uint64_t value = 0;
+                const char* bytes = nullptr;
+                size_t length = 0;
+                return FindField(payload, size, field, value, bytes, length) && !bytes ? value : 0;
+            }
+
+            std::string ReadStringField(const char* payload, size_t size, uint32_t field) {
+                uint64_t value = 0;
+                const char* bytes = nullptr;
+                size_t length = 0;
+                if (!FindField(payload, size, field, value, bytes, length) || !bytes) {
+                    return std::string();
+                }
+                return std::string(bytes, length);
+            }
+
+            std::string MakePacket(uint16_t packet_id, const std::string& payload) {
+                Protocol::PacketHeader header(packet_id, static_cast<uint16_t>(payload.size()),
+                    Common::Utils::CryptoUtils::CalculateCRC32(payload.data(), payload.size()));
+
+                std::string packet(reinterpret_cast<const char*>(&header), sizeof(header));
+                packet += payload;
+                return packet;
+            }
+
+            double ElapsedUs(Clock::time_point from, Clock::time_point to) {
+                return std::chrono::duration<double, std::micro>(to - from).count();
+            }
+
+            //  ǥ (Ŷ ݹ  Ŀ ÿ )
+            class SampleSet {
+            public:
+                void Add(double us) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    samples_.push_back(us);
+                }
+
+                void AddFailure() { ++failures_; }
+
+                size_t GetCount() const {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    return samples_.size() + failures_;
+                }
+
+                LatencySummary Summarize(double phase_ms) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    LatencySummary summary;
+                    summary.count = samples_.size();
+                    summary.failures = failures_;
+                    if (samples_.empty()) {
+                        return summary;
+                    }
+
+                    std::sort(samples_.begin(), samples_.end());
+                    auto percentile = [this](double ratio) {
+                        const size_t index = static_cast<size_t>(ratio * static_cast<double>(samples_.size() - 1) + 0.5);
+                        return samples_[index];
+                    };
+                    summary.p50_us = percentile(0.50);
+                    summary.p90_us = percentile(0.90);
+                    summary.p99_us = percentile(0.99);
+                    summary.max_us = samples_.back();
+                    summary.per_second = phase_ms > 0.0 ? static_cast<double>(summary.count) * 1000.0 / phase_ms : 0.0;
+                    return summary;
+                }
+
+            private:
+                mutable std::mutex mutex_;
+                std::vector<double> samples_;
+                std::atomic<uint64_t> failures_{ 0 };
+            };
+
+            struct PendingUpload {
+                std::vector<char> content;
+                Clock::time_point sent;
+            };
+
+            struct SimClient {
+                uint64_t session_id = 0;
+                uint32_t room_id = 0;
+                std::mt19937 rng;                       //  Ŭ̾Ʈ ൿ ݰ ε 
+                std::vector<uint8_t> actions;           // 1̸ ε
+                size_t next_action = 0;
+                uint64_t next_tick = 0;
+
+                Clock::time_point login_sent;
+                Clock::time_point enter_sent;
+                std::atomic<int> login_state{ 0 };      // 0: ٸ , 1: , -1: 
+                std::atomic<int> enter_state{ 0 };
+
+                std::vector<Clock::time_point> chat_sent; //  ->  ð (̸ ũ⸦  ξ д ʰ ġ )
+                size_t chat_count = 0;
+
+                std::mutex upload_mutex;
+                std::deque<std::unique_ptr<PendingUpload>> requested;  // FILE_UPLOAD_RES  (BULK Ʈ  )
+                std::unordered_map<uint64_t, std::unique_ptr<PendingUpload>> uploading; // upload_id -> Ϸ ˸ 
+                std::atomic<size_t> uploads_open{ 0 };
+            };
+
+            class SimulationRun {
+            public:
+                explicit SimulationRun(const SimulatorOptions& options) : options_(options) {
+                    transport_.SetPacketCallback([this](uint64_t session_id, const Protocol::PacketHeader& header, const char* payload) {
+                        OnPacket(session_id, header, payload);
+                    });
+                    Session::SetTransport(&transport_);
+                }
+
+                ~SimulationRun() {
+                    for (const auto& client : clients_) {
+                        transport_.Close(client->session_id);
+                    }
+                    WaitForScheduler();
+                    for (uint32_t room_id : room_ids_) {
+                        RoomManager::GetInstance()->RemoveRoom(room_id);
+                    }
+                    Session::SetTransport(nullptr);
+                }
+
+                SimulatorReport Execute() {
+                    SimulatorReport report;
+                    Setup();
+
+                    // α :     (LoginAdmission ⿭ ħ)
+                    Clock::time_point phase_start = Clock::now();
+                    for (size_t i = 0; i < clients_.size(); ++i) {
+                        SimClient& client = *clients_[i];
+                        std::string payload;
+                        AppendStringField(payload, 1, "sim" + std::to_string(options_.seed) + "_" + std::to_string(i));
+                        AppendStringField(payload, 2, "sim");
+                        client.login_sent = Clock::now();
+                        Write(client, Protocol::PacketID::LOGIN_REQ, payload);
+                    }
+                    PumpUntil([this]() { return login_.GetCount() == clients_.size(); });
+                    report.login = login_.Summarize(ElapsedMs(phase_start));
+                    report.login.failures += clients_.size() - login_.GetCount();
+
+                    phase_start = Clock::now();
+                    size_t entering = 0;
+                    for (const auto& client : clients_) {
+                        if (client->login_state != 1 || client->room_id == 0) {
+                            continue;
+                        }
+                        std::string payload;
+                        AppendVarintField(payload, 1, client->room_id);
+                        client->enter_sent = Clock::now();
+                        Write(*client, Protocol::PacketID::ENTER_ROOM_REQ, payload);
+                        ++entering;
+                    }
+                    PumpUntil([this, entering]() { return enter_room_.GetCount() == entering; });
+                    report.enter_room = enter_room_.Summarize(ElapsedMs(phase_start));
+                    report.enter_room.failures += entering - enter_room_.GetCount();
+
+                    phase_start = Clock::now();
+                    RunTraffic(report);
+                    PumpUntilQuiet();
+                    report.traffic_ms = ElapsedMs(phase_start);
+                    report.chat_fanout = chat_fanout_.Summarize(report.traffic_ms);
+                    report.upload = upload_.Summarize(report.traffic_ms);
+                    for (const auto& client : clients_) {
+                        report.upload.failures += client->uploads_open; // ѵ ȿ  
+                    }
+                    return report;
+                }
+
+            private:
+                void Setup() {
+                    for (size_t i = 0; i < options_.room_count; ++i) {
+                        ChatRoom* room = RoomManager::GetInstance()->CreateRoom("sim-room-" + std::to_string(i));
+                        if (room) {
+                            room_ids_.push_back(room->GetRoomId());
+                        }
+                    }
+
+                    for (size_t i = 0; i < options_.client_count; ++i) {
+                        auto client = std::make_unique<SimClient>();
+                        client->rng.seed(options_.seed * 1000003u + static_cast<uint32_t>(i));
+                        client->room_id = room_ids_.empty() ? 0 : room_ids_[i % room_ids_.size()];
+                        client->session_id = transport_.Connect();
+                        if (client->session_id == 0) {
+                            break; //  ̺  
+                        }
+
+                        client->actions.resize(options_.actions_per_client);
+                        for (uint8_t& action : client->actions) {
+                            action = client->rng() % 100 < options_.upload_percent ? 1 : 0;
+                        }
+                        client->chat_sent.resize(options_.actions_per_client);
+                        client->next_tick = options_.think_ticks > 0 ? client->rng() % (options_.think_ticks + 1) : 0;
+
+                        by_session_[client->session_id] = clients_.size();
+                        clients_.push_back(std::move(client));
+                    }
+                }
+
+                void RunTraffic(SimulatorReport& report) {
+                    size_t remaining = 0;
+                    for (const auto& client : clients_) {
+                        if (client->enter_state == 1) {
+                            remaining += client->actions.size();
+                        }
+                    }
+
+                    for (uint64_t tick = 0; remaining > 0; ++tick) {
+                        for (size_t i = 0; i < clients_.size(); ++i) {
+                            SimClient& client = *clients_[i];
+                            if (client.enter_state != 1) {
+                                continue;
+                            }
+                            while (client.next_action < client.actions.size() && client.next_tick <= tick) {
+                                if (client.actions[client.next_action++]) {
+                                    SendUpload(client, i);
+                                }
+                                else {
+                                    SendChat(client, i);
+                                    ++report.chats_sent;
+                                }
+                                --remaining;
+                                const uint32_t gap = options_.think_ticks > 0 ? client.rng() % (options_.think_ticks * 2 + 1) : 0;
+                                client.next_tick = tick + 1 + gap;
+                            }
+                        }
+                        transport_.Pump();
+                    }
+                }
+
+                void SendChat(SimClient& client, size_t index) {
+                    const size_t sequence = client.chat_count++;
+                    std::string message = "c" + std::to_string(index) + ":" + std::to_string(sequence) + ":";
+                    if (message.size() < options_.chat_bytes) {
+                        message.append(options_.chat_bytes - message.size(), 'x');
+                    }
+
+                    std::string payload;
+                    AppendStringField(payload, 1, message);
+                    client.chat_sent[sequence] = Clock::now();
+                    Write(client, Protocol::PacketID::ROOM_CHAT_REQ, payload);
+                }
+
+                void SendUpload(SimClient& client, size_t index) {
+                    auto upload = std::make_unique<PendingUpload>();
+                    upload->content.resize(options_.upload_bytes);
+                    for (char& byte : upload->content) {
+                        byte = static_cast<char>(client.rng());
+                    }
+
+                    std::string payload;
+                    AppendStringField(payload, 1, "sim_" + std::to_string(index) + "_" + std::to_string(client.next_action) + ".bin");
+                    AppendVarintField(payload, 2, upload->content.size());
+                    AppendStringField(payload, 3, Common::Utils::CryptoUtils::CalculateSHA256(upload->content.data(), upload->content.size()));
+
+                    {
+                        std::lock_guard<std::mutex> lock(client.upload_mutex);
+                        upload->sent = Clock::now();
+                        client.requested.push_back(std::move(upload));
+                    }
+                    ++client.uploads_open;
+                    Write(client, Protocol::PacketID::FILE_UPLOAD_REQ, payload);
+                }
+
+                void Write(SimClient& client, uint16_t packet_id, const std::string& payload) {
+                    const std::string packet = MakePacket(packet_id, payload);
+                    transport_.Write(client.session_id, packet.data(), packet.size());
+                }
+
+                // Ŀ 忡 ȣ
+                void OnPacket(uint64_t session_id, const Protocol::PacketHeader& header, const char* payload) {
+                    last_packet_ns_ = Clock::now().time_since_epoch().count();
+
+                    auto it = by_session_.find(session_id);
+                    if (it == by_session_.end() || !payload) {
+                        return;
+                    }
+                    SimClient& client = *clients_[it->second];
+                    const size_t size = header.payload_length;
+                    const Clock::time_point now = Clock::now();
+
+                    switch (header.packet_id) {
+                    case Protocol::PacketID::LOGIN_RES: {
+                        if (static_cast<int32_t>(ReadVarintField(payload, size, 4)) == Protocol::ErrorCode::LOGIN_QUEUED) {
+                            break; // ʰ    ٽ 
+                        }
+                        const bool success = ReadVarintField(payload, size, 1) != 0;
+                        client.login_state = success ? 1 : -1;
+                        success ? login_.Add(ElapsedUs(client.login_sent, now)) : login_.AddFailure();
+                        break;
+                    }
+                    case Protocol::PacketID::ENTER_ROOM_RES: {
+                        const bool success = ReadVarintField(payload, size, 1) != 0;
+                        client.enter_state = success ? 1 : -1;
+                        success ? enter_room_.Add(ElapsedUs(client.enter_sent, now)) : enter_room_.AddFailure();
+                        break;
+                    }
+                    case Protocol::PacketID::ROOM_CHAT_NTF:
+                        OnChatNotify(payload, size, now);
+                        break;
+                    case Protocol::PacketID::ROOM_CHAT_BATCH_NTF:
+                        Protocol::ChatBatchCodec::ForEachEntry(payload, size, [this, now](const char* notify, size_t notify_size) {
+                            OnChatNotify(notify, notify_size, now);
+                        });
+                        break;
+                    case Protocol::PacketID::FILE_UPLOAD_RES:
+                        OnUploadResponse(client, payload, size, now);
+                        break;
+                    case Protocol::PacketID::FILE_UPLOAD_COMPLETE_NTF: {
+                        std::unique_ptr<PendingUpload> upload;
+                        {
+                            std::lock_guard<std::mutex> lock(client.upload_mutex);
+                            auto upload_it = client.uploading.find(ReadVarintField(payload, size, 1));
+                            if (upload_it != client.uploading.end()) {
+                                upload = std::move(upload_it->second);
+                                client.uploading.erase(upload_it);
+                            }
+                        }
+                        if (upload) {
+                            ReadVarintField(payload, size, 2) != 0 ? upload_.Add(ElapsedUs(upload->sent, now)) : upload_.AddFailure();
+                            --client.uploads_open;
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                    }
+                }
+
+                void OnChatNotify(const char* notify, size_t size, Clock::time_point now) {
+                    // ޽ ոӸ "c< Ŭ̾Ʈ>:<>:"  ð ã
+                    const std::string message = ReadStringField(notify, size, 2);
+                    if (message.size() < 2 || message[0] != 'c') {
+                        return;
+                    }
+                    char* end = nullptr;
+                    const size_t sender = std::strtoull(message.c_str() + 1, &end, 10);
+                    if (*end != ':' || sender >= clients_.size()) {
+                        return;
+                    }
+                    const size_t sequence = std::strtoull(end + 1, &end, 10);
+                    const SimClient& client = *clients_[sender];
+                    if (sequence < client.chat_sent.size()) {
+                        chat_fanout_.Add(ElapsedUs(client.chat_sent[sequence], now));
+                    }
+                }
+
+                void OnUploadResponse(SimClient& client, const char* payload, size_t size, Clock::time_point now) {
+                    std::unique_ptr<PendingUpload> upload;
+                    {
+                        std::lock_guard<std::mutex> lock(client.upload_mutex);
+                        if (client.requested.empty()) {
+                            return;
+                        }
+                        upload = std::move(client.requested.front());
+                        client.requested.pop_front();
+                    }
+
+                    const bool success = ReadVarintField(payload, size, 1) != 0;
+                    const uint64_t upload_id = ReadVarintField(payload, size, 2);
+                    if (!success || upload_id == 0) {
+                        upload_.AddFailure();
+                        --client.uploads_open;
+                        return;
+                    }
+                    if (ReadVarintField(payload, size, 8) != 0) {
+                        upload_.Add(ElapsedUs(upload->sent, now)); //   ̹ ־ ûũ  
+                        --client.uploads_open;
+                        return;
+                    }
+
+                    //  ˷ ûũ ũ  ûũ  ( ûũ ª  )
+                    const uint32_t chunk_size = static_cast<uint32_t>(ReadVarintField(payload, size, 3));
+                    if (chunk_size == 0 || chunk_size > MAX_CHUNK_BYTES) {
+                        upload_.AddFailure();
+                        --client.uploads_open;
+                        return;
+                    }
+
+                    // Ϸ ˸ ûũ  ó  Ƿ ѱ  
+                    std::vector<char> content = std::move(upload->content);
+                    {
+                        std::lock_guard<std::mutex> lock(client.upload_mutex);
+                        client.uploading[upload_id] = std::move(upload);
+                    }
+
+                    uint32_t chunk_index = 0;
+                    for (size_t offset = 0; offset < content.size(); offset += chunk_size, ++chunk_index) {
+                        const size_t length = (std::min)(static_cast<size_t>(chunk_size), content.size() - offset);
+                        std::string chunk;
+                        AppendVarintField(chunk, 1, upload_id);
+                        AppendVarintField(chunk, 2, chunk_index);
+                        AppendVarintField(chunk, 3, length);
+                        AppendBytesField(chunk, 4, content.data() + offset, length);
+                        Write(client, Protocol::PacketID::FILE_CHUNK_SEND, chunk);
+                    }
+                }
+
+                template<typename Predicate>
+                bool PumpUntil(Predicate done) {
+                    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(options_.timeout_ms);
+                    for (;;) {
+                        const size_t delivered = transport_.Pump();
+                        if (done()) {
+                            return true;
+                        }
+                        if (Clock::now() >= deadline) {
+                            return false;
+                        }
+                        if (delivered == 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+                //  ε尡  QUIET_MS   Ŷ  
+                void PumpUntilQuiet() {
+                    PumpUntil([this]() {
+                        for (const auto& client : clients_) {
+                            if (client->uploads_open > 0) {
+                                return false;
+                            }
+                        }
+                        const int64_t quiet_ns = Clock::now().time_since_epoch().count() - last_packet_ns_.load();
+                        return TaskScheduler::GetInstance()->GetQueueDepth() == 0 &&
+                            quiet_ns >= std::chrono::duration_cast<Clock::duration>(std::chrono::milliseconds(QUIET_MS)).count();
+                    });
+                }
+
+                void WaitForScheduler() {
+                    PumpUntil([]() { return TaskScheduler::GetInstance()->GetQueueDepth() == 0; });
+                }
+
+                static double ElapsedMs(Clock::time_point from) {
+                    return std::chrono::duration<double, std::milli>(Clock::now() - from).count();
+                }
+
+                SimulatorOptions options_;
+                LoopbackTransport transport_;
+                std::vector<uint32_t> room_ids_;
+                std::vector<std::unique_ptr<SimClient>> clients_;
+                std::unordered_map<uint64_t, size_t> by_session_; // Ʈ   ä Ŀ б⸸
+
+                SampleSet login_;
+                SampleSet enter_room_;
+                SampleSet chat_fanout_;
+                SampleSet upload_;
+                std::atomic<int64_t> last_packet_ns_{ 0 };
+            };
+
+            void AppendSummary(std::ostringstream& out, const char* name, const LatencySummary& summary) {
+                out << std::left << std::setw(12) << name << std::right
+                    << " count=" << summary.count << " fail=" << summary.failures
+                    << " p50=" << summary.p50_us << "us p90=" << summary.p90_us << "us p99=" << summary.p99_us
+                    << "us max=" << summary.max_us << "us rate=" << summary.per_second << "/s\n";
+            }
+        }
+
+        ChatSimulator::ChatSimulator(const SimulatorOptions& options) : options_(options) {
+        }
+
+        SimulatorReport ChatSimulator::Run() {
+            SimulationRun run(options_);
+            return run.Execute();
+        }
+
+        std::string SimulatorReport::ToString() const {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(1);
+            AppendSummary(out, "login", login);
+            AppendSummary(out, "enter_room", enter_room);
+            AppendSummary(out, "chat_fanout", chat_fanout);
+            AppendSummary(out, "upload", upload);
+            out << "chats_sent=" << chats_sent << " traffic_ms=" << traffic_ms << "\n";
+            return out.str();
+        }
+
+    } // namespace Core
+} // namespace NexusCore
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace NexusCore {
+    namespace Core {
+
+        struct SimulatorOptions {
+            uint32_t seed = 1;                //  õ  ൿ  
+            size_t client_count = 1000;
+            size_t room_count = 10;           // Ŭ̾Ʈ i  i % room_count
+            size_t actions_per_client = 20;   //    ä/ε 
+            uint32_t upload_percent = 5;      // ൿ  ε ,  ä
+            size_t chat_bytes = 64;
+            size_t upload_bytes = 64 * 1024;
+            uint32_t think_ticks = 4;         // ൿ    (Pump    ƽ, 0̸  ƽ)
+            uint32_t timeout_ms = 30000;      // ܰ踶  ٸ ѵ
+        };
+
+        //  ũ. count   ͸, ѵ ȿ  ϰų  û failures
+        struct LatencySummary {
+            uint64_t count = 0;
+            uint64_t failures = 0;
+            double p50_us = 0.0;
+            double p90_us = 0.0;
+            double p99_us = 0.0;
+            double max_us = 0.0;
+            double per_second = 0.0;          // ܰ ð  ó
+        };
+
+        struct SimulatorReport {
+            LatencySummary login;
+            LatencySummary enter_room;
+            LatencySummary chat_fanout;       //  ð ->  ٸ    ð (޸ ϳ)
+            LatencySummary upload;            // FILE_UPLOAD_REQ -> FILE_UPLOAD_COMPLETE_NTF
+            uint64_t chats_sent = 0;
+            double traffic_ms = 0.0;          // ä/ε ܰ ð
+
+            std::string ToString() const;
+        };
+
+        //   ä   ùķ
+        // LoopbackTransport Ŭ̾Ʈ ̰ α ->   -> ä/ε  Ʈ ʷ .
+        // ൿ , ޽ , ε  õθ , ƽ(Pump  ) ʰ  Ŭ̾Ʈ .
+        // ڵ鷯 ٷ   ״ Ƿ ȣϱ  PacketDispatcher ϰ TaskScheduler  ģ.
+        class ChatSimulator {
+        public:
+            explicit ChatSimulator(const SimulatorOptions& options);
+
+            SimulatorReport Run(); //    ǰ   
+
+        private:
+            SimulatorOptions options_;
+        };
+
+    } // namespace Core
+} // namespace NexusCore
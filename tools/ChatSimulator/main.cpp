@@ -0,0 +1,85 @@
+// ChatSimulator :    ھ  ϴ  
+// : ChatSimulator --clients 10000 --rooms 100 --actions 50 --upload-percent 5 --seed 7
+
+#include <winsock2.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ChatSimulator.h"
+#include "../../Core/PacketHandler.h"
+#include "../../Core/TaskScheduler.h"
+#include "../../Core/WorkerExecutor.h"
+
+using namespace NexusCore;
+using namespace NexusCore::Core;
+
+namespace {
+    void PrintUsage() {
+        std::cout << "usage: ChatSimulator [--clients N] [--rooms N] [--actions N] [--upload-percent P]\n"
+                     "                     [--chat-bytes N] [--upload-bytes N] [--think-ticks N] [--seed N]\n"
+                     "                     [--workers N] [--timeout-ms N]\n";
+    }
+
+    void RegisterHandlers() {
+        PacketDispatcher* dispatcher = PacketDispatcher::GetInstance();
+        dispatcher->RegisterHandler(Protocol::PacketID::LOGIN_REQ, std::make_unique<LoginHandler>());
+        dispatcher->RegisterHandler(Protocol::PacketID::ENTER_ROOM_REQ, std::make_unique<EnterRoomHandler>());
+        dispatcher->RegisterHandler(Protocol::PacketID::LEAVE_ROOM_REQ, std::make_unique<LeaveRoomHandler>());
+        dispatcher->RegisterHandler(Protocol::PacketID::ROOM_CHAT_REQ, std::make_unique<ChatMessageHandler>());
+        dispatcher->RegisterHandler(Protocol::PacketID::FILE_UPLOAD_REQ, std::make_unique<FileUploadHandler>());
+        dispatcher->RegisterHandler(Protocol::PacketID::FILE_CHUNK_SEND, std::make_unique<FileUploadHandler>()); // ûũ ε ó⿡
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    SimulatorOptions options;
+    size_t worker_count = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || i + 1 >= argc) {
+            PrintUsage();
+            return strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+
+        const unsigned long long value = std::strtoull(argv[++i], nullptr, 10);
+        if (strcmp(arg, "--clients") == 0) options.client_count = static_cast<size_t>(value);
+        else if (strcmp(arg, "--rooms") == 0) options.room_count = static_cast<size_t>(value);
+        else if (strcmp(arg, "--actions") == 0) options.actions_per_client = static_cast<size_t>(value);
+        else if (strcmp(arg, "--upload-percent") == 0) options.upload_percent = static_cast<uint32_t>(value);
+        else if (strcmp(arg, "--chat-bytes") == 0) options.chat_bytes = static_cast<size_t>(value);
+        else if (strcmp(arg, "--upload-bytes") == 0) options.upload_bytes = static_cast<size_t>(value);
+        else if (strcmp(arg, "--think-ticks") == 0) options.think_ticks = static_cast<uint32_t>(value);
+        else if (strcmp(arg, "--seed") == 0) options.seed = static_cast<uint32_t>(value);
+        else if (strcmp(arg, "--workers") == 0) worker_count = static_cast<size_t>(value);
+        else if (strcmp(arg, "--timeout-ms") == 0) options.timeout_ms = static_cast<uint32_t>(value);
+        else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (worker_count == 0) {
+        worker_count = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 4;
+    }
+
+    RegisterHandlers();
+    TaskScheduler::GetInstance()->Start(worker_count);
+    WorkerExecutor::GetInstance()->Start(worker_count);
+
+    std::cout << "clients=" << options.client_count << " rooms=" << options.room_count
+              << " actions=" << options.actions_per_client << " upload%=" << options.upload_percent
+              << " seed=" << options.seed << " workers=" << worker_count << "\n";
+
+    const SimulatorReport report = ChatSimulator(options).Run();
+    std::cout << report.ToString();
+
+    WorkerExecutor::GetInstance()->Stop();
+    TaskScheduler::GetInstance()->Stop();
+    return 0;
+}